@@ -0,0 +1,481 @@
+#include "Benchmark.h"
+#include "Terminal.h"
+#include "ST7789.h"
+#include "Renderer.h"
+#include "SPI_Flash.h"
+#include "Image.h"
+#include "Blit.h"
+#include "Chart.h"
+
+#define BENCHMARK_ITERATIONS 1000 // 每项测试的重复次数
+
+/**
+ * SysTick每计数一次对应的CPU周期数
+ */
+#define BENCHMARK_CYCLES_PER_COUNT (configCPU_CLOCK_HZ / configSYSTICK_CLOCK_HZ)
+
+/**
+ * 读取当前CPU周期计数
+ * 由系统节拍数和SysTick当前值拼接，分辨率为BENCHMARK_CYCLES_PER_COUNT个周期，
+ * 测量区间可以跨越多个节拍
+ * @return 自调度器启动以来的CPU周期数（约67秒回绕一次，差值计算不受影响）
+ */
+uint32_t Benchmark_Now(void) {
+    TickType_t tick;
+    uint32_t value;
+
+    // 读取过程中发生节拍中断时重新读取，保证两者一致
+    do {
+        tick = xTaskGetTickCount();
+        value = SysTick->VAL;
+    } while (tick != xTaskGetTickCount());
+
+    return (uint32_t)tick * (configCPU_CLOCK_HZ / configTICK_RATE_HZ)
+         + (SysTick->LOAD - value) * BENCHMARK_CYCLES_PER_COUNT;
+}
+
+/**
+ * 旧版%u转换，每位数字调用两次软件除法，仅作为对照保留
+ * @param num 数值
+ * @param out 输出缓冲区，至少11字节
+ * @return 数字个数
+ */
+static int Benchmark_Legacy_Utoa(unsigned int num, char *out) {
+    char temp[12];
+    int j = 0;
+    int len = 0;
+
+    // 逆序生成数字字符
+    do {
+        temp[j++] = '0' + (num % 10);
+        num /= 10;
+    } while (num > 0);
+    // 反转得到正确顺序
+    while (j > 0) {
+        out[len++] = temp[--j];
+    }
+    out[len] = '\0';
+    return len;
+}
+
+/**
+ * 对比旧版除法循环与查表格式化的%u转换耗时，结果输出到终端
+ * 输入取最坏情况的10位数和常见的短数字两组
+ */
+void Benchmark_Terminal_Format(void) {
+    static const unsigned int samples[2] = { 4294967295u, 1234u };
+    char buf[12];
+    volatile int sink = 0; // 防止编译器优化掉转换结果
+
+    for (int s = 0; s < 2; s++) {
+        uint32_t start = Benchmark_Now();
+        for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+            sink += Benchmark_Legacy_Utoa(samples[s] - (unsigned int)i, buf);
+        }
+        uint32_t legacy = Benchmark_Now() - start;
+
+        start = Benchmark_Now();
+        for (int i = 0; i < BENCHMARK_ITERATIONS; i++) {
+            sink += Terminal_Snprintf(buf, sizeof(buf), "%u", samples[s] - (unsigned int)i);
+        }
+        uint32_t table = Benchmark_Now() - start;
+
+        Terminal_Output("$ [Bench] %%u %u: legacy %u cyc, table %u cyc\n",
+                        samples[s], legacy / BENCHMARK_ITERATIONS, table / BENCHMARK_ITERATIONS);
+        vTaskDelay(50); // 等待终端输出完成
+    }
+}
+
+/**
+ * 逐像素、逐分量的整体透明度混合，公式与Blit_Blend相同，仅作为对照
+ * @param a 透明度0~32
+ */
+static void Benchmark_Naive_Blend(uint16_t *dst, const uint16_t *src, uint32_t count, uint32_t a) {
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t f = src[i];
+        uint32_t b = dst[i];
+        uint32_t r = ((f >> 11) * a + (b >> 11) * (32 - a)) >> 5;
+        uint32_t g = (((f >> 5) & 0x3F) * a + ((b >> 5) & 0x3F) * (32 - a)) >> 5;
+        uint32_t bl = ((f & 0x1F) * a + (b & 0x1F) * (32 - a)) >> 5;
+        dst[i] = (uint16_t)((r << 11) | (g << 5) | bl);
+    }
+}
+
+/**
+ * 逐像素的色键复制，仅作为对照
+ */
+static void Benchmark_Naive_Key(uint16_t *dst, const uint16_t *src, uint32_t count, uint16_t key) {
+    for (uint32_t i = 0; i < count; i++) {
+        if (src[i] != key) {
+            dst[i] = src[i];
+        }
+    }
+}
+
+/**
+ * 输出一项图块合成测试的每像素周期数（内部函数）
+ */
+static void Benchmark_Blit_Report(const char *name, uint32_t naive, uint32_t swar) {
+    const uint32_t pixels = (uint32_t)BENCHMARK_BLIT_WIDTH * BENCHMARK_BLIT_HEIGHT * BENCHMARK_BLIT_PASSES;
+    uint32_t naive_centi = (uint32_t)((uint64_t)naive * 100 / pixels);
+    uint32_t swar_centi = (uint32_t)((uint64_t)swar * 100 / pixels);
+    Terminal_Output("$ [Bench] Blit %s: naive %u.%02u cyc/px, swar %u.%02u cyc/px\n",
+                    name, naive_centi / 100, naive_centi % 100, swar_centi / 100, swar_centi % 100);
+    vTaskDelay(50); // 等待终端输出完成
+}
+
+/**
+ * 图块合成每像素周期数：整体透明度混合与色键复制分别对比逐像素的写法，
+ * 另测透明度位图绘制（逐像素，半数像素需要混合）。目标缓冲区从奇数像素开始，包含非对齐的首尾像素
+ */
+void Benchmark_Blit(void) {
+    static uint16_t sprite[BENCHMARK_BLIT_WIDTH * BENCHMARK_BLIT_HEIGHT];
+    static uint8_t alpha[BENCHMARK_BLIT_WIDTH * BENCHMARK_BLIT_HEIGHT];
+    static uint16_t target[BENCHMARK_BLIT_WIDTH * BENCHMARK_BLIT_HEIGHT + 1];
+    const Blit_Image image = { sprite, BENCHMARK_BLIT_WIDTH, BENCHMARK_BLIT_HEIGHT, BENCHMARK_BLIT_WIDTH };
+    const Blit_Mask mask = { alpha, BENCHMARK_BLIT_WIDTH, BENCHMARK_BLIT_HEIGHT, BENCHMARK_BLIT_WIDTH };
+    const Blit_Target dst = { &target[1], 0, 0, BENCHMARK_BLIT_WIDTH, BENCHMARK_BLIT_HEIGHT };
+    const uint16_t key = ST7789_RGB565(255, 0, 255);
+
+    // 渐变图块，每4个像素中有1个色键像素；透明度位图中不透明、透明、半透明约各占三分之一
+    for (uint32_t i = 0; i < BENCHMARK_BLIT_WIDTH * BENCHMARK_BLIT_HEIGHT; i++) {
+        sprite[i] = (i % 4 == 3) ? key : (uint16_t)(i * 0x0841u);
+        alpha[i] = (uint8_t)((i % 3 == 0) ? 255 : (i % 3 == 1) ? 0 : i * 7);
+        target[i] = ST7789_RGB565(0, 0, 128);
+    }
+
+    uint32_t start = Benchmark_Now();
+    for (int pass = 0; pass < BENCHMARK_BLIT_PASSES; pass++) {
+        for (uint32_t row = 0; row < BENCHMARK_BLIT_HEIGHT; row++) {
+            Benchmark_Naive_Blend(&dst.Pixels[row * BENCHMARK_BLIT_WIDTH], &sprite[row * BENCHMARK_BLIT_WIDTH],
+                                  BENCHMARK_BLIT_WIDTH, 16);
+        }
+    }
+    uint32_t naive = Benchmark_Now() - start;
+    start = Benchmark_Now();
+    for (int pass = 0; pass < BENCHMARK_BLIT_PASSES; pass++) {
+        Blit_Blend(&dst, &image, 0, 0, 128);
+    }
+    Benchmark_Blit_Report("blend", naive, Benchmark_Now() - start);
+
+    start = Benchmark_Now();
+    for (int pass = 0; pass < BENCHMARK_BLIT_PASSES; pass++) {
+        for (uint32_t row = 0; row < BENCHMARK_BLIT_HEIGHT; row++) {
+            Benchmark_Naive_Key(&dst.Pixels[row * BENCHMARK_BLIT_WIDTH], &sprite[row * BENCHMARK_BLIT_WIDTH],
+                                BENCHMARK_BLIT_WIDTH, key);
+        }
+    }
+    naive = Benchmark_Now() - start;
+    start = Benchmark_Now();
+    for (int pass = 0; pass < BENCHMARK_BLIT_PASSES; pass++) {
+        Blit_Key(&dst, &image, 0, 0, key);
+    }
+    Benchmark_Blit_Report("key", naive, Benchmark_Now() - start);
+
+    start = Benchmark_Now();
+    for (int pass = 0; pass < BENCHMARK_BLIT_PASSES; pass++) {
+        Blit_Draw_Mask(&dst, &mask, 0, 0, ST7789_RGB565(255, 255, 255));
+    }
+    uint32_t cycles = Benchmark_Now() - start;
+    uint32_t centi = (uint32_t)((uint64_t)cycles * 100 / ((uint32_t)BENCHMARK_BLIT_WIDTH * BENCHMARK_BLIT_HEIGHT * BENCHMARK_BLIT_PASSES));
+    Terminal_Output("$ [Bench] Blit mask: %u.%02u cyc/px\n", centi / 100, centi % 100);
+    vTaskDelay(50);
+}
+
+static TaskHandle_t benchmark_stress_owner = NULL; // 等待生产者结束的任务
+
+/**
+ * 压力测试生产者，每行内容由任务编号和序号唯一确定，便于上位机逐字节校验：
+ *   S<编号> <序号> <填充>\n
+ * 填充为从字母表第<编号>个字母开始的连续字母，长度为 (序号 * 7 + 编号) % 24
+ * @param pvParameters 任务编号
+ */
+static void Benchmark_Stress_Producer(void *pvParameters) {
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZABCDEFGHIJKLMNOPQRSTUVWXYZ";
+    unsigned int id = (unsigned int)pvParameters;
+    char filler[24];
+
+    for (unsigned int seq = 0; seq < BENCHMARK_STRESS_LINES; seq++) {
+        unsigned int len = (seq * 7 + id) % 24;
+        for (unsigned int k = 0; k < len; k++) {
+            filler[k] = alphabet[id + k];
+        }
+        filler[len] = '\0';
+        Terminal_Output("S%u %u %s\n", id, seq, filler);
+        if ((seq & 7) == id) {
+            taskYIELD(); // 打乱各生产者的节奏
+        }
+    }
+    xTaskNotifyGive(benchmark_stress_owner);
+    vTaskDelete(NULL);
+}
+
+/**
+ * Terminal并发压力测试：BENCHMARK_STRESS_PRODUCERS个同优先级任务同时输出，
+ * 测试期间使用阻塞策略，每一行都必须完整到达且没有丢弃，
+ * 结束后输出丢弃统计，由Tools/terminal_stress_check.py逐行检查
+ * @param manager Terminal使用的管理器，用于切换策略与读取丢弃统计
+ * @note 测试期间不能有其他任务直接调用DMA_Buffer_Manager_Input写入不成行的数据
+ */
+void Benchmark_Terminal_Stress(DMA_Buffer_Manager * const manager) {
+    DMA_Buffer_Statistics statistics;
+    UBaseType_t priority = uxTaskPriorityGet(NULL);
+    DMA_Policy_Enum policy;
+    TickType_t timeout;
+
+    DMA_Buffer_Manager_GetPolicy(manager, &policy, &timeout);
+    DMA_Buffer_Manager_SetPolicy(manager, DMA_BLOCK, portMAX_DELAY);
+    DMA_Buffer_Manager_GetStatistics(manager, &statistics, 1);
+    benchmark_stress_owner = xTaskGetCurrentTaskHandle();
+    for (unsigned int id = 0; id < BENCHMARK_STRESS_PRODUCERS; id++) {
+        if (xTaskCreate(Benchmark_Stress_Producer, "Stress", 96, (void *)id, priority, NULL) != pdPASS) {
+            while(1); // 堆空间不足
+        }
+    }
+    for (unsigned int id = 0; id < BENCHMARK_STRESS_PRODUCERS; id++) {
+        ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+    }
+    vTaskDelay(50); // 等待终端输出完成
+    DMA_Buffer_Manager_GetStatistics(manager, &statistics, 1);
+    Terminal_Output("$ [Stress] producers %u lines %u dropped %u\n",
+                    BENCHMARK_STRESS_PRODUCERS, BENCHMARK_STRESS_LINES, statistics.Dropped_Records);
+    DMA_Buffer_Manager_SetPolicy(manager, policy, timeout);
+    vTaskDelay(50);
+}
+
+/**
+ * ST7789全屏填充帧率：交替填充BENCHMARK_ST7789_FRAMES帧不同颜色，
+ * 计时包含设置窗口与等待最后一段数据移出，结果以百分之一帧为单位输出
+ * 需先调用ST7789_Initialize
+ */
+void Benchmark_ST7789_Fill(void) {
+    static const uint16_t colors[4] = {
+        ST7789_RGB565(255, 0, 0), ST7789_RGB565(0, 255, 0), ST7789_RGB565(0, 0, 255), ST7789_RGB565(0, 0, 0)
+    };
+
+    uint32_t start = Benchmark_Now();
+    for (unsigned int frame = 0; frame < BENCHMARK_ST7789_FRAMES; frame++) {
+        ST7789_FillScreen(colors[frame & 3]);
+    }
+    ST7789_Release();
+    uint32_t cycles = Benchmark_Now() - start;
+
+    uint32_t centi_fps = (uint32_t)((uint64_t)BENCHMARK_ST7789_FRAMES * configCPU_CLOCK_HZ * 100 / cycles);
+    Terminal_Output("$ [Bench] ST7789 fill %ux%u (%s): %u.%02u fps, %u cyc/frame\n",
+                    ST7789_WIDTH, ST7789_HEIGHT, ST7789_Parallel() ? "8080" : "spi",
+                    centi_fps / 100, centi_fps % 100, cycles / BENCHMARK_ST7789_FRAMES);
+    vTaskDelay(50);
+}
+
+/**
+ * ST7789全屏像素写入帧率：每帧设置一次全屏窗口，再从同一个行缓冲区逐行写入，
+ * 与填充测试一起对比SPI0与8080并口两种总线（像素来自内存，不能像填充那样重复同一个值）
+ * 需先调用ST7789_Initialize
+ */
+void Benchmark_ST7789_Pixels(void) {
+    static uint16_t line[ST7789_WIDTH];
+
+    for (uint16_t col = 0; col < ST7789_WIDTH; col++) {
+        line[col] = ST7789_RGB565(col, 255 - col, 128);
+    }
+    uint32_t start = Benchmark_Now();
+    for (unsigned int frame = 0; frame < BENCHMARK_ST7789_FRAMES; frame++) {
+        ST7789_SetWindow(0, 0, ST7789_WIDTH - 1, ST7789_HEIGHT - 1);
+        for (uint16_t row = 0; row < ST7789_HEIGHT; row++) {
+            ST7789_Write_Pixels(line, ST7789_WIDTH, 0);
+        }
+    }
+    ST7789_Release();
+    uint32_t cycles = Benchmark_Now() - start;
+
+    uint32_t centi_fps = (uint32_t)((uint64_t)BENCHMARK_ST7789_FRAMES * configCPU_CLOCK_HZ * 100 / cycles);
+    Terminal_Output("$ [Bench] ST7789 pixels %ux%u (%s): %u.%02u fps, %u cyc/frame\n",
+                    ST7789_WIDTH, ST7789_HEIGHT, ST7789_Parallel() ? "8080" : "spi",
+                    centi_fps / 100, centi_fps % 100, cycles / BENCHMARK_ST7789_FRAMES);
+    vTaskDelay(50);
+}
+
+static uint16_t benchmark_box_x;
+static uint16_t benchmark_box_y;
+
+/**
+ * 渲染器测试的画面：纵向渐变背景上的一个方块
+ */
+static void Benchmark_Renderer_Draw(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                                    uint16_t *pixels, void *context) {
+    for (uint16_t row = y; row < y + height; row++) {
+        uint16_t background = ST7789_RGB565(0, 0, row);
+        int in_rows = (row >= benchmark_box_y) && (row < benchmark_box_y + BENCHMARK_RENDERER_BOX);
+        for (uint16_t col = x; col < x + width; col++) {
+            int in_box = in_rows && (col >= benchmark_box_x) && (col < benchmark_box_x + BENCHMARK_RENDERER_BOX);
+            *pixels++ = in_box ? ST7789_RGB565(255, 255, 0) : background;
+        }
+    }
+}
+
+/**
+ * 按帧计时并输出帧率（内部函数）
+ * @param name 测试名称
+ * @param full 非0时每帧重绘整个屏幕，否则只重绘方块移动前后的位置
+ */
+static void Benchmark_Renderer_Run(const char *name, int full) {
+    uint32_t pixels = 0;
+    uint32_t start = Benchmark_Now();
+
+    for (unsigned int frame = 0; frame < BENCHMARK_RENDERER_FRAMES; frame++) {
+        Renderer_Invalidate(benchmark_box_x, benchmark_box_y, BENCHMARK_RENDERER_BOX, BENCHMARK_RENDERER_BOX);
+        benchmark_box_x = (uint16_t)((benchmark_box_x + 3) % (ST7789_WIDTH - BENCHMARK_RENDERER_BOX));
+        benchmark_box_y = (uint16_t)((benchmark_box_y + 2) % (ST7789_HEIGHT - BENCHMARK_RENDERER_BOX));
+        if (full) {
+            Renderer_Invalidate(0, 0, ST7789_WIDTH, ST7789_HEIGHT);
+        } else {
+            Renderer_Invalidate(benchmark_box_x, benchmark_box_y, BENCHMARK_RENDERER_BOX, BENCHMARK_RENDERER_BOX);
+        }
+        pixels += Renderer_Flush();
+    }
+    ST7789_Release();
+    uint32_t cycles = Benchmark_Now() - start;
+
+    uint32_t centi_fps = (uint32_t)((uint64_t)BENCHMARK_RENDERER_FRAMES * configCPU_CLOCK_HZ * 100 / cycles);
+    Terminal_Output("$ [Bench] Renderer %s: %u px/frame, %u.%02u fps\n",
+                    name, pixels / BENCHMARK_RENDERER_FRAMES, centi_fps / 100, centi_fps % 100);
+    vTaskDelay(50);
+}
+
+/**
+ * 双缓冲渲染器帧率：移动方块时只重绘脏矩形，与每帧重绘整屏对比
+ * 需先调用ST7789_Initialize
+ */
+void Benchmark_Renderer(void) {
+    Renderer_Initialize(Benchmark_Renderer_Draw, NULL);
+    Renderer_Flush();
+    Benchmark_Renderer_Run("dirty", 0);
+    Benchmark_Renderer_Run("full", 1);
+}
+
+/**
+ * QOI图片每帧耗时：只解码（逐行写入同一个缓冲区）与解码并显示在屏幕中央，
+ * 两者之差是解码没有被DMA发送掩盖的部分
+ * 需先调用ST7789_Initialize
+ */
+void Benchmark_Image(void) {
+    static Image_QOI decoder;
+    static uint16_t row[ST7789_WIDTH];
+    uint32_t cycles[2];
+
+    for (int draw = 0; draw < 2; draw++) {
+        uint32_t start = Benchmark_Now();
+        for (unsigned int frame = 0; frame < BENCHMARK_IMAGE_FRAMES; frame++) {
+            Image_QOI_Open(&decoder, Image_TestCard, Image_TestCard_Size);
+            if (draw) {
+                Image_QOI_Draw(&decoder, (ST7789_WIDTH - decoder.Width) / 2, (ST7789_HEIGHT - decoder.Height) / 2);
+            } else {
+                for (uint16_t y = 0; y < decoder.Height; y++) {
+                    Image_QOI_Decode_Row(&decoder, row, ST7789_WIDTH);
+                }
+            }
+        }
+        ST7789_Release();
+        cycles[draw] = (Benchmark_Now() - start) / BENCHMARK_IMAGE_FRAMES;
+    }
+
+    uint32_t decode_us = (uint32_t)((uint64_t)cycles[0] * 1000000 / configCPU_CLOCK_HZ);
+    uint32_t draw_us = (uint32_t)((uint64_t)cycles[1] * 1000000 / configCPU_CLOCK_HZ);
+    Terminal_Output("$ [Bench] QOI %ux%u %u B: decode %u.%03u ms, draw %u.%03u ms per frame, %u cyc/px\n",
+                    decoder.Width, decoder.Height, Image_TestCard_Size, decode_us / 1000, decode_us % 1000,
+                    draw_us / 1000, draw_us % 1000, cycles[0] / ((uint32_t)decoder.Width * decoder.Height));
+    vTaskDelay(50);
+}
+
+/**
+ * 曲线图能维持的采样率：两种模式下每次刷新写入1个或8个采样（三角波），
+ * 按刷新耗时折算每秒采样数。结束后恢复整屏为滚动区域、起始行为0
+ * 需先调用ST7789_Initialize
+ */
+void Benchmark_Chart(void) {
+    static Chart chart;
+    static const char * const names[2] = { "sweep", "scroll" };
+    static const uint16_t batches[2] = { 1, 8 };
+
+    for (int mode = 0; mode < 2; mode++) {
+        uint32_t rates[2];
+        // 两种模式使用同一个整行宽的区域，12位ADC的量程
+        Chart_Initialize(&chart, (mode == 0) ? CHART_SWEEP : CHART_SCROLL, 0, 40, ST7789_WIDTH, 160, 0, 4095);
+        Chart_Redraw(&chart);
+        for (int b = 0; b < 2; b++) {
+            uint32_t start = Benchmark_Now();
+            for (uint32_t k = 0; k < BENCHMARK_CHART_SAMPLES; k += batches[b]) {
+                for (uint16_t i = 0; i < batches[b]; i++) {
+                    uint32_t phase = (k + i) % 128;
+                    Chart_Push(&chart, (int16_t)((phase < 64) ? phase * 64 : (128 - phase) * 64));
+                }
+                Chart_Update(&chart);
+            }
+            ST7789_Release();
+            uint32_t cycles = Benchmark_Now() - start;
+            rates[b] = (uint32_t)((uint64_t)BENCHMARK_CHART_SAMPLES * configCPU_CLOCK_HZ / cycles);
+        }
+        Terminal_Output("$ [Bench] Chart %s: %u samples/s at 1 per update, %u samples/s at 8 per update\n",
+                        names[mode], rates[0], rates[1]);
+        vTaskDelay(50);
+    }
+    ST7789_Scroll_Area(0, ST7789_HEIGHT);
+    ST7789_Scroll(0);
+    ST7789_Release();
+}
+
+/**
+ * SPI Flash读取吞吐：按4KB突发顺序读取，结果以KB/s输出；
+ * 再在SPI_FLASH_CACHE_PAGES页范围内随机读取小块数据，对比直接读取与经缓存读取的每次耗时
+ * 需先调用SPI_Flash_Initialize
+ */
+void Benchmark_SPI_Flash(void) {
+    static uint8_t buffer[SPI_FLASH_SECTOR_SIZE];
+    SPI_Flash_Statistics stats;
+    uint32_t size = SPI_Flash_GetInfo()->Size;
+    uint32_t bytes = (BENCHMARK_FLASH_BYTES < size) ? BENCHMARK_FLASH_BYTES : size;
+
+    uint32_t start = Benchmark_Now();
+    for (uint32_t address = 0; address + sizeof(buffer) <= bytes; address += sizeof(buffer)) {
+        SPI_Flash_Read(address, buffer, sizeof(buffer));
+    }
+    uint32_t cycles = Benchmark_Now() - start;
+    Terminal_Output("$ [Bench] Flash sequential %u KB: %u KB/s\n", bytes / 1024,
+                    (uint32_t)((uint64_t)bytes * configCPU_CLOCK_HZ / 1024 / cycles));
+    vTaskDelay(50);
+
+    // 相同的伪随机地址序列，热点范围正好装满缓存，首次访问之后全部命中
+    for (int cached = 0; cached < 2; cached++) {
+        uint32_t seed = 1;
+        SPI_Flash_Invalidate();
+        SPI_Flash_GetStatistics(&stats, 1);
+        start = Benchmark_Now();
+        for (unsigned int i = 0; i < BENCHMARK_FLASH_READS; i++) {
+            seed = seed * 1103515245u + 12345u;
+            uint32_t address = (seed >> 16) % (SPI_FLASH_CACHE_PAGES * SPI_FLASH_PAGE_SIZE - BENCHMARK_FLASH_READ_SIZE);
+            if (cached) {
+                SPI_Flash_Read_Cached(address, buffer, BENCHMARK_FLASH_READ_SIZE);
+            } else {
+                SPI_Flash_Read(address, buffer, BENCHMARK_FLASH_READ_SIZE);
+            }
+        }
+        cycles = Benchmark_Now() - start;
+        SPI_Flash_GetStatistics(&stats, 0);
+        Terminal_Output("$ [Bench] Flash random %uB %s: %u cyc/read, %u hits, %u bus reads\n",
+                        BENCHMARK_FLASH_READ_SIZE, cached ? "cached" : "direct", cycles / BENCHMARK_FLASH_READS,
+                        stats.Cache_Hits, stats.Bus_Reads);
+        vTaskDelay(50);
+    }
+}
+
+/**
+ * 基准测试任务，执行一轮全部测试后删除自身
+ * @param pvParameters Terminal使用的管理器
+ */
+void Benchmark_Task(void *pvParameters) {
+    vTaskDelay(100); // 等待其他任务启动完成
+    Benchmark_Terminal_Format();
+    Benchmark_Blit();
+    Benchmark_Terminal_Stress((DMA_Buffer_Manager *)pvParameters);
+    vTaskDelete(NULL);
+}
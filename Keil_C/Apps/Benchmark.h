@@ -0,0 +1,105 @@
+#ifndef Benchmark_H
+#define Benchmark_H
+
+#include "SC_Init.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "DMA-Buffer-Manager.h"
+
+/**
+ * 置1时在main中创建基准测试任务，结果通过Terminal_Output输出
+ */
+#ifndef BENCHMARK_ENABLE
+#define BENCHMARK_ENABLE 0
+#endif
+
+/**
+ * Terminal并发压力测试的生产者任务数与每个任务输出的行数
+ */
+#ifndef BENCHMARK_STRESS_PRODUCERS
+#define BENCHMARK_STRESS_PRODUCERS 4
+#endif
+#ifndef BENCHMARK_STRESS_LINES
+#define BENCHMARK_STRESS_LINES 200
+#endif
+
+/**
+ * ST7789全屏填充与像素写入测试的帧数
+ */
+#ifndef BENCHMARK_ST7789_FRAMES
+#define BENCHMARK_ST7789_FRAMES 20
+#endif
+
+/**
+ * 渲染器测试的帧数与移动方块的边长
+ */
+#ifndef BENCHMARK_RENDERER_FRAMES
+#define BENCHMARK_RENDERER_FRAMES 60
+#endif
+#ifndef BENCHMARK_RENDERER_BOX
+#define BENCHMARK_RENDERER_BOX 48
+#endif
+
+/**
+ * 图块合成测试的图块尺寸与重复次数
+ */
+#ifndef BENCHMARK_BLIT_WIDTH
+#define BENCHMARK_BLIT_WIDTH 64
+#endif
+#ifndef BENCHMARK_BLIT_HEIGHT
+#define BENCHMARK_BLIT_HEIGHT 32
+#endif
+#ifndef BENCHMARK_BLIT_PASSES
+#define BENCHMARK_BLIT_PASSES 20
+#endif
+
+/**
+ * QOI图片测试的帧数
+ */
+#ifndef BENCHMARK_IMAGE_FRAMES
+#define BENCHMARK_IMAGE_FRAMES 10
+#endif
+
+/**
+ * 曲线图测试的采样数
+ */
+#ifndef BENCHMARK_CHART_SAMPLES
+#define BENCHMARK_CHART_SAMPLES 600
+#endif
+
+/**
+ * SPI Flash顺序读取的字节数（按4KB突发读取），以及随机小块读取的次数与每次的字节数
+ */
+#ifndef BENCHMARK_FLASH_BYTES
+#define BENCHMARK_FLASH_BYTES 65536
+#endif
+#ifndef BENCHMARK_FLASH_READS
+#define BENCHMARK_FLASH_READS 500
+#endif
+#ifndef BENCHMARK_FLASH_READ_SIZE
+#define BENCHMARK_FLASH_READ_SIZE 16
+#endif
+
+uint32_t Benchmark_Now(void);
+
+void Benchmark_Terminal_Format(void);
+
+void Benchmark_Terminal_Stress(DMA_Buffer_Manager * const manager);
+
+void Benchmark_Blit(void);
+
+void Benchmark_ST7789_Fill(void);
+
+void Benchmark_ST7789_Pixels(void);
+
+void Benchmark_Renderer(void);
+
+void Benchmark_Image(void);
+
+void Benchmark_Chart(void);
+
+void Benchmark_SPI_Flash(void);
+
+void Benchmark_Task(void *pvParameters);
+
+#endif //Benchmark_H
@@ -0,0 +1,318 @@
+#include "Blit.h"
+#include <string.h>
+
+#define BLIT_LANES             0x07E0F81Fu     // 低像素的B（0~4位）、R（11~15位）与高像素的G（21~26位）
+#define BLIT_ROR16(V)          (((V) >> 16) | ((V) << 16)) // 交换两个像素，编译为一条ROR
+
+/**
+ * 按32位字访问以uint16_t声明的像素缓冲区，告知GCC（仿真构建）两者可能别名
+ */
+#if defined(__GNUC__)
+typedef uint32_t __attribute__((__may_alias__)) Blit_Word;
+#else
+typedef uint32_t Blit_Word;
+#endif
+
+/**
+ * @struct Blit_Region
+ * @brief 裁剪后的绘制区域（内部类型）
+ */
+typedef struct
+{
+	uint16_t *           Dst;				   // 区域左上角在目标缓冲区中的位置
+	uint16_t             Skip_X;			   // 源图块左边被裁掉的列数
+	uint16_t             Skip_Y;			   // 源图块上边被裁掉的行数
+	uint16_t             Width;				   // 区域宽度
+	uint16_t             Height;			   // 区域高度
+} Blit_Region;
+
+/**
+ * @brief 把矩形裁剪到目标缓冲区内（内部函数）
+ * @return 有需要绘制的像素返回1
+ */
+static uint8_t Blit_Clip(const Blit_Target * T, int16_t X, int16_t Y, uint16_t Width, uint16_t Height, Blit_Region * R)
+{
+	int32_t Left = (X > T->X) ? X : T->X;
+	int32_t Top = (Y > T->Y) ? Y : T->Y;
+	int32_t Right = ((int32_t)X + Width < (int32_t)T->X + T->Width) ? (int32_t)X + Width : (int32_t)T->X + T->Width;
+	int32_t Bottom = ((int32_t)Y + Height < (int32_t)T->Y + T->Height) ? (int32_t)Y + Height : (int32_t)T->Y + T->Height;
+	if (Left >= Right || Top >= Bottom)
+	{
+		return 0;
+	}
+	R->Dst = T->Pixels + (uint32_t)(Top - T->Y) * T->Width + (uint32_t)(Left - T->X);
+	R->Skip_X = (uint16_t)(Left - X);
+	R->Skip_Y = (uint16_t)(Top - Y);
+	R->Width = (uint16_t)(Right - Left);
+	R->Height = (uint16_t)(Bottom - Top);
+	return 1;
+}
+
+/**
+ * @brief 读取两个源像素（内部函数）
+ * @param S 源像素
+ * @param Aligned S按4字节对齐
+ * @return S[0]在低16位，S[1]在高16位
+ */
+static inline uint32_t Blit_Pair(const uint16_t * S, uint8_t Aligned)
+{
+	return Aligned ? *(const Blit_Word *)S : ((uint32_t)S[0] | ((uint32_t)S[1] << 16));
+}
+
+/**
+ * @brief 混合一个字中的两个像素（内部函数）
+ * @param F 源像素对
+ * @param B 目标像素对
+ * @param A 透明度0~32
+ * @note (F * A + B * (32 - A))写成(B << 5) + (F - B) * A：分量差为负时借位会穿过空位，
+ *       但总和非负且不超过32位，模2^32的结果与分开计算完全相同，每个字只需一次乘法
+ */
+static inline uint32_t Blit_Blend_Pair(uint32_t F, uint32_t B, uint32_t A)
+{
+	uint32_t F_Low = F & BLIT_LANES;
+	uint32_t B_Low = B & BLIT_LANES;
+	uint32_t F_High = BLIT_ROR16(F) & BLIT_LANES;
+	uint32_t B_High = BLIT_ROR16(B) & BLIT_LANES;
+	uint32_t Low = (((B_Low << 5) + (F_Low - B_Low) * A) >> 5) & BLIT_LANES;
+	uint32_t High = (((B_High << 5) + (F_High - B_High) * A) >> 5) & BLIT_LANES;
+	return Low | BLIT_ROR16(High);
+}
+
+/**
+ * @brief 混合一个像素（内部函数）
+ * @param F 展开后的源像素（(C | C << 16) & BLIT_LANES）
+ * @param B 目标像素
+ * @param A 透明度0~32
+ */
+static inline uint16_t Blit_Blend_Pixel(uint32_t F, uint16_t B, uint32_t A)
+{
+	uint32_t B_Lanes = (B | ((uint32_t)B << 16)) & BLIT_LANES;
+	uint32_t R = (((B_Lanes << 5) + (F - B_Lanes) * A) >> 5) & BLIT_LANES;
+	return (uint16_t)(R | (R >> 16));
+}
+
+/**
+ * @brief 填充一行（内部函数）
+ */
+static void Blit_Row_Fill(uint16_t * D, uint32_t Count, uint16_t Color)
+{
+	if (Count != 0 && ((uintptr_t)D & 2) != 0)
+	{
+		*D++ = Color;
+		Count--;
+	}
+	uint32_t Pair = Color | ((uint32_t)Color << 16);
+	Blit_Word * W = (Blit_Word *)D;
+	for (; Count >= 2; Count -= 2)
+	{
+		*W++ = Pair;
+	}
+	if (Count != 0)
+	{
+		*(uint16_t *)W = Color;
+	}
+}
+
+/**
+ * @brief 复制一行并跳过色键像素（内部函数）
+ * @note 两个像素都不是色键时整字写入，都是时跳过，否则分别写入
+ */
+static void Blit_Row_Key(uint16_t * D, const uint16_t * S, uint32_t Count, uint16_t Key)
+{
+	if (Count != 0 && ((uintptr_t)D & 2) != 0)
+	{
+		if (*S != Key)
+		{
+			*D = *S;
+		}
+		D++;
+		S++;
+		Count--;
+	}
+	uint32_t Keys = Key | ((uint32_t)Key << 16);
+	uint8_t Aligned = ((uintptr_t)S & 2) == 0;
+	Blit_Word * W = (Blit_Word *)D;
+	for (; Count >= 2; Count -= 2, S += 2, W++)
+	{
+		uint32_t Pair = Blit_Pair(S, Aligned);
+		uint32_t Diff = Pair ^ Keys;
+		if ((Diff & 0xFFFF) != 0 && (Diff >> 16) != 0)
+		{
+			*W = Pair;
+		}
+		else if (Diff != 0)
+		{
+			uint16_t * H = (uint16_t *)W;
+			if ((Diff & 0xFFFF) != 0)
+			{
+				H[0] = (uint16_t)Pair;
+			}
+			else
+			{
+				H[1] = (uint16_t)(Pair >> 16);
+			}
+		}
+	}
+	if (Count != 0 && *S != Key)
+	{
+		*(uint16_t *)W = *S;
+	}
+}
+
+/**
+ * @brief 以整体透明度混合一行（内部函数）
+ * @param A 透明度1~31
+ */
+static void Blit_Row_Blend(uint16_t * D, const uint16_t * S, uint32_t Count, uint32_t A)
+{
+	if (Count != 0 && ((uintptr_t)D & 2) != 0)
+	{
+		*D = Blit_Blend_Pixel((*S | ((uint32_t)*S << 16)) & BLIT_LANES, *D, A);
+		D++;
+		S++;
+		Count--;
+	}
+	uint8_t Aligned = ((uintptr_t)S & 2) == 0;
+	Blit_Word * W = (Blit_Word *)D;
+	for (; Count >= 2; Count -= 2, S += 2, W++)
+	{
+		*W = Blit_Blend_Pair(Blit_Pair(S, Aligned), *W, A);
+	}
+	if (Count != 0)
+	{
+		uint16_t * H = (uint16_t *)W;
+		*H = Blit_Blend_Pixel((*S | ((uint32_t)*S << 16)) & BLIT_LANES, *H, A);
+	}
+}
+
+/**
+ * @brief 填充矩形实现
+ * @param T 目标缓冲区
+ * @param X 左上角列
+ * @param Y 左上角行
+ * @param Width 宽度
+ * @param Height 高度
+ * @param Color RGB565颜色
+ */
+void Blit_Fill(const Blit_Target * T, int16_t X, int16_t Y, uint16_t Width, uint16_t Height, uint16_t Color)
+{
+	Blit_Region R;
+	if (!Blit_Clip(T, X, Y, Width, Height, &R))
+	{
+		return;
+	}
+	for (uint16_t Row = 0; Row < R.Height; Row++, R.Dst += T->Width)
+	{
+		Blit_Row_Fill(R.Dst, R.Width, Color);
+	}
+}
+
+/**
+ * @brief 复制图块实现
+ * @param T 目标缓冲区
+ * @param S 源图块
+ * @param X 左上角列
+ * @param Y 左上角行
+ */
+void Blit_Copy(const Blit_Target * T, const Blit_Image * S, int16_t X, int16_t Y)
+{
+	Blit_Region R;
+	if (!Blit_Clip(T, X, Y, S->Width, S->Height, &R))
+	{
+		return;
+	}
+	const uint16_t * Src = S->Pixels + (uint32_t)R.Skip_Y * S->Stride + R.Skip_X;
+	for (uint16_t Row = 0; Row < R.Height; Row++, R.Dst += T->Width, Src += S->Stride)
+	{
+		memcpy(R.Dst, Src, (uint32_t)R.Width * 2);
+	}
+}
+
+/**
+ * @brief 色键复制实现
+ * @param T 目标缓冲区
+ * @param S 源图块
+ * @param X 左上角列
+ * @param Y 左上角行
+ * @param Key 视为透明的颜色
+ */
+void Blit_Key(const Blit_Target * T, const Blit_Image * S, int16_t X, int16_t Y, uint16_t Key)
+{
+	Blit_Region R;
+	if (!Blit_Clip(T, X, Y, S->Width, S->Height, &R))
+	{
+		return;
+	}
+	const uint16_t * Src = S->Pixels + (uint32_t)R.Skip_Y * S->Stride + R.Skip_X;
+	for (uint16_t Row = 0; Row < R.Height; Row++, R.Dst += T->Width, Src += S->Stride)
+	{
+		Blit_Row_Key(R.Dst, Src, R.Width, Key);
+	}
+}
+
+/**
+ * @brief 整体透明度混合实现
+ * @param T 目标缓冲区
+ * @param S 源图块
+ * @param X 左上角列
+ * @param Y 左上角行
+ * @param Alpha 透明度0~255
+ */
+void Blit_Blend(const Blit_Target * T, const Blit_Image * S, int16_t X, int16_t Y, uint8_t Alpha)
+{
+	uint32_t A = ((uint32_t)Alpha + 4) >> 3;
+	if (A == 0)
+	{
+		return;
+	}
+	if (A == 32)
+	{
+		Blit_Copy(T, S, X, Y);
+		return;
+	}
+	Blit_Region R;
+	if (!Blit_Clip(T, X, Y, S->Width, S->Height, &R))
+	{
+		return;
+	}
+	const uint16_t * Src = S->Pixels + (uint32_t)R.Skip_Y * S->Stride + R.Skip_X;
+	for (uint16_t Row = 0; Row < R.Height; Row++, R.Dst += T->Width, Src += S->Stride)
+	{
+		Blit_Row_Blend(R.Dst, Src, R.Width, A);
+	}
+}
+
+/**
+ * @brief 透明度位图绘制实现
+ * @param T 目标缓冲区
+ * @param M 透明度位图
+ * @param X 左上角列
+ * @param Y 左上角行
+ * @param Color RGB565颜色
+ */
+void Blit_Draw_Mask(const Blit_Target * T, const Blit_Mask * M, int16_t X, int16_t Y, uint16_t Color)
+{
+	Blit_Region R;
+	if (!Blit_Clip(T, X, Y, M->Width, M->Height, &R))
+	{
+		return;
+	}
+	uint32_t Lanes = (Color | ((uint32_t)Color << 16)) & BLIT_LANES;
+	const uint8_t * Src = M->Alpha + (uint32_t)R.Skip_Y * M->Stride + R.Skip_X;
+	for (uint16_t Row = 0; Row < R.Height; Row++, R.Dst += T->Width, Src += M->Stride)
+	{
+		for (uint16_t Col = 0; Col < R.Width; Col++)
+		{
+			uint32_t A = ((uint32_t)Src[Col] + 4) >> 3;
+			// 图标与字形大部分像素完全透明或完全不透明，不需要乘法
+			if (A == 32)
+			{
+				R.Dst[Col] = Color;
+			}
+			else if (A != 0)
+			{
+				R.Dst[Col] = Blit_Blend_Pixel(Lanes, R.Dst[Col], A);
+			}
+		}
+	}
+}
@@ -0,0 +1,107 @@
+/**
+ * @file Blit.h
+ * @brief RGB565图块合成模块头文件
+ * @note 把图标、精灵等小图块画进行带或图块缓冲区（例如Renderer的绘制回调收到的缓冲区），
+ *       再由ST7789_Write_Pixels用DMA发往屏幕。坐标都是屏幕坐标，超出缓冲区的部分被裁剪。
+ *       复制、色键与整体透明度混合每次处理32位字中的两个像素：
+ *       字 & 0x07E0F81F 取出低像素的R、B与高像素的G，循环右移16位后取出另外三个分量，
+ *       每个分量上方都留有空位，两个像素的混合只需4次乘法
+ */
+
+#ifndef BLIT_H
+#define BLIT_H
+
+#include "ST7789.h"
+
+/**
+ * @struct Blit_Image
+ * @brief 源图块
+ */
+typedef struct
+{
+    const uint16_t *     Pixels;			   // RGB565像素，按行排列、本机字节序
+    uint16_t             Width;				   // 宽度
+    uint16_t             Height;			   // 高度
+    uint16_t             Stride;			   // 行跨度（像素数），不小于Width
+} Blit_Image;
+
+/**
+ * @struct Blit_Mask
+ * @brief 透明度位图，用指定颜色绘制（抗锯齿图标、字形）
+ */
+typedef struct
+{
+    const uint8_t *      Alpha;				   // 每像素透明度，0为透明，255为不透明
+    uint16_t             Width;				   // 宽度
+    uint16_t             Height;			   // 高度
+    uint16_t             Stride;			   // 行跨度（字节数），不小于Width
+} Blit_Mask;
+
+/**
+ * @struct Blit_Target
+ * @brief 目标缓冲区
+ * @note 参数与Renderer_Draw一致：{ Pixels, X, Y, Width, Height }
+ */
+typedef struct
+{
+    uint16_t *           Pixels;			   // RGB565像素，按行排列，行跨度为Width
+    uint16_t             X;					   // 缓冲区左上角在屏幕上的列
+    uint16_t             Y;					   // 缓冲区左上角在屏幕上的行
+    uint16_t             Width;				   // 宽度
+    uint16_t             Height;			   // 高度
+} Blit_Target;
+
+/**
+ * @brief 填充矩形
+ * @param T 目标缓冲区
+ * @param X 左上角列（屏幕坐标，可为负）
+ * @param Y 左上角行
+ * @param Width 宽度
+ * @param Height 高度
+ * @param Color RGB565颜色
+ */
+void Blit_Fill(const Blit_Target * T, int16_t X, int16_t Y, uint16_t Width, uint16_t Height, uint16_t Color);
+
+/**
+ * @brief 复制图块
+ * @param T 目标缓冲区
+ * @param S 源图块
+ * @param X 左上角列（屏幕坐标，可为负）
+ * @param Y 左上角行
+ */
+void Blit_Copy(const Blit_Target * T, const Blit_Image * S, int16_t X, int16_t Y);
+
+/**
+ * @brief 复制图块，跳过色键像素
+ * @param T 目标缓冲区
+ * @param S 源图块
+ * @param X 左上角列（屏幕坐标，可为负）
+ * @param Y 左上角行
+ * @param Key 视为透明的颜色
+ */
+void Blit_Key(const Blit_Target * T, const Blit_Image * S, int16_t X, int16_t Y, uint16_t Key);
+
+/**
+ * @brief 以整体透明度把图块混合到目标上
+ * @param T 目标缓冲区
+ * @param S 源图块
+ * @param X 左上角列（屏幕坐标，可为负）
+ * @param Y 左上角行
+ * @param Alpha 透明度，0为不绘制，255为直接复制
+ * @note 混合精度为1/32：结果 = (源 * a + 目标 * (32 - a)) / 32，a = (Alpha + 4) / 8
+ */
+void Blit_Blend(const Blit_Target * T, const Blit_Image * S, int16_t X, int16_t Y, uint8_t Alpha);
+
+/**
+ * @brief 按透明度位图用指定颜色绘制
+ * @param T 目标缓冲区
+ * @param M 透明度位图
+ * @param X 左上角列（屏幕坐标，可为负）
+ * @param Y 左上角行
+ * @param Color RGB565颜色
+ * @note 每个像素的透明度不同，每次处理一个像素（分量同样展开到32位字中，只需2次乘法）；
+ *       混合精度与Blit_Blend相同
+ */
+void Blit_Draw_Mask(const Blit_Target * T, const Blit_Mask * M, int16_t X, int16_t Y, uint16_t Color);
+
+#endif // BLIT_H
@@ -0,0 +1,222 @@
+#include "Chart.h"
+
+#if ((CHART_SAMPLES & (CHART_SAMPLES - 1)) != 0)
+#error "CHART_SAMPLES must be a power of two"
+#endif
+
+static uint16_t Chart_Buffer[2][CHART_BUFFER_PIXELS];  // 交替发送的行带缓冲区
+static uint8_t Chart_Next;                             // 下一个用于绘制的缓冲区
+
+/**
+ * @brief 初始化曲线图实现
+ * @param C 曲线图
+ * @param Mode CHART_SWEEP或CHART_SCROLL
+ * @param X 区域左上角列
+ * @param Y 区域左上角行
+ * @param Width 区域宽度
+ * @param Height 区域高度
+ * @param Min 值轴下限
+ * @param Max 值轴上限
+ */
+void Chart_Initialize(Chart * C, uint8_t Mode, uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height,
+					  int16_t Min, int16_t Max)
+{
+	C->X = X;
+	C->Y = Y;
+	C->Width = Width;
+	C->Height = Height;
+	C->Mode = Mode;
+	C->Min = Min;
+	C->Max = Max;
+	C->Length = (Mode == CHART_SCROLL) ? Height : Width;
+	C->Span = (Mode == CHART_SCROLL) ? Width : Height;
+	if (Max <= Min || Width == 0 || Height == 0 || X + Width > ST7789_WIDTH || Y + Height > ST7789_HEIGHT ||
+		(Mode == CHART_SCROLL && (X != 0 || Width != ST7789_WIDTH)) ||
+		(Mode == CHART_SWEEP && C->Length <= CHART_SWEEP_GAP) ||
+		C->Length > CHART_SAMPLES || C->Span > CHART_BUFFER_PIXELS)
+	{
+		while(1); // 区域超出屏幕、滚动区域不是整行，或超出环形缓冲区与行带缓冲区的容量
+	}
+	// 向上取整，上限恰好落在最后一个像素上（超出部分在Chart_Position中截断）
+	C->Scale = (((uint32_t)(C->Span - 1) << 16) + (uint32_t)(Max - Min) - 1) / (uint32_t)(Max - Min);
+	C->Trace = CHART_TRACE;
+	C->Background = CHART_BACKGROUND;
+	C->Grid_Color = CHART_GRID_COLOR;
+	C->Grid = CHART_GRID;
+	C->Head = 0;
+	C->Tail = 0;
+	C->Cursor = 0;
+	C->Count = 0;
+}
+
+/**
+ * @brief 写入一个采样实现
+ * @param C 曲线图
+ * @param Value 采样值
+ */
+void Chart_Push(Chart * C, int16_t Value)
+{
+	uint32_t Head = C->Head;
+	C->Samples[Head & (CHART_SAMPLES - 1)] = Value;
+	// 两者都是volatile，采样一定先于计数写入，Chart_Update读到计数时采样已经有效
+	C->Head = Head + 1;
+}
+
+/**
+ * @brief 采样值对应的值轴像素（内部函数）
+ */
+static uint16_t Chart_Position(const Chart * C, int16_t Value)
+{
+	if (Value <= C->Min)
+	{
+		return 0;
+	}
+	if (Value >= C->Max)
+	{
+		return C->Span - 1;
+	}
+	uint32_t Position = ((uint32_t)(Value - C->Min) * C->Scale) >> 16;
+	return (Position < C->Span) ? (uint16_t)Position : C->Span - 1;
+}
+
+/**
+ * @brief 生成时间轴上一个位置的像素（内部函数）
+ * @param Position 时间轴位置
+ * @param Out 值轴下限处的像素
+ * @param Step 值轴前进一个像素时Out的增量（可为负）
+ * @note 显示的是该位置上最新的采样，与前一个采样之间连成竖线；
+ *       没有采样的位置与CHART_SWEEP光标前方的空白只有背景与网格
+ */
+static void Chart_Line(const Chart * C, uint16_t Position, uint16_t * Out, int32_t Step)
+{
+	uint32_t Visible = (C->Mode == CHART_SWEEP) ? C->Length - CHART_SWEEP_GAP : C->Length;
+	uint32_t Age = ((uint32_t)C->Cursor + C->Length - 1 - Position) % C->Length; // 0为最新的采样
+
+	for (uint16_t i = 0; i < C->Span; i++)
+	{
+		Out[i * Step] = C->Background;
+	}
+	if (C->Grid != 0)
+	{
+		for (uint16_t i = 0; i < C->Span; i += C->Grid)
+		{
+			Out[i * Step] = C->Grid_Color;
+		}
+	}
+	if (Age >= Visible || Age >= C->Count)
+	{
+		return;
+	}
+	uint32_t Index = C->Tail - 1 - Age;
+	uint16_t Low = Chart_Position(C, C->Samples[Index & (CHART_SAMPLES - 1)]);
+	uint16_t High = Low;
+	if (Age + 1 < C->Count)
+	{
+		uint16_t Previous = Chart_Position(C, C->Samples[(Index - 1) & (CHART_SAMPLES - 1)]);
+		if (Previous < Low)
+		{
+			Low = Previous;
+		}
+		else
+		{
+			High = Previous;
+		}
+	}
+	for (uint16_t i = Low; i <= High; i++)
+	{
+		Out[i * Step] = C->Trace;
+	}
+}
+
+/**
+ * @brief 绘制时间轴上连续的位置（内部函数）
+ * @param First 第一个位置
+ * @param Count 位置数，超过时间轴末尾时回到开头
+ * @note 每个行带一个窗口：CHART_SCROLL的位置是整行，按行排列；
+ *       CHART_SWEEP的位置是整列，窗口内仍按行写入，值轴从下向上
+ */
+static void Chart_Draw(const Chart * C, uint16_t First, uint16_t Count)
+{
+	uint16_t Band = CHART_BUFFER_PIXELS / C->Span;
+	while (Count != 0)
+	{
+		uint16_t Lines = (Count < Band) ? Count : Band;
+		if (Lines > C->Length - First)
+		{
+			Lines = C->Length - First;
+		}
+		uint16_t * Buffer = Chart_Buffer[Chart_Next];
+		// 只允许另一个缓冲区仍在发送，这一个必须已被DMA读完
+		ST7789_Wait_Pixels(1);
+		for (uint16_t j = 0; j < Lines; j++)
+		{
+			if (C->Mode == CHART_SCROLL)
+			{
+				Chart_Line(C, First + j, &Buffer[(uint32_t)j * C->Span], 1);
+			}
+			else
+			{
+				Chart_Line(C, First + j, &Buffer[(uint32_t)(C->Span - 1) * Lines + j], -(int32_t)Lines);
+			}
+		}
+		if (C->Mode == CHART_SCROLL)
+		{
+			ST7789_SetWindow(C->X, C->Y + First, C->X + C->Width - 1, C->Y + First + Lines - 1);
+		}
+		else
+		{
+			ST7789_SetWindow(C->X + First, C->Y, C->X + First + Lines - 1, C->Y + C->Height - 1);
+		}
+		ST7789_Write_Pixels(Buffer, (uint32_t)Lines * C->Span, 1);
+		Chart_Next ^= 1;
+		First = (First + Lines == C->Length) ? 0 : First + Lines;
+		Count -= Lines;
+	}
+}
+
+/**
+ * @brief 绘制新采样实现
+ * @param C 曲线图
+ * @return 新采样数
+ */
+uint16_t Chart_Update(Chart * C)
+{
+	uint32_t Head = C->Head;
+	uint32_t New = Head - C->Tail;
+	if (New == 0)
+	{
+		return 0;
+	}
+	uint32_t Visible = (C->Mode == CHART_SWEEP) ? C->Length - CHART_SWEEP_GAP : C->Length;
+	uint16_t Draw = (New < Visible) ? (uint16_t)New : (uint16_t)Visible;
+
+	C->Tail = Head;
+	C->Cursor = (uint16_t)((C->Cursor + New % C->Length) % C->Length);
+	C->Count = (C->Count + New < CHART_SAMPLES) ? (uint16_t)(C->Count + New) : CHART_SAMPLES;
+	// 新采样之前的位置不变；CHART_SWEEP同时清除光标前方的空白
+	Chart_Draw(C, (uint16_t)((C->Cursor + C->Length - Draw) % C->Length),
+			   (C->Mode == CHART_SWEEP) ? Draw + CHART_SWEEP_GAP : Draw);
+	if (C->Mode == CHART_SCROLL)
+	{
+		// 最旧的一行在Cursor处，作为滚动区域的第一行显示，最新的一行在底部
+		ST7789_Scroll(C->Y + C->Cursor);
+	}
+	return (New < 0xFFFF) ? (uint16_t)New : 0xFFFF;
+}
+
+/**
+ * @brief 重绘实现
+ * @param C 曲线图
+ */
+void Chart_Redraw(Chart * C)
+{
+	if (C->Mode == CHART_SCROLL)
+	{
+		ST7789_Scroll_Area(C->Y, C->Height);
+	}
+	Chart_Draw(C, 0, C->Length);
+	if (C->Mode == CHART_SCROLL)
+	{
+		ST7789_Scroll(C->Y + C->Cursor);
+	}
+}
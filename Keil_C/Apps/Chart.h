@@ -0,0 +1,126 @@
+/**
+ * @file Chart.h
+ * @brief 滚动曲线图模块头文件
+ * @note 实时显示ADC等采样值。采样写入环形缓冲区，刷新时只绘制新采样对应的列（或行），
+ *       不重绘整个图表：
+ *       CHART_SWEEP  时间轴水平，光标从左向右扫过区域，新采样写在光标处，光标前方留出
+ *                    几列空白作为分界，每次只设置一个窄窗口；区域可以在屏幕任意位置
+ *       CHART_SCROLL 时间轴垂直，最新的采样在区域底部，整个区域用VSCRSADD硬件滚动，
+ *                    每次只写入新的几行；区域必须占满屏幕宽度，且与Console共用唯一的滚动区域
+ */
+
+#ifndef CHART_H
+#define CHART_H
+
+#include "ST7789.h"
+
+/**
+ * 环形缓冲区保存的采样数，必须是2的幂且不小于时间轴长度
+ */
+#ifndef CHART_SAMPLES
+#define CHART_SAMPLES          256
+#endif
+
+/**
+ * 每个行带缓冲区的像素数（两个缓冲区共占4倍字节），不能小于值轴长度
+ */
+#ifndef CHART_BUFFER_PIXELS
+#define CHART_BUFFER_PIXELS    (ST7789_WIDTH * 2)
+#endif
+
+/**
+ * CHART_SWEEP模式中光标前方的空白列数
+ */
+#ifndef CHART_SWEEP_GAP
+#define CHART_SWEEP_GAP        4
+#endif
+
+/**
+ * 默认颜色（RGB565）与网格间距（像素，0为不画网格）
+ */
+#ifndef CHART_TRACE
+#define CHART_TRACE            ST7789_RGB565(0, 255, 0)
+#endif
+#ifndef CHART_BACKGROUND
+#define CHART_BACKGROUND       ST7789_RGB565(0, 0, 0)
+#endif
+#ifndef CHART_GRID_COLOR
+#define CHART_GRID_COLOR       ST7789_RGB565(0, 64, 0)
+#endif
+#ifndef CHART_GRID
+#define CHART_GRID             20
+#endif
+
+#define CHART_SWEEP            0               // 光标扫描，时间轴水平
+#define CHART_SCROLL           1               // 硬件滚动，时间轴垂直
+
+/**
+ * @struct Chart
+ * @brief 曲线图
+ * @note 颜色与网格字段可在Chart_Initialize之后修改，下一次Chart_Redraw生效
+ */
+typedef struct
+{
+    uint16_t             X;					   // 区域左上角列
+    uint16_t             Y;					   // 区域左上角行
+    uint16_t             Width;				   // 区域宽度
+    uint16_t             Height;			   // 区域高度
+    uint8_t              Mode;				   // CHART_SWEEP或CHART_SCROLL
+    int16_t              Min;				   // 值轴下限（更小的采样画在下限处）
+    int16_t              Max;				   // 值轴上限
+    uint32_t             Scale;				   // 采样到值轴像素的比例（16位小数）
+    uint16_t             Length;			   // 时间轴长度（CHART_SWEEP为宽度，CHART_SCROLL为高度）
+    uint16_t             Span;				   // 值轴长度
+    uint16_t             Trace;				   // 曲线颜色
+    uint16_t             Background;		   // 背景颜色
+    uint16_t             Grid_Color;		   // 网格颜色
+    uint16_t             Grid;				   // 网格间距，0为不画网格
+    volatile int16_t     Samples[CHART_SAMPLES]; // 采样环形缓冲区
+    volatile uint32_t    Head;				   // 已写入的采样总数（回绕）
+    uint32_t             Tail;				   // 已绘制的采样总数（回绕）
+    uint16_t             Cursor;			   // 下一个采样在时间轴上的位置
+    uint16_t             Count;				   // 环形缓冲区中已绘制的采样数，最多CHART_SAMPLES
+} Chart;
+
+/**
+ * @brief 初始化曲线图
+ * @param C 曲线图
+ * @param Mode CHART_SWEEP或CHART_SCROLL
+ * @param X 区域左上角列（CHART_SCROLL须为0）
+ * @param Y 区域左上角行
+ * @param Width 区域宽度（CHART_SCROLL须为ST7789_WIDTH）
+ * @param Height 区域高度
+ * @param Min 值轴下限
+ * @param Max 值轴上限，须大于Min
+ * @note 只设置参数并清空采样，不访问屏幕
+ */
+void Chart_Initialize(Chart * C, uint8_t Mode, uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height,
+					  int16_t Min, int16_t Max);
+
+/**
+ * @brief 写入一个采样
+ * @param C 曲线图
+ * @param Value 采样值，超出值轴范围时画在边缘
+ * @note 不加锁，可在一个任务或中断服务函数中调用（只允许一个写入者）；
+ *       两次刷新之间的采样超过时间轴长度时，只显示最新的部分
+ */
+void Chart_Push(Chart * C, int16_t Value);
+
+/**
+ * @brief 绘制上一次刷新以来的新采样
+ * @param C 曲线图
+ * @return 新采样数
+ * @note 新采样对应的列（行）合并成尽量少的窗口，按行带双缓冲发送；
+ *       CHART_SCROLL模式最后发送一次VSCRSADD。返回时最后一个行带可能仍在发送，
+ *       片选保持到ST7789_Release；需先调用Chart_Redraw，各曲线图共用行带缓冲区，不可重入
+ */
+uint16_t Chart_Update(Chart * C);
+
+/**
+ * @brief 按环形缓冲区中的采样重绘整个图表
+ * @param C 曲线图
+ * @note 第一次绘制，或图表区域被其他内容覆盖后调用；CHART_SCROLL模式同时设置滚动区域
+ */
+void Chart_Redraw(Chart * C);
+
+#endif // CHART_H
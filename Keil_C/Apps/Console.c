@@ -0,0 +1,169 @@
+#include "Console.h"
+
+static StreamBufferHandle_t Console_Stream;			  // 镜像的文本，输出任务写入、控制台任务读取
+static volatile uint32_t Console_Dropped;			  // 流缓冲区已满而丢弃的字节数
+static char Console_Text[CONSOLE_COLUMNS + 1];		  // 当前行的文字
+static uint8_t Console_Length;						  // 当前行的字符数
+static uint16_t Console_Width;						  // 当前行文字的宽度
+static uint8_t Console_Dirty;						  // 当前行有尚未绘制的文字
+static uint16_t Console_Line_Height;				  // 行高
+static uint16_t Console_Rows;						  // 滚动区域的行数（屏幕能完整显示的行数）
+static uint16_t Console_Row;						  // 当前行在滚动区域中的位置
+static uint16_t Console_Used;						  // 已使用的行数，满屏后开始滚动
+
+/**
+ * @brief Terminal的镜像回调（内部函数）
+ * @param Span 记录所在的区域
+ * @param Length 记录长度
+ * @note 流缓冲区只允许一个写入者，多个任务的输出在挂起调度器期间写入，且不等待；
+ *       不使用临界区：拷贝期间不屏蔽中断（DMA中断照常响应），流缓冲区的发送函数也不允许在临界区中调用。
+ *       空间不足时整条丢弃，控制台上不会出现半条记录
+ */
+static void Console_Mirror(const DMA_Buffer_Span * Span, int Length)
+{
+	size_t First = ((uint32_t)Length < Span->Length[0]) ? (size_t)Length : Span->Length[0];
+	vTaskSuspendAll();
+	if (xStreamBufferSpacesAvailable(Console_Stream) >= (size_t)Length)
+	{
+		xStreamBufferSend(Console_Stream, Span->Pointer[0], First, 0);
+		if ((size_t)Length > First)
+		{
+			xStreamBufferSend(Console_Stream, Span->Pointer[1], (size_t)Length - First, 0);
+		}
+	}
+	else
+	{
+		Console_Dropped += (uint32_t)Length;
+	}
+	xTaskResumeAll();
+}
+
+/**
+ * @brief 初始化控制台实现
+ */
+void Console_Initialize(void)
+{
+	Console_Stream = xStreamBufferCreate(CONSOLE_STREAM_SIZE, 1);
+	if (Console_Stream == NULL)
+	{
+		while(1); // 堆空间不足
+	}
+	Terminal_SetMirror(Console_Mirror);
+}
+
+/**
+ * @brief 绘制当前行（内部函数）
+ * @note 文字框右边的背景在换行清除该行时已写好，只需绘制文字部分
+ */
+static void Console_Draw_Line(void)
+{
+	Font_Draw_String(&CONSOLE_FONT, 0, Console_Row * Console_Line_Height, Console_Text,
+					 CONSOLE_FOREGROUND, CONSOLE_BACKGROUND);
+	Console_Dirty = 0;
+}
+
+/**
+ * @brief 换到下一行（内部函数）
+ * @note 满屏前依次使用屏幕上的行；满屏后重用最上面（最旧）的一行：清除后把滚动起始行
+ *       设为它的下一行，它就显示在屏幕底部，其余各行整体上移，不需要重写显存
+ */
+static void Console_New_Line(void)
+{
+	if (Console_Dirty)
+	{
+		Console_Draw_Line();
+	}
+	Console_Length = 0;
+	Console_Width = 0;
+	Console_Text[0] = '\0';
+	if (Console_Used < Console_Rows)
+	{
+		Console_Row = Console_Used++;
+		return;
+	}
+	Console_Row = (Console_Row + 1 == Console_Rows) ? 0 : Console_Row + 1;
+	ST7789_FillRect(0, Console_Row * Console_Line_Height, ST7789_WIDTH, Console_Line_Height, CONSOLE_BACKGROUND);
+	ST7789_Scroll((Console_Row + 1 == Console_Rows) ? 0 : (Console_Row + 1) * Console_Line_Height);
+}
+
+/**
+ * @brief 向当前行添加一个字符（内部函数）
+ * @param C 字符
+ */
+static void Console_Put(char C)
+{
+	char Single[2] = { C, '\0' };
+	if (C == '\r')
+	{
+		return;
+	}
+	if (C == '\n')
+	{
+		Console_New_Line();
+		return;
+	}
+	if (C == '\t')
+	{
+		Single[0] = C = ' ';
+	}
+	uint16_t Advance = Font_Measure(&CONSOLE_FONT, Single);
+	if (Console_Width + Advance > ST7789_WIDTH || Console_Length == CONSOLE_COLUMNS)
+	{
+		Console_New_Line();
+	}
+	Console_Text[Console_Length++] = C;
+	Console_Text[Console_Length] = '\0';
+	Console_Width += Advance;
+	Console_Dirty = 1;
+}
+
+/**
+ * @brief 控制台任务实现
+ * @param pvParameters SPI0的传输管理
+ */
+void Console_Task(void * pvParameters)
+{
+	uint8_t Chunk[32];
+
+	Console_Line_Height = CONSOLE_FONT.Height;
+	Console_Rows = ST7789_HEIGHT / Console_Line_Height;
+	if (Console_Stream == NULL || Console_Rows == 0)
+	{
+		while(1); // 需先调用Console_Initialize，字库行高不能超过屏幕高度
+	}
+	Console_Row = 0;
+	Console_Used = 1;
+
+	ST7789_Initialize((SPI_Chunk_Buffer *)pvParameters);
+	ST7789_FillScreen(CONSOLE_BACKGROUND);
+	// 滚动区域取整数个文字行，屏幕底部不足一行的部分固定显示背景
+	ST7789_Scroll_Area(0, Console_Rows * Console_Line_Height);
+	ST7789_Scroll(0);
+	ST7789_Release();
+
+	for (;;)
+	{
+		size_t Count = xStreamBufferReceive(Console_Stream, Chunk, sizeof(Chunk), portMAX_DELAY);
+		for (size_t i = 0; i < Count; i++)
+		{
+			Console_Put((char)Chunk[i]);
+		}
+		// 暂时没有更多文字时显示未结束的行，并释放片选让总线上的其他设备使用
+		if (xStreamBufferIsEmpty(Console_Stream))
+		{
+			if (Console_Dirty)
+			{
+				Console_Draw_Line();
+			}
+			ST7789_Release();
+		}
+	}
+}
+
+/**
+ * @brief 读取丢弃字节数实现
+ */
+uint32_t Console_GetDropped(void)
+{
+	return Console_Dropped;
+}
@@ -0,0 +1,65 @@
+/**
+ * @file Console.h
+ * @brief ST7789滚动控制台头文件
+ * @note 把Terminal_Output的每条文本记录镜像到屏幕上：记录在输出任务中只复制进流缓冲区，
+ *       由低优先级的Console_Task取出绘制，日志输出的延迟与屏幕速度无关；
+ *       换行时用VSCRSADD改变滚动起始行，只绘制新的一行，不重绘整个屏幕
+ */
+
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#include "ST7789.h"
+#include "Font.h"
+#include "Terminal.h"
+#include "stream_buffer.h"
+
+/**
+ * 镜像流缓冲区的字节数，控制台来不及绘制时超出的记录整条丢弃
+ */
+#ifndef CONSOLE_STREAM_SIZE
+#define CONSOLE_STREAM_SIZE    256
+#endif
+
+/**
+ * 一行最多保存的字符数，超出时与超出屏幕宽度一样换行
+ */
+#ifndef CONSOLE_COLUMNS
+#define CONSOLE_COLUMNS        48
+#endif
+
+/**
+ * 字库与颜色（RGB565）
+ */
+#ifndef CONSOLE_FONT
+#define CONSOLE_FONT           Font_Mono16
+#endif
+#ifndef CONSOLE_FOREGROUND
+#define CONSOLE_FOREGROUND     ST7789_RGB565(255, 255, 255)
+#endif
+#ifndef CONSOLE_BACKGROUND
+#define CONSOLE_BACKGROUND     ST7789_RGB565(0, 0, 0)
+#endif
+
+/**
+ * @brief 初始化控制台
+ * @note 创建镜像流缓冲区并设置Terminal的镜像回调，在调度器启动前调用可以保留启动阶段的输出；
+ *       TERMINAL_DEFERRED为1时没有文本可镜像，控制台保持空白
+ */
+void Console_Initialize(void);
+
+/**
+ * @brief 控制台任务
+ * @param pvParameters SPI0的传输管理（SPI_Chunk_Buffer *）
+ * @note 初始化屏幕后清屏，设置滚动区域为整数个文字行，然后循环取出镜像的文本绘制：
+ *       '\n'或超出屏幕宽度时换行，'\r'忽略，'\t'按空格显示；未结束的行在流缓冲区取空时整行重绘。
+ *       屏幕由本任务独占，应以低于输出日志的任务的优先级创建
+ */
+void Console_Task(void * pvParameters);
+
+/**
+ * @brief 读取因流缓冲区已满而未镜像的字节数
+ */
+uint32_t Console_GetDropped(void);
+
+#endif // CONSOLE_H
@@ -1,26 +1,299 @@
 #include "DMA-Buffer-Manager.h"
 #include <string.h>
 
+/**
+ * @brief DMA通道中断分发表，下标为DMA通道号
+ */
+static DMA_Buffer_Manager * DMA_Buffer_Manager_Table[DMA_BUFFER_MANAGER_CHANNELS];
+
+/**
+ * @brief DMA通道对应的中断号，下标为DMA通道号
+ */
+static const IRQn_Type DMA_Buffer_Manager_IRQn[DMA_BUFFER_MANAGER_CHANNELS] = {
+	DMA0_IRQn,
+	DMA1_IRQn,
+#if defined (SC32f10xx)
+	DMA2_IRQn,
+	DMA3_IRQn,
+#endif
+};
+
+/**
+ * @brief 获取DMA通道号（内部函数）
+ * @param Select_DMA DMA通道
+ * @return 通道号，无效通道返回-1
+ */
+static int DMA_Buffer_Manager_Channel(DMA_TypeDef * const Select_DMA)
+{
+	if (Select_DMA == DMA0) return 0;
+	if (Select_DMA == DMA1) return 1;
+#if defined (SC32f10xx)
+	if (Select_DMA == DMA2) return 2;
+	if (Select_DMA == DMA3) return 3;
+#endif
+	return -1;
+}
+
+/**
+ * @brief 按外设配置DMA通道（内部函数）
+ * @param Manager 管理器实例
+ * @return 配置成功返回1，外设不支持DMA发送返回0
+ * @note 目标地址为外设数据寄存器，请求源为外设的TX请求，并打开外设的DMA发送
+ */
+static int DMA_Buffer_Manager_Bind(DMA_Buffer_Manager * const Manager)
+{
+	DMA_InitTypeDef DMA_InitStruct;
+	DMA_StructInit(&DMA_InitStruct);
+	DMA_InitStruct.DMA_SourceMode = DMA_SourceMode_INC;
+	DMA_InitStruct.DMA_TargetMode = DMA_TargetMode_FIXED;
+	DMA_InitStruct.DMA_DataSize = DMA_DataSize_Byte;
+	DMA_InitStruct.DMA_SrcAddress = 0;
+	DMA_InitStruct.DMA_BufferSize = 0;
+	// 根据外设类型选择目标地址与请求源
+	switch (Manager->_Peripheral_Type)
+	{
+		case DMA_UART:
+		{
+			UART_TypeDef * UARTx = (UART_TypeDef *)Manager->_Select_Peripheral;
+			if (UARTx == UART0) DMA_InitStruct.DMA_Request = DMA_Request_UART0_TX;
+			else if (UARTx == UART1) DMA_InitStruct.DMA_Request = DMA_Request_UART1_TX;
+			else return 0;
+			DMA_InitStruct.DMA_DstAddress = (uint32_t)&UARTx->UART_DATA;
+			UART_DMACmd(UARTx, UART_DMAReq_TX, ENABLE);
+			break;
+		}
+		case DMA_SPI:
+		{
+			SPI_TypeDef * SPIx = (SPI_TypeDef *)Manager->_Select_Peripheral;
+			if (SPIx == SPI0) DMA_InitStruct.DMA_Request = DMA_Request_SPI0_TX;
+			else if (SPIx == SPI1) DMA_InitStruct.DMA_Request = DMA_Request_SPI1_TX;
+			else return 0;
+			DMA_InitStruct.DMA_DstAddress = (uint32_t)&SPIx->SPI_DATA;
+			SPI_DMACmd(SPIx, SPI_DMAReq_TX, ENABLE);
+			break;
+		}
+		case DMA_TWI:
+		{
+			TWI_TypeDef * TWIx = (TWI_TypeDef *)Manager->_Select_Peripheral;
+			if (TWIx == TWI0) DMA_InitStruct.DMA_Request = DMA_Request_TWI0_TX;
+			else return 0;
+			DMA_InitStruct.DMA_DstAddress = (uint32_t)&TWIx->TWI_DATA;
+			TWI_DMACmd(TWIx, TWI_DMAReq_TX, ENABLE);
+			break;
+		}
+		default:
+			return 0;
+	}
+	RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA, ENABLE);
+	DMA_Init(Manager->_Select_DMA, &DMA_InitStruct);
+	DMA_ITConfig(Manager->_Select_DMA, DMA_IT_INTEN | DMA_IT_TCIE, ENABLE); // 仅使用传输完成中断
+	DMA_ITConfig(Manager->_Select_DMA, DMA_IT_HTIE | DMA_IT_TEIE, DISABLE);
+	DMA_DMACmd(Manager->_Select_DMA, DMA_DMAReq_CHRQ, DISABLE);
+	NVIC_SetPriority(DMA_Buffer_Manager_IRQn[DMA_Buffer_Manager_Channel(Manager->_Select_DMA)], 3);
+	NVIC_EnableIRQ(DMA_Buffer_Manager_IRQn[DMA_Buffer_Manager_Channel(Manager->_Select_DMA)]);
+	DMA_Cmd(Manager->_Select_DMA, ENABLE);
+	return 1;
+}
+
+/**
+ * @brief 计算缓冲区可用空间（内部函数）
+ * @param Manager 管理器实例
+ * @return 可用空间（保留一个字节区分空与满）
+ */
+static uint16_t DMA_Buffer_Manager_Free(DMA_Buffer_Manager * const Manager)
+{
+	return (Manager->_Buffer_Length -
+		(Manager->_Head - Manager->_Tail + 1)) &
+		(Manager->_Buffer_Length - 1); // 计算可用空间（考虑环形缓冲区特性）
+}
+
 /**
  * @brief 启动DMA传输（内部函数）
  * @param Manager 管理器实例
- * @note 根据当前缓冲区状态配置DMA寄存器
+ * @note 根据当前缓冲区状态配置DMA寄存器，只发送已提交的数据
+ *       流式模式下若尾指针位于起点且除保留字节外整个缓冲区都已提交，则以循环模式启动
+ *       调用者需保证处于临界区或DMA中断中
  */
 static void DMA_Buffer_Manager_Start(DMA_Buffer_Manager * const Manager)
 {
+	uint16_t Half_Length = Manager->_Buffer_Length >> 1;
+	// 流式模式：整个缓冲区循环发送，每个半区产生一次中断。DMA进入后半区时中断才执行，
+	// 所以后半区也要在启动前提交：只差最后一个保留字节，中断有将近半个缓冲区的时间停下DMA
+	if (Manager->_Streaming && (Manager->_Tail == 0) &&
+		(((Manager->_Commit - Manager->_Tail) & (Manager->_Buffer_Length - 1)) == Manager->_Buffer_Length - 1))
+	{
+		Manager->_Circular = 1;
+		Manager->_Transmitting_Length = Half_Length;
+		Manager->_Select_DMA->DMA_CFG |= DMA_CFG_CIRC; // 固件库未提供单独设置循环模式的接口
+		DMA_ITConfig(Manager->_Select_DMA, DMA_IT_HTIE, ENABLE);
+		DMA_SetSrcAddress(Manager->_Select_DMA, (uint32_t)Manager->_Buffer);
+		DMA_SetCurrDataCounter(Manager->_Select_DMA, Manager->_Buffer_Length);
+		DMA_SoftwareTrigger(Manager->_Select_DMA);
+		return;
+	}
 	// 计算本次传输长度
-	if (Manager->_Head > Manager->_Tail)
+	if (Manager->_Commit > Manager->_Tail)
 	{
-		Manager->_Transmitting_Length = Manager->_Head - Manager->_Tail;
+		Manager->_Transmitting_Length = Manager->_Commit - Manager->_Tail;
 	}
 	else
 	{
 		Manager->_Transmitting_Length = Manager->_Buffer_Length - Manager->_Tail; // 处理缓冲区环绕情况
 	}
-	// 配置DMA寄存器（假设使用DMA0通道）
-	DMA_SetSrcAddress(DMA0, (uint32_t)&(Manager->_Buffer[Manager->_Tail])); // 设置源地址
-	DMA_SetCurrDataCounter(DMA0, Manager->_Transmitting_Length); // 设置数据量
-	DMA_SoftwareTrigger(DMA0); // 触发传输
+	// 配置管理器绑定的DMA通道
+	DMA_SetSrcAddress(Manager->_Select_DMA, (uint32_t)&(Manager->_Buffer[Manager->_Tail])); // 设置源地址
+	DMA_SetCurrDataCounter(Manager->_Select_DMA, Manager->_Transmitting_Length); // 设置数据量
+	DMA_SoftwareTrigger(Manager->_Select_DMA); // 触发传输
+}
+
+/**
+ * @brief 暂停并停止当前传输，尾指针同步到实际发送位置（内部函数）
+ * @param Manager 管理器实例
+ * @note 调用者需处于临界区或DMA中断中。循环模式同时被关闭，已挂起的DMA中断被清除，
+ *       若DMA已越过提交指针（读到了未提交的数据），尾指针只推进到提交指针
+ */
+static void DMA_Buffer_Manager_Halt(DMA_Buffer_Manager * const Manager)
+{
+	uint16_t Mask = Manager->_Buffer_Length - 1;
+	uint16_t Sent;
+	if (Manager->_Transmitting_Length == 0)
+	{
+		return;
+	}
+	DMA_PauseCmd(Manager->_Select_DMA, ENABLE);
+	uint16_t Counter = (uint16_t)DMA_GetCurrDataCounter(Manager->_Select_DMA);
+	if (Manager->_Circular)
+	{
+		Sent = (Manager->_Buffer_Length - Counter - Manager->_Tail) & Mask; // 计数器从整个缓冲区长度开始递减
+		Manager->_Select_DMA->DMA_CFG &= ~DMA_CFG_CIRC;
+		DMA_ITConfig(Manager->_Select_DMA, DMA_IT_HTIE, DISABLE);
+		Manager->_Circular = 0;
+	}
+	else
+	{
+		Sent = Manager->_Transmitting_Length - Counter;
+	}
+	if (Sent > ((Manager->_Commit - Manager->_Tail) & Mask))
+	{
+		Sent = (Manager->_Commit - Manager->_Tail) & Mask;
+	}
+	Manager->_Tail = (Manager->_Tail + Sent) & Mask;
+	Manager->_Transmitting_Length = 0;
+	DMA_SetCurrDataCounter(Manager->_Select_DMA, 0);
+	DMA_ClearFlag(Manager->_Select_DMA, DMA_FLAG_GIF|DMA_FLAG_TCIF|DMA_FLAG_HTIF|DMA_FLAG_TEIF); // 丢弃可能已挂起的中断
+	// 暂停前到达的TC/HT已计入尾指针，NVIC挂起位也要清除：否则退出临界区后中断按新一段的长度再推进一次尾指针
+	NVIC_ClearPendingIRQ(DMA_Buffer_Manager_IRQn[DMA_Buffer_Manager_Channel(Manager->_Select_DMA)]);
+	DMA_PauseCmd(Manager->_Select_DMA, DISABLE);
+}
+
+/**
+ * @brief 丢弃最旧的未发送数据（内部函数）
+ * @param Manager 管理器实例
+ * @param Need_Length 需要腾出的空间
+ * @note 调用者需处于临界区。正在传输的段先暂停，已发出的部分计入尾指针，
+ *       然后从尾指针开始丢弃已提交但未发送的数据，最后从新的尾指针重新启动DMA。
+ *       仍在拷贝中的预留区域不会被丢弃
+ */
+static void DMA_Buffer_Manager_Reclaim(DMA_Buffer_Manager * const Manager, uint16_t Need_Length)
+{
+	uint16_t Mask = Manager->_Buffer_Length - 1;
+	// 暂停正在进行的传输，把已发送部分计入尾指针
+	DMA_Buffer_Manager_Halt(Manager);
+	// 只丢弃已提交的数据
+	uint16_t Discardable = (Manager->_Commit - Manager->_Tail) & Mask;
+	if (Need_Length > Discardable)
+	{
+		Need_Length = Discardable;
+	}
+	Manager->_Tail = (Manager->_Tail + Need_Length) & Mask;
+	Manager->_Statistics.Overwritten_Bytes += Need_Length;
+	// 从新的尾指针继续发送
+	if (Manager->_Commit != Manager->_Tail)
+	{
+		DMA_Buffer_Manager_Start(Manager);
+	}
+}
+
+/**
+ * @brief 阻塞等待缓冲区空间（内部函数）
+ * @param Manager 管理器实例
+ * @param Wait_Length 需要的空闲空间（不超过缓冲区容量）
+ * @param Time_Out 等待开始时的超时状态
+ * @param Remaining 剩余等待时间，返回时更新
+ * @return 超时返回pdFALSE，否则返回pdTRUE
+ * @note 同一时间只有一个生产者在等待，由DMA完成中断通过任务通知唤醒，
+ *       其余生产者在互斥锁上排队；返回后空间可能已被其他生产者抢先预留，由调用者重新检查
+ */
+static BaseType_t DMA_Buffer_Manager_Wait
+(
+    DMA_Buffer_Manager * const Manager,
+    uint16_t Wait_Length,
+    TimeOut_t * const Time_Out,
+    TickType_t * const Remaining
+) {
+	if (xSemaphoreTake(Manager->_Resource_Occupy, *Remaining) == pdTRUE)
+	{
+		for (;;)
+		{
+			taskENTER_CRITICAL(); // 进入临界区
+			if (DMA_Buffer_Manager_Free(Manager) >= Wait_Length)
+			{
+				taskEXIT_CRITICAL(); // 退出临界区
+				break;
+			}
+			Manager->_Waiting_Length = Wait_Length;
+			Manager->_Waiting_Task = xTaskGetCurrentTaskHandle(); // 登记等待任务
+			taskEXIT_CRITICAL(); // 退出临界区
+			if (xTaskCheckForTimeOut(Time_Out, Remaining) != pdFALSE)
+			{
+				break;
+			}
+			ulTaskNotifyTakeIndexed(DMA_BUFFER_MANAGER_NOTIFY_INDEX, pdTRUE, *Remaining);
+		}
+		taskENTER_CRITICAL(); // 进入临界区
+		Manager->_Waiting_Task = NULL;
+		taskEXIT_CRITICAL(); // 退出临界区
+		xSemaphoreGive(Manager->_Resource_Occupy); // 释放等待权
+	}
+	return (xTaskCheckForTimeOut(Time_Out, Remaining) == pdFALSE) ? pdTRUE : pdFALSE;
+}
+
+/**
+ * @brief 初始化管理器状态并绑定DMA通道（内部函数）
+ * @param Manager 管理器实例（缓冲区与互斥锁已就绪）
+ * @param Select_DMA 选定的DMA控制器
+ * @param Select_Peripheral 外设地址
+ * @param Peripheral_Type 外设类型
+ */
+static void DMA_Buffer_Manager_Setup
+(
+    DMA_Buffer_Manager * const Manager,
+    DMA_TypeDef * const Select_DMA,
+	void * const Select_Peripheral,
+	DMA_Peripheral_Enum Peripheral_Type
+) {
+	// 初始化管理器内部状态
+    Manager->_Head = 0;
+    Manager->_Commit = 0;
+    Manager->_Tail = 0;
+    Manager->_Transmitting_Length = 0;
+    Manager->_Writers = 0;
+    Manager->_Streaming = 0;
+    Manager->_Circular = 0;
+    Manager->_Policy = DMA_DROP_NEWEST;
+    Manager->_Block_Timeout = 0;
+    Manager->_Waiting_Task = NULL;
+    Manager->_Waiting_Length = 0;
+    memset(&Manager->_Statistics, 0, sizeof(Manager->_Statistics));
+    Manager->_Select_DMA = Select_DMA;
+	Manager->_Select_Peripheral = Select_Peripheral;
+	Manager->_Peripheral_Type = Peripheral_Type;
+	// 配置DMA通道并登记到中断分发表
+	if (!DMA_Buffer_Manager_Bind(Manager))
+	{
+		while(1); // 外设不支持DMA发送
+	}
+	DMA_Buffer_Manager_Table[DMA_Buffer_Manager_Channel(Select_DMA)] = Manager;
 }
 
 /**
@@ -44,7 +317,7 @@ void DMA_Buffer_Manager_Initialize
         Manager == NULL || 								// 管理器指针有效性
         Buffer_Length == 0 || 							// 缓冲区长度非零
 		((Buffer_Length & (Buffer_Length - 1)) != 0) || // 必须为2的幂次方
-        ((Select_DMA != DMA0) && (Select_DMA != DMA1)) 	// DMA控制器有效性
+        (DMA_Buffer_Manager_Channel(Select_DMA) < 0) 	// DMA通道有效性
     )
 	{
         while(1); // 参数错误进入死循环（需根据实际项目替换为错误处理）
@@ -67,15 +340,271 @@ void DMA_Buffer_Manager_Initialize
             Manager->_Buffer_Length = Buffer_Length;
         }
     }
-	// 初始化管理器内部状态
-    Manager->_Head = 0;
-    Manager->_Tail = 0;
-    Manager->_Transmitting_Length = 0;
-    Manager->_Select_DMA = Select_DMA;
-	Manager->_Select_Peripheral = Select_Peripheral;
-	Manager->_Peripheral_Type = Peripheral_Type;
-    Manager->_Resource_Occupy = xSemaphoreCreateMutex(); // 创建资源访问互斥锁
-	configASSERT(Manager->_Resource_Occupy); // 资源创建检查
+    if (Manager->_Resource_Occupy == NULL)
+    {
+        Manager->_Resource_Occupy = xSemaphoreCreateMutex(); // 创建阻塞等待互斥锁
+        configASSERT(Manager->_Resource_Occupy); // 资源创建检查
+    }
+	DMA_Buffer_Manager_Setup(Manager, Select_DMA, Select_Peripheral, Peripheral_Type);
+}
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ * @brief 使用静态存储初始化DMA缓冲区管理器实现
+ * @param Manager 管理器实例
+ * @param Buffer 缓冲区存储空间
+ * @param Buffer_Length 缓冲区长度
+ * @param Mutex_Storage 阻塞等待互斥锁的存储空间
+ * @param Select_DMA 选定的DMA控制器
+ * @param Select_Peripheral 外设地址
+ * @param Peripheral_Type 外设类型
+ */
+void DMA_Buffer_Manager_InitializeStatic
+(
+    DMA_Buffer_Manager * const Manager,
+    uint8_t * const Buffer,
+    const uint16_t Buffer_Length,
+    StaticSemaphore_t * const Mutex_Storage,
+    DMA_TypeDef * const Select_DMA,
+	void * const Select_Peripheral,
+	DMA_Peripheral_Enum Peripheral_Type
+) {
+	// 参数有效性检查
+    if (
+        Manager == NULL || 								// 管理器指针有效性
+        Buffer == NULL || Mutex_Storage == NULL || 		// 存储空间有效性
+        Buffer_Length == 0 || 							// 缓冲区长度非零
+		((Buffer_Length & (Buffer_Length - 1)) != 0) || // 必须为2的幂次方
+        (DMA_Buffer_Manager_Channel(Select_DMA) < 0) 	// DMA通道有效性
+    )
+	{
+        while(1); // 参数错误进入死循环（需根据实际项目替换为错误处理）
+    }
+	// 缓冲区由调用者提供，不经过堆，重新初始化时直接换用新的存储空间
+    Manager->_Buffer = (volatile uint8_t *)Buffer;
+    Manager->_Buffer_Length = Buffer_Length;
+    if (Manager->_Resource_Occupy == NULL)
+    {
+        Manager->_Resource_Occupy = xSemaphoreCreateMutexStatic(Mutex_Storage); // 在调用者提供的存储中创建互斥锁
+    }
+	DMA_Buffer_Manager_Setup(Manager, Select_DMA, Select_Peripheral, Peripheral_Type);
+}
+#endif
+
+/**
+ * @brief 预留可写区域的公共实现
+ * @param Manager 管理器实例
+ * @param Reserve_Length 请求预留的长度
+ * @param Span 输出可写区域
+ * @param Atomic 非0时空间不足则整体放弃，不做截断
+ * @return 实际预留长度
+ * @note Cortex-M0+不支持LDREX/STREX，因此使用仅包含数条指令的临界区完成申请
+ */
+static uint16_t DMA_Buffer_Manager_Claim
+(
+    DMA_Buffer_Manager * const Manager,
+    uint16_t Reserve_Length,
+    DMA_Buffer_Span * const Span,
+    const uint8_t Atomic
+) {
+	uint16_t Request_Length = Reserve_Length;
+	uint16_t Start = 0;
+	// 超过缓冲区容量的部分无论如何都放不下，只等待到缓冲区全空
+	uint16_t Wait_Length = (Reserve_Length < Manager->_Buffer_Length) ? Reserve_Length : (Manager->_Buffer_Length - 1);
+	TickType_t Begin_Tick = 0;
+	TickType_t Remaining = Manager->_Block_Timeout;
+	TimeOut_t Time_Out;
+	uint8_t Blocked = 0;
+	taskENTER_CRITICAL(); // 进入临界区
+	// 阻塞策略：空间不足时等待DMA释放空间，醒来后重新检查，直到空间足够或超时
+	while ((Manager->_Policy == DMA_BLOCK) && (DMA_Buffer_Manager_Free(Manager) < Wait_Length) &&
+		   (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)) // 调度器未运行时无法阻塞
+	{
+		taskEXIT_CRITICAL(); // 退出临界区
+		if (!Blocked)
+		{
+			Blocked = 1;
+			Begin_Tick = xTaskGetTickCount();
+			vTaskSetTimeOutState(&Time_Out);
+		}
+		BaseType_t Waiting = DMA_Buffer_Manager_Wait(Manager, Wait_Length, &Time_Out, &Remaining);
+		taskENTER_CRITICAL(); // 进入临界区
+		if (Waiting == pdFALSE)
+		{
+			break; // 超时后按实际空间截断
+		}
+	}
+	if (Blocked)
+	{
+		Manager->_Statistics.Blocked_Count++;
+		Manager->_Statistics.Blocked_Ticks += xTaskGetTickCount() - Begin_Tick;
+	}
+	uint16_t Free_Buffer_Length = DMA_Buffer_Manager_Free(Manager);
+	// 覆盖策略：丢弃最旧的数据腾出空间
+	if ((Manager->_Policy == DMA_OVERWRITE_OLDEST) && (Free_Buffer_Length < Reserve_Length))
+	{
+		DMA_Buffer_Manager_Reclaim(Manager, Reserve_Length - Free_Buffer_Length);
+		Free_Buffer_Length = DMA_Buffer_Manager_Free(Manager);
+	}
+	// 限制预留长度不超过可用空间，整体预留时放弃整条记录
+	if (Reserve_Length > Free_Buffer_Length)
+	{
+		Reserve_Length = Atomic ? 0 : Free_Buffer_Length;
+		Manager->_Statistics.Dropped_Records++;
+	}
+	if (Reserve_Length != 0)
+	{
+		Start = Manager->_Head;
+		Manager->_Head = (Manager->_Head + Reserve_Length) & (Manager->_Buffer_Length - 1);
+		Manager->_Writers++; // 登记一个尚未提交的生产者
+	}
+	Manager->_Statistics.Dropped_Bytes += Request_Length - Reserve_Length; // 统计放不下的数据
+	taskEXIT_CRITICAL(); // 退出临界区
+	// 按环绕点拆分可写区域（无需临界区保护）
+	uint16_t First_Length = Manager->_Buffer_Length - Start;
+	if (First_Length > Reserve_Length)
+	{
+		First_Length = Reserve_Length;
+	}
+	Span->Pointer[0] = (uint8_t *)&(Manager->_Buffer[Start]);
+	Span->Length[0] = First_Length;
+	Span->Pointer[1] = (uint8_t *)&(Manager->_Buffer[0]);
+	Span->Length[1] = Reserve_Length - First_Length;
+	return Reserve_Length;
+}
+
+/**
+ * @brief 预留可写区域实现
+ * @param Manager 管理器实例
+ * @param Reserve_Length 请求预留的长度
+ * @param Span 输出可写区域
+ * @return 实际预留长度
+ */
+uint16_t DMA_Buffer_Manager_Reserve
+(
+    DMA_Buffer_Manager * const Manager,
+    uint16_t Reserve_Length,
+    DMA_Buffer_Span * const Span
+) {
+	return DMA_Buffer_Manager_Claim(Manager, Reserve_Length, Span, 0);
+}
+
+/**
+ * @brief 整体预留可写区域实现
+ * @param Manager 管理器实例
+ * @param Reserve_Length 记录长度
+ * @param Span 输出可写区域
+ * @return Reserve_Length或0
+ */
+uint16_t DMA_Buffer_Manager_ReserveRecord
+(
+    DMA_Buffer_Manager * const Manager,
+    uint16_t Reserve_Length,
+    DMA_Buffer_Span * const Span
+) {
+	return DMA_Buffer_Manager_Claim(Manager, Reserve_Length, Span, 1);
+}
+
+/**
+ * @brief 提交预留区域实现
+ * @param Manager 管理器实例
+ * @note 最后一个完成写入的生产者负责把提交指针推进到预留指针，
+ *       从而保证DMA只会发送此前所有预留区域都已写完的数据
+ */
+void DMA_Buffer_Manager_Commit(DMA_Buffer_Manager * const Manager)
+{
+	taskENTER_CRITICAL(); // 进入临界区
+	if (--Manager->_Writers == 0)
+	{
+		Manager->_Commit = Manager->_Head;
+		// 如果DMA当前未传输，启动新传输
+		if ((Manager->_Transmitting_Length == 0) && (Manager->_Commit != Manager->_Tail))
+		{
+			DMA_Buffer_Manager_Start(Manager);
+		}
+	}
+	taskEXIT_CRITICAL(); // 退出临界区
+}
+
+/**
+ * @brief 设置处理策略实现
+ * @param Manager 管理器实例
+ * @param Policy 处理策略
+ * @param Block_Timeout 阻塞策略的最长等待时间
+ */
+void DMA_Buffer_Manager_SetPolicy
+(
+    DMA_Buffer_Manager * const Manager,
+    DMA_Policy_Enum Policy,
+    TickType_t Block_Timeout
+) {
+	taskENTER_CRITICAL(); // 进入临界区
+	Manager->_Policy = Policy;
+	Manager->_Block_Timeout = Block_Timeout;
+	taskEXIT_CRITICAL(); // 退出临界区
+}
+
+/**
+ * @brief 读取缓冲区满时的处理策略实现
+ * @param Manager 管理器实例
+ * @param Policy 返回当前处理策略
+ * @param Block_Timeout 返回DMA_BLOCK策略的最长等待时间（tick）
+ */
+void DMA_Buffer_Manager_GetPolicy
+(
+    DMA_Buffer_Manager * const Manager,
+    DMA_Policy_Enum * const Policy,
+    TickType_t * const Block_Timeout
+) {
+	taskENTER_CRITICAL(); // 进入临界区
+	*Policy = Manager->_Policy;
+	*Block_Timeout = Manager->_Block_Timeout;
+	taskEXIT_CRITICAL(); // 退出临界区
+}
+
+/**
+ * @brief 设置循环流式发送模式实现
+ * @param Manager 管理器实例
+ * @param NewState ENABLE开启，DISABLE关闭
+ */
+void DMA_Buffer_Manager_SetStreaming
+(
+    DMA_Buffer_Manager * const Manager,
+    FunctionalState NewState
+) {
+	taskENTER_CRITICAL(); // 进入临界区
+	Manager->_Streaming = (NewState != DISABLE);
+	// 关闭时若正在循环发送，停在当前位置后按逐段方式继续
+	if (!Manager->_Streaming && Manager->_Circular)
+	{
+		DMA_Buffer_Manager_Halt(Manager);
+		if (Manager->_Commit != Manager->_Tail)
+		{
+			DMA_Buffer_Manager_Start(Manager);
+		}
+	}
+	taskEXIT_CRITICAL(); // 退出临界区
+}
+
+/**
+ * @brief 读取统计信息实现
+ * @param Manager 管理器实例
+ * @param Statistics 输出统计信息
+ * @param Clear 非0时读取后清零
+ */
+void DMA_Buffer_Manager_GetStatistics
+(
+    DMA_Buffer_Manager * const Manager,
+    DMA_Buffer_Statistics * const Statistics,
+    const uint8_t Clear
+) {
+	taskENTER_CRITICAL(); // 进入临界区
+	*Statistics = Manager->_Statistics;
+	if (Clear)
+	{
+		memset(&Manager->_Statistics, 0, sizeof(Manager->_Statistics));
+	}
+	taskEXIT_CRITICAL(); // 退出临界区
 }
 
 /**
@@ -91,53 +620,23 @@ uint16_t DMA_Buffer_Manager_Input
     uint8_t * const Data_Pointer,
     uint16_t Data_Input_Length
 ) {
-	// 获取互斥锁进入临界区
-    if (xSemaphoreTake(Manager->_Resource_Occupy, portMAX_DELAY) == pdTRUE)
-    {
-		taskENTER_CRITICAL(); // 进入临界区
-        uint16_t Free_Buffer_Length = (Manager->_Buffer_Length -
-			(Manager->_Head - Manager->_Tail + 1)) &
-			(Manager->_Buffer_Length - 1); // 计算可用空间（考虑环形缓冲区特性）
-		// 缓冲区满
-        if (Free_Buffer_Length == 0)
-        {
-            xSemaphoreGive(Manager->_Resource_Occupy); // 释放资源访问权限
-			taskEXIT_CRITICAL(); // 退出临界区
-            return 0;
-        }
-		// 限制写入长度不超过可用空间
-        if (Data_Input_Length > Free_Buffer_Length)
-        {
-            Data_Input_Length = Free_Buffer_Length;
-        }
-		// 分段拷贝数据（处理缓冲区环绕）
-        uint16_t First_Input_Length = Manager->_Buffer_Length - Manager->_Head;
-        if (First_Input_Length > Data_Input_Length)
-        {
-            First_Input_Length = Data_Input_Length;
-        }
-		// 第一段拷贝
-        memcpy((void *)&(Manager->_Buffer[Manager->_Head]), Data_Pointer, First_Input_Length);
-        Manager->_Head = (Manager->_Head + First_Input_Length) & (Manager->_Buffer_Length - 1);
-        uint16_t Inputted = First_Input_Length;
-		// 第二段拷贝（如果存在环绕）
-        if (Data_Input_Length > First_Input_Length)
-        {
-            uint16_t Second_Input_Length = Data_Input_Length - First_Input_Length;
-			memcpy((void *)&Manager->_Buffer[Manager->_Head + 1], &Data_Pointer[First_Input_Length], Second_Input_Length);
-			Manager->_Head = (Manager->_Head + Second_Input_Length + 1) & (Manager->_Buffer_Length - 1);
-            Inputted += Second_Input_Length;
-        }
-		// 如果DMA当前未传输，启动新传输
-		if (DMA_GetCurrDataCounter(DMA0) == 0)
-		{
-			DMA_Buffer_Manager_Start(Manager);
-		}
-        xSemaphoreGive(Manager->_Resource_Occupy); // 释放资源访问权限
-		taskEXIT_CRITICAL(); // 退出临界区
-        return Inputted; // 返回输入字节数
-    }
-    return 0;
+	DMA_Buffer_Span Span;
+	// 在临界区内预留写入区域
+	Data_Input_Length = DMA_Buffer_Manager_Reserve(Manager, Data_Input_Length, &Span);
+	// 缓冲区满
+	if (Data_Input_Length == 0)
+	{
+		return 0;
+	}
+	// 分段拷贝数据（处理缓冲区环绕），拷贝期间不关中断
+	memcpy(Span.Pointer[0], Data_Pointer, Span.Length[0]);
+	if (Span.Length[1] != 0)
+	{
+		memcpy(Span.Pointer[1], &Data_Pointer[Span.Length[0]], Span.Length[1]);
+	}
+	// 提交预留区域，必要时启动DMA
+	DMA_Buffer_Manager_Commit(Manager);
+	return Data_Input_Length; // 返回输入字节数
 }
 
 /**
@@ -148,13 +647,59 @@ void DMA_Buffer_Manager_IRQHandler(DMA_Buffer_Manager * const Manager)
 {
 	Manager->_Tail = (Manager->_Tail +
 		Manager->_Transmitting_Length) & (Manager->_Buffer_Length - 1); // 更新尾指针位置
-	// 如果仍有待传输数据，启动下一次传输
-	if (Manager->_Head != Manager->_Tail)
+	// 循环模式：每个半区边界产生一次中断，DMA已自动进入下一个半区
+	if (Manager->_Circular)
 	{
-		DMA_Buffer_Manager_Start(Manager);
+		// 中断可能被推迟，进入的半区之后的半区也必须已全部提交才能继续循环，否则停在实际发送位置并退回逐段发送。
+		// 之后的半区就是刚发送完的半区，此时还不能重新提交，所以DMA最多循环到第一个半区边界
+		if (((Manager->_Commit - Manager->_Tail) & (Manager->_Buffer_Length - 1)) < Manager->_Buffer_Length - 1)
+		{
+			DMA_Buffer_Manager_Halt(Manager);
+		}
 	}
-	else
+	// 逐段模式：如果仍有已提交的待传输数据，启动下一次传输
+	if (!Manager->_Circular)
 	{
-		Manager->_Transmitting_Length = 0; // 无更多数据时清空传输长度
+		if (Manager->_Commit != Manager->_Tail)
+		{
+			DMA_Buffer_Manager_Start(Manager);
+		}
+		else
+		{
+			Manager->_Transmitting_Length = 0; // 无更多数据时清空传输长度
+		}
+	}
+	// 空间足够时唤醒阻塞等待的生产者
+	if ((Manager->_Waiting_Task != NULL) &&
+		(DMA_Buffer_Manager_Free(Manager) >= Manager->_Waiting_Length))
+	{
+		BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+		vTaskNotifyGiveIndexedFromISR(Manager->_Waiting_Task, DMA_BUFFER_MANAGER_NOTIFY_INDEX, &xHigherPriorityTaskWoken);
+		Manager->_Waiting_Task = NULL;
+		portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+	}
+}
+
+/**
+ * @brief DMA中断分发实现
+ * @param Select_DMA 产生中断的DMA通道
+ */
+void DMA_Buffer_Manager_Dispatch(DMA_TypeDef * const Select_DMA)
+{
+	int Channel = DMA_Buffer_Manager_Channel(Select_DMA);
+	if ((Channel >= 0) && (DMA_Buffer_Manager_Table[Channel] != NULL))
+	{
+		DMA_Buffer_Manager_IRQHandler(DMA_Buffer_Manager_Table[Channel]);
 	}
 }
+
+/**
+ * @brief 查询DMA通道是否已绑定管理器实现
+ * @param Select_DMA DMA通道
+ * @return 已绑定返回1，否则返回0
+ */
+uint8_t DMA_Buffer_Manager_IsBound(DMA_TypeDef * const Select_DMA)
+{
+	int Channel = DMA_Buffer_Manager_Channel(Select_DMA);
+	return (Channel >= 0) && (DMA_Buffer_Manager_Table[Channel] != NULL);
+}
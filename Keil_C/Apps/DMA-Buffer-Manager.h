@@ -2,6 +2,8 @@
  * @file DMA-Buffer-Manager.h
  * @brief DMA缓冲区管理模块头文件
  * @note 实现基于环形缓冲区的DMA数据流管理，支持线程安全操作
+ *       写入采用"预留-拷贝-提交"方式：仅在极短的临界区内申请写入位置，
+ *       数据拷贝在开中断状态下进行，多个生产者可同时拷贝到各自预留的区域
  */
 
 #ifndef DMA_Buffer_Manager_H
@@ -9,14 +11,61 @@
 
 #include "SC_Init.h"
 #include "FreeRTOS.h"
+#include "task.h"
 #include "semphr.h"
 
+/**
+ * @brief 可用的DMA通道数量，每个通道可绑定一个管理器
+ */
+#if defined (SC32f10xx)
+#define DMA_BUFFER_MANAGER_CHANNELS 4 // DMA0~DMA3
+#else
+#define DMA_BUFFER_MANAGER_CHANNELS 2 // DMA0~DMA1
+#endif
+
+/**
+ * @brief 阻塞策略唤醒生产者所使用的任务通知索引
+ */
+#define DMA_BUFFER_MANAGER_NOTIFY_INDEX 1
+
 typedef enum {
 	DMA_UART = 0,
 	DMA_SPI,
 	DMA_TWI,
 } DMA_Peripheral_Enum;
 
+/**
+ * @brief 缓冲区满时的处理策略
+ */
+typedef enum {
+	DMA_DROP_NEWEST = 0,	// 丢弃放不下的新数据（默认）
+	DMA_BLOCK,				// 等待DMA释放空间，超时后丢弃放不下的部分
+	DMA_OVERWRITE_OLDEST,	// 丢弃最旧的未发送数据为新数据腾出空间（适合黑匣子式日志）
+} DMA_Policy_Enum;
+
+/**
+ * @struct DMA_Buffer_Statistics
+ * @brief 缓冲区满时的统计信息
+ */
+typedef struct
+{
+    uint32_t             Dropped_Bytes;		   // 因空间不足被丢弃的新数据字节数
+    uint32_t             Dropped_Records;	   // 因空间不足被截断或整体丢弃的写入次数
+    uint32_t             Overwritten_Bytes;	   // 被新数据覆盖的旧数据字节数
+    uint32_t             Blocked_Count;		   // 生产者进入阻塞等待的次数
+    uint32_t             Blocked_Ticks;		   // 生产者累计阻塞等待的时间（tick）
+} DMA_Buffer_Statistics;
+
+/**
+ * @struct DMA_Buffer_Span
+ * @brief 预留得到的可写区域，环绕时被拆分为两段连续空间
+ */
+typedef struct
+{
+    uint8_t *            Pointer[2];		   // 各段可写区域的起始地址
+    uint16_t             Length[2];			   // 各段可写区域的长度（无环绕时第二段为0）
+} DMA_Buffer_Span;
+
 /**
  * @struct DMA_Buffer_Manager
  * @brief DMA缓冲区管理器核心结构体
@@ -24,25 +73,37 @@ typedef enum {
 typedef struct
 {
     volatile uint8_t *   _Buffer;			   // 指向缓冲区存储空间的指针
-    volatile uint16_t    _Head;				   // 数据写入指针（生产者端）
+    volatile uint16_t    _Head;				   // 数据预留指针（生产者已申请到的位置）
+    volatile uint16_t    _Commit;			   // 数据提交指针（此前的数据均已写完，可交由DMA发送）
     volatile uint16_t    _Tail;				   // 数据读取指针（消费者端）
-    volatile uint16_t    _Transmitting_Length; // 当前正在传输的数据长度
+    volatile uint16_t    _Transmitting_Length; // 当前正在传输的数据长度（为0表示DMA空闲）
+    volatile uint8_t     _Writers;			   // 已预留但尚未提交的生产者数量
+    uint8_t              _Streaming;		   // 是否允许循环流式发送
+    volatile uint8_t     _Circular;			   // DMA当前是否处于循环模式（每次传输半个缓冲区）
     uint16_t             _Buffer_Length;	   // 缓冲区总长度（必须为2的幂次方）
     DMA_TypeDef *      	 _Select_DMA;		   // 选定的DMA控制器
     void *               _Select_Peripheral;   // 目标外设地址
 	DMA_Peripheral_Enum  _Peripheral_Type;	   // 外设类型标识
-    SemaphoreHandle_t    _Resource_Occupy;	   // 资源访问互斥锁
+    DMA_Policy_Enum      _Policy;			   // 缓冲区满时的处理策略
+    TickType_t           _Block_Timeout;	   // 阻塞策略的最长等待时间
+    SemaphoreHandle_t    _Resource_Occupy;	   // 阻塞等待互斥锁（同一时间只有一个生产者等待空间）
+    TaskHandle_t volatile _Waiting_Task;	   // 正在等待空间的任务
+    volatile uint16_t    _Waiting_Length;	   // 等待任务所需的空闲空间
+    DMA_Buffer_Statistics _Statistics;		   // 缓冲区满时的统计信息
 } DMA_Buffer_Manager;
 
 /**
  * @brief 初始化DMA缓冲区管理器
  * @param Manager 指向管理器实例的指针
  * @param Buffer_Length 缓冲区长度（必须为2的幂次方）
- * @param Select_DMA 选定的DMA控制器（DMA0/DMA1）
- * @param Select_Peripheral 目标外设地址
+ * @param Select_DMA 选定的DMA通道（DMA0~DMA1，SC32f10xx为DMA0~DMA3）
+ * @param Select_Peripheral 目标外设（UART0/UART1、SPI0/SPI1、TWI0）
  * @param Peripheral_Type 外设类型枚举
  * @note 如果缓冲区指针为空则自动分配内存
  *       如果已存在缓冲区但长度不匹配则重新分配
+ *       DMA通道按外设的TX请求重新配置，并登记到中断分发表，
+ *       每个DMA通道只能绑定一个管理器
+ *       缓冲区满时的处理策略默认为DMA_DROP_NEWEST
  */
 void DMA_Buffer_Manager_Initialize(
     DMA_Buffer_Manager * const Manager,
@@ -52,13 +113,91 @@ void DMA_Buffer_Manager_Initialize(
 	DMA_Peripheral_Enum Peripheral_Enum
 );
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/**
+ * @brief 使用调用者提供的存储空间初始化DMA缓冲区管理器
+ * @param Manager 指向管理器实例的指针
+ * @param Buffer 缓冲区存储空间，管理器使用期间必须一直有效（通常为静态数组）
+ * @param Buffer_Length 缓冲区长度（必须为2的幂次方）
+ * @param Mutex_Storage 阻塞等待互斥锁的存储空间，同样必须一直有效
+ * @param Select_DMA 选定的DMA通道（DMA0~DMA1，SC32f10xx为DMA0~DMA3）
+ * @param Select_Peripheral 目标外设（UART0/UART1、SPI0/SPI1、TWI0）
+ * @param Peripheral_Type 外设类型枚举
+ * @note 与DMA_Buffer_Manager_Initialize相同，只是不使用FreeRTOS堆，
+ *       管理器可以在链接时完全确定位置，启动过程没有分配失败的可能；
+ *       同一个管理器不要与DMA_Buffer_Manager_Initialize混用（堆上的旧缓冲区不会被释放）
+ */
+void DMA_Buffer_Manager_InitializeStatic(
+    DMA_Buffer_Manager * const Manager,
+    uint8_t * const Buffer,
+    const uint16_t Buffer_Length,
+    StaticSemaphore_t * const Mutex_Storage,
+    DMA_TypeDef * const Select_DMA,
+	void * const Select_Peripheral,
+	DMA_Peripheral_Enum Peripheral_Enum
+);
+#endif
+
+/**
+ * @brief 设置缓冲区满时的处理策略
+ * @param Manager 管理器实例
+ * @param Policy 处理策略
+ * @param Block_Timeout DMA_BLOCK策略的最长等待时间（tick），其他策略忽略
+ */
+void DMA_Buffer_Manager_SetPolicy(
+    DMA_Buffer_Manager * const Manager,
+    DMA_Policy_Enum Policy,
+    TickType_t Block_Timeout
+);
+
+/**
+ * @brief 读取缓冲区满时的处理策略
+ * @param Manager 管理器实例
+ * @param Policy 返回当前处理策略
+ * @param Block_Timeout 返回DMA_BLOCK策略的最长等待时间（tick）
+ * @note 用于临时切换策略后用DMA_Buffer_Manager_SetPolicy恢复
+ */
+void DMA_Buffer_Manager_GetPolicy(
+    DMA_Buffer_Manager * const Manager,
+    DMA_Policy_Enum * const Policy,
+    TickType_t * const Block_Timeout
+);
+
+/**
+ * @brief 开启或关闭循环流式发送模式
+ * @param Manager 管理器实例
+ * @param NewState ENABLE开启，DISABLE关闭
+ * @note 开启后，当尾指针位于缓冲区起点且除保留字节外整个缓冲区都已提交时，DMA切换为覆盖整个缓冲区的循环模式，
+ *       通过半传输/传输完成中断跟踪发送位置；半区边界中断发现之后的半区未全部提交时暂停DMA，
+ *       按实际发送位置退回逐段发送。DMA不会读到未提交的数据，只要半区边界中断的延迟
+ *       不超过外设发送将近半个缓冲区的时间，适用于UART等按字节节拍请求的外设
+ */
+void DMA_Buffer_Manager_SetStreaming(
+    DMA_Buffer_Manager * const Manager,
+    FunctionalState NewState
+);
+
+/**
+ * @brief 读取缓冲区满时的统计信息
+ * @param Manager 管理器实例
+ * @param Statistics 输出统计信息
+ * @param Clear 非0时读取后清零
+ */
+void DMA_Buffer_Manager_GetStatistics(
+    DMA_Buffer_Manager * const Manager,
+    DMA_Buffer_Statistics * const Statistics,
+    const uint8_t Clear
+);
+
 /**
  * @brief 向缓冲区写入数据
  * @param Manager 管理器实例
  * @param Data_Pointer 指向数据源的指针
  * @param Data_Input_Length 要写入的数据长度
- * @return 实际写入的字节数（可能小于请求长度）
- * @note 该函数线程安全，内部使用互斥锁和临界区保护
+ * @return 实际写入的字节数（空间不足时按处理策略可能小于请求长度）
+ * @note 该函数线程安全，可被多个任务同时调用（不可在中断中调用）
+ *       临界区仅覆盖写入位置的申请与提交，数据拷贝期间不关中断；
+ *       只有当所有先前预留的区域都已提交后才会启动DMA发送
  */
 uint16_t DMA_Buffer_Manager_Input(
     DMA_Buffer_Manager * const Manager,
@@ -66,6 +205,44 @@ uint16_t DMA_Buffer_Manager_Input(
     uint16_t Data_Input_Length
 );
 	
+/**
+ * @brief 在缓冲区中预留可直接写入的区域（零拷贝写入）
+ * @param Manager 管理器实例
+ * @param Reserve_Length 请求预留的长度
+ * @param Span 输出预留得到的一段或两段可写区域
+ * @return 实际预留的字节数（空间不足时按处理策略可能小于请求长度，甚至为0）
+ * @note DMA_BLOCK策略下空间不足时先阻塞等待，DMA_OVERWRITE_OLDEST策略下丢弃最旧的未发送数据
+ *       返回值非0时必须把预留区域全部写满，并调用且只调用一次DMA_Buffer_Manager_Commit
+ *       不可在中断中调用
+ */
+uint16_t DMA_Buffer_Manager_Reserve(
+    DMA_Buffer_Manager * const Manager,
+    uint16_t Reserve_Length,
+    DMA_Buffer_Span * const Span
+);
+
+/**
+ * @brief 在缓冲区中整体预留一条记录（全部预留或全部放弃）
+ * @param Manager 管理器实例
+ * @param Reserve_Length 记录长度
+ * @param Span 输出预留得到的一段或两段可写区域
+ * @return Reserve_Length，空间不足（按处理策略等待或覆盖之后仍不足）时为0
+ * @note 与DMA_Buffer_Manager_Reserve相同，只是不会返回被截断的区域，
+ *       适用于日志行、二进制记录等截断后无法解析的数据
+ */
+uint16_t DMA_Buffer_Manager_ReserveRecord(
+    DMA_Buffer_Manager * const Manager,
+    uint16_t Reserve_Length,
+    DMA_Buffer_Span * const Span
+);
+
+/**
+ * @brief 提交由DMA_Buffer_Manager_Reserve/ReserveRecord预留的区域
+ * @param Manager 管理器实例
+ * @note 所有先前预留的区域都提交后才会启动DMA发送
+ */
+void DMA_Buffer_Manager_Commit(DMA_Buffer_Manager * const Manager);
+
 /**
  * @brief DMA传输完成中断处理程序
  * @param Manager 管理器实例
@@ -73,4 +250,19 @@ uint16_t DMA_Buffer_Manager_Input(
  */
 void DMA_Buffer_Manager_IRQHandler(DMA_Buffer_Manager * const Manager);
 
+/**
+ * @brief 按DMA通道把中断分发给已登记的管理器
+ * @param Select_DMA 产生中断的DMA通道
+ * @note 在DMAx_IRQHandler中清除标志后调用，通道未绑定管理器时直接返回
+ */
+void DMA_Buffer_Manager_Dispatch(DMA_TypeDef * const Select_DMA);
+
+/**
+ * @brief 查询DMA通道是否已绑定管理器
+ * @param Select_DMA DMA通道
+ * @return 已由DMA_Buffer_Manager_Initialize绑定返回1，否则返回0
+ * @note 供其他直接使用DMA通道的模块检查通道冲突
+ */
+uint8_t DMA_Buffer_Manager_IsBound(DMA_TypeDef * const Select_DMA);
+
 #endif // DMA_Buffer_Manager_H
@@ -0,0 +1,348 @@
+#include "DMA-Receive-Manager.h"
+#include <string.h>
+
+/**
+ * @brief DMA通道中断分发表，下标为DMA通道号
+ */
+static DMA_Receive_Manager * DMA_Receive_Manager_Table[DMA_BUFFER_MANAGER_CHANNELS];
+
+/**
+ * @brief DMA通道对应的中断号，下标为DMA通道号
+ */
+static const IRQn_Type DMA_Receive_Manager_IRQn[DMA_BUFFER_MANAGER_CHANNELS] = {
+	DMA0_IRQn,
+	DMA1_IRQn,
+#if defined (SC32f10xx)
+	DMA2_IRQn,
+	DMA3_IRQn,
+#endif
+};
+
+/**
+ * @brief 获取DMA通道号（内部函数）
+ * @param Select_DMA DMA通道
+ * @return 通道号，无效通道返回-1
+ */
+static int DMA_Receive_Manager_Channel(DMA_TypeDef * const Select_DMA)
+{
+	if (Select_DMA == DMA0) return 0;
+	if (Select_DMA == DMA1) return 1;
+#if defined (SC32f10xx)
+	if (Select_DMA == DMA2) return 2;
+	if (Select_DMA == DMA3) return 3;
+#endif
+	return -1;
+}
+
+/**
+ * @brief 按外设配置DMA通道并启动循环接收（内部函数）
+ * @param Manager 管理器实例
+ * @return 配置成功返回1，外设不支持DMA接收返回0
+ * @note 源地址为外设数据寄存器，目标为环形缓冲区，请求源为外设的RX请求
+ */
+static int DMA_Receive_Manager_Bind(DMA_Receive_Manager * const Manager)
+{
+	DMA_InitTypeDef DMA_InitStruct;
+	DMA_StructInit(&DMA_InitStruct);
+	DMA_InitStruct.DMA_SourceMode = DMA_SourceMode_FIXED;
+	DMA_InitStruct.DMA_TargetMode = DMA_TargetMode_INC;
+	DMA_InitStruct.DMA_DataSize = DMA_DataSize_Byte;
+	DMA_InitStruct.DMA_DstAddress = (uint32_t)Manager->_Buffer;
+	DMA_InitStruct.DMA_BufferSize = Manager->_Buffer_Length;
+	DMA_InitStruct.DMA_CircularMode = DMA_CircularMode_Enable; // 计数到0后自动从缓冲区起点重新开始
+	// 根据外设类型选择源地址与请求源
+	switch (Manager->_Peripheral_Type)
+	{
+		case DMA_UART:
+		{
+			UART_TypeDef * UARTx = (UART_TypeDef *)Manager->_Select_Peripheral;
+			if (UARTx == UART0) DMA_InitStruct.DMA_Request = DMA_Request_UART0_RX;
+			else if (UARTx == UART1) DMA_InitStruct.DMA_Request = DMA_Request_UART1_RX;
+			else return 0;
+			DMA_InitStruct.DMA_SrcAddress = (uint32_t)&UARTx->UART_DATA;
+			UART_DMACmd(UARTx, UART_DMAReq_RX, ENABLE);
+			UART_RXCmd(UARTx, ENABLE);
+			break;
+		}
+		case DMA_SPI:
+		{
+			SPI_TypeDef * SPIx = (SPI_TypeDef *)Manager->_Select_Peripheral;
+			if (SPIx == SPI0) DMA_InitStruct.DMA_Request = DMA_Request_SPI0_RX;
+			else if (SPIx == SPI1) DMA_InitStruct.DMA_Request = DMA_Request_SPI1_RX;
+			else return 0;
+			DMA_InitStruct.DMA_SrcAddress = (uint32_t)&SPIx->SPI_DATA;
+			SPI_DMACmd(SPIx, SPI_DMAReq_RX, ENABLE);
+			break;
+		}
+		case DMA_TWI:
+		{
+			TWI_TypeDef * TWIx = (TWI_TypeDef *)Manager->_Select_Peripheral;
+			if (TWIx == TWI0) DMA_InitStruct.DMA_Request = DMA_Request_TWI0_RX;
+			else return 0;
+			DMA_InitStruct.DMA_SrcAddress = (uint32_t)&TWIx->TWI_DATA;
+			TWI_DMACmd(TWIx, TWI_DMAReq_RX, ENABLE);
+			break;
+		}
+		default:
+			return 0;
+	}
+	RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA, ENABLE);
+	DMA_Init(Manager->_Select_DMA, &DMA_InitStruct);
+	DMA_ITConfig(Manager->_Select_DMA, DMA_IT_INTEN | DMA_IT_HTIE | DMA_IT_TCIE, ENABLE); // 每个半区结束时切分一次
+	DMA_ITConfig(Manager->_Select_DMA, DMA_IT_TEIE, DISABLE);
+	DMA_DMACmd(Manager->_Select_DMA, DMA_DMAReq_CHRQ, DISABLE);
+	NVIC_SetPriority(DMA_Receive_Manager_IRQn[DMA_Receive_Manager_Channel(Manager->_Select_DMA)], 3);
+	NVIC_EnableIRQ(DMA_Receive_Manager_IRQn[DMA_Receive_Manager_Channel(Manager->_Select_DMA)]);
+	DMA_Cmd(Manager->_Select_DMA, ENABLE);
+	DMA_SoftwareTrigger(Manager->_Select_DMA); // 与发送侧相同的启动顺序，此后由外设请求逐字节搬运
+	return 1;
+}
+
+/**
+ * @brief 获取DMA当前写入位置（内部函数）
+ * @param Manager 管理器实例
+ * @return 下一个字节将写入的位置
+ */
+static uint16_t DMA_Receive_Manager_Position(DMA_Receive_Manager * const Manager)
+{
+	uint16_t Position = Manager->_Buffer_Length - (uint16_t)DMA_GetCurrDataCounter(Manager->_Select_DMA);
+	return (Position >= Manager->_Buffer_Length) ? 0 : Position;
+}
+
+/**
+ * @brief 把缓冲区中的一段数据作为一帧放入消息缓冲区（内部函数）
+ * @param Manager 管理器实例
+ * @param End 帧结束位置（不包含），不小于帧起始位置
+ * @param Woken 输出是否唤醒了更高优先级的任务
+ */
+static void DMA_Receive_Manager_Emit(DMA_Receive_Manager * const Manager, uint16_t End, BaseType_t * const Woken)
+{
+	uint16_t Length = End - Manager->_Frame_Start;
+	if (Length == 0)
+	{
+		return;
+	}
+	if (xMessageBufferSendFromISR(Manager->_Frames,
+		(const void *)&Manager->_Buffer[Manager->_Frame_Start], Length, Woken) == Length)
+	{
+		Manager->_Statistics.Frames++;
+		Manager->_Statistics.Bytes += Length;
+	}
+	else
+	{
+		Manager->_Statistics.Dropped_Frames++;
+		Manager->_Statistics.Dropped_Bytes += Length;
+	}
+	Manager->_Frame_Start = (End >= Manager->_Buffer_Length) ? 0 : End;
+}
+
+/**
+ * @brief 提交帧起始位置到当前写入位置之间的数据（内部函数）
+ * @param Manager 管理器实例
+ * @param Position 当前写入位置
+ * @param Woken 输出是否唤醒了更高优先级的任务
+ * @note 跨越缓冲区末尾的数据拆成两帧，保证每帧在缓冲区中连续
+ */
+static void DMA_Receive_Manager_Flush(DMA_Receive_Manager * const Manager, uint16_t Position, BaseType_t * const Woken)
+{
+	if (Position < Manager->_Frame_Start)
+	{
+		DMA_Receive_Manager_Emit(Manager, Manager->_Buffer_Length, Woken);
+	}
+	DMA_Receive_Manager_Emit(Manager, Position, Woken);
+}
+
+/**
+ * @brief 初始化DMA接收管理器实现
+ * @param Manager 管理器实例
+ * @param Buffer_Length DMA环形缓冲区长度
+ * @param Frame_Buffer_Length 消息缓冲区长度
+ * @param Idle_Periods 判定空闲的定时器周期数
+ * @param Select_DMA 选定的DMA控制器
+ * @param Select_Peripheral 外设地址
+ * @param Peripheral_Type 外设类型
+ */
+void DMA_Receive_Manager_Initialize
+(
+    DMA_Receive_Manager * const Manager,
+    const uint16_t Buffer_Length,
+    const size_t Frame_Buffer_Length,
+    const uint16_t Idle_Periods,
+    DMA_TypeDef * const Select_DMA,
+	void * const Select_Peripheral,
+	DMA_Peripheral_Enum Peripheral_Type
+) {
+	// 参数有效性检查
+    if (
+        Manager == NULL || 								// 管理器指针有效性
+        Buffer_Length < 2 || 							// 至少两个半区
+		(Buffer_Length & 1) != 0 || 					// 半传输中断要求长度为偶数
+		Idle_Periods == 0 || 							// 空闲判定周期非零
+        (DMA_Receive_Manager_Channel(Select_DMA) < 0) 	// DMA通道有效性
+    )
+	{
+        while(1); // 参数错误进入死循环（需根据实际项目替换为错误处理）
+    }
+	Manager->_Buffer = (volatile uint8_t *)pvPortMalloc(Buffer_Length);
+	configASSERT(Manager->_Buffer); // 内存分配检查
+	Manager->_Frames = xMessageBufferCreate(Frame_Buffer_Length);
+	configASSERT(Manager->_Frames); // 资源创建检查
+	Manager->_Buffer_Length = Buffer_Length;
+	Manager->_Frame_Start = 0;
+	Manager->_Last_Position = 0;
+	Manager->_Idle_Count = 0;
+	Manager->_Idle_Periods = Idle_Periods;
+	memset(&Manager->_Statistics, 0, sizeof(Manager->_Statistics));
+    Manager->_Select_DMA = Select_DMA;
+	Manager->_Select_Peripheral = Select_Peripheral;
+	Manager->_Peripheral_Type = Peripheral_Type;
+	// 先登记再启动DMA，避免第一次半区中断找不到管理器
+	DMA_Receive_Manager_Table[DMA_Receive_Manager_Channel(Select_DMA)] = Manager;
+	if (!DMA_Receive_Manager_Bind(Manager))
+	{
+		while(1); // 外设不支持DMA接收
+	}
+}
+
+/**
+ * @brief 启动空闲检测定时器实现
+ * @param Select_TIM 定时器
+ * @param Period_Us 检测周期（微秒）
+ * @note 定时器向上计数到0xFFFF溢出后从重载值重新开始，64分频后每个计数为1微秒
+ */
+void DMA_Receive_Manager_StartTimer(TIM_TypeDef * const Select_TIM, const uint16_t Period_Us)
+{
+	IRQn_Type IRQn;
+	if (Select_TIM == TIM0) { RCC_APB0PeriphClockCmd(RCC_APB0Periph_TIM0, ENABLE); IRQn = TIMER0_IRQn; }
+	else if (Select_TIM == TIM1) { RCC_APB0PeriphClockCmd(RCC_APB0Periph_TIM1, ENABLE); IRQn = TIMER1_IRQn; }
+	else if (Select_TIM == TIM2) { RCC_APB0PeriphClockCmd(RCC_APB0Periph_TIM2, ENABLE); IRQn = TIMER2_IRQn; }
+	else if (Select_TIM == TIM3) { RCC_APB0PeriphClockCmd(RCC_APB0Periph_TIM3, ENABLE); IRQn = TIMER3_IRQn; }
+	else
+	{
+		while(1); // 只支持APB0上的定时器
+	}
+	if (Period_Us == 0)
+	{
+		while(1); // 参数错误
+	}
+	TIM_TimeBaseInitTypeDef TIM_TimeBaseInitStruct;
+	TIM_TimeBaseStructInit(&TIM_TimeBaseInitStruct);
+	TIM_TimeBaseInitStruct.TIM_Prescaler = TIM_PRESCALER_64; // APB0为64MHz（HCLK不分频）
+	TIM_TimeBaseInitStruct.TIM_WorkMode = TIM_WorkMode_Timer;
+	TIM_TimeBaseInitStruct.TIM_CounterMode = TIM_CounterMode_Up;
+	TIM_TimeBaseInitStruct.TIM_Preload = (uint16_t)(0x10000UL - Period_Us);
+	TIM_TIMBaseInit(Select_TIM, &TIM_TimeBaseInitStruct);
+	TIM_ClearFlag(Select_TIM, TIM_Flag_TI);
+	TIM_ITConfig(Select_TIM, TIM_IT_INTEN | TIM_IT_TI, ENABLE);
+	NVIC_SetPriority(IRQn, 3); // 与DMA中断同级
+	NVIC_EnableIRQ(IRQn);
+	TIM_Cmd(Select_TIM, ENABLE);
+}
+
+/**
+ * @brief 读取一帧数据实现
+ * @param Manager 管理器实例
+ * @param Buffer 接收缓冲区
+ * @param Buffer_Length 接收缓冲区长度
+ * @param Timeout 最长等待时间
+ * @return 帧长度
+ */
+size_t DMA_Receive_Manager_Receive
+(
+    DMA_Receive_Manager * const Manager,
+    void * const Buffer,
+    const size_t Buffer_Length,
+    TickType_t Timeout
+) {
+	return xMessageBufferReceive(Manager->_Frames, Buffer, Buffer_Length, Timeout);
+}
+
+/**
+ * @brief 读取接收统计信息实现
+ * @param Manager 管理器实例
+ * @param Statistics 输出统计信息
+ * @param Clear 非0时读取后清零
+ */
+void DMA_Receive_Manager_GetStatistics
+(
+    DMA_Receive_Manager * const Manager,
+    DMA_Receive_Statistics * const Statistics,
+    const uint8_t Clear
+) {
+	taskENTER_CRITICAL(); // 进入临界区
+	*Statistics = Manager->_Statistics;
+	if (Clear)
+	{
+		memset(&Manager->_Statistics, 0, sizeof(Manager->_Statistics));
+	}
+	taskEXIT_CRITICAL(); // 退出临界区
+}
+
+/**
+ * @brief DMA半传输/传输完成中断处理实现
+ * @param Manager 管理器实例
+ * @note 连续接收没有空闲间隔时，数据按半区为单位切分成帧，保证DMA追上之前被取走
+ */
+void DMA_Receive_Manager_IRQHandler(DMA_Receive_Manager * const Manager)
+{
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	uint16_t Position = DMA_Receive_Manager_Position(Manager);
+	DMA_Receive_Manager_Flush(Manager, Position, &xHigherPriorityTaskWoken);
+	Manager->_Last_Position = Position;
+	Manager->_Idle_Count = 0;
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/**
+ * @brief 按DMA通道分发中断实现
+ * @param Select_DMA 产生中断的DMA通道
+ */
+void DMA_Receive_Manager_Dispatch(DMA_TypeDef * const Select_DMA)
+{
+	int Channel = DMA_Receive_Manager_Channel(Select_DMA);
+	if ((Channel >= 0) && (DMA_Receive_Manager_Table[Channel] != NULL))
+	{
+		DMA_Receive_Manager_IRQHandler(DMA_Receive_Manager_Table[Channel]);
+	}
+}
+
+/**
+ * @brief 查询DMA通道是否已绑定接收管理器实现
+ * @param Select_DMA DMA通道
+ * @return 已绑定返回1，否则返回0
+ */
+uint8_t DMA_Receive_Manager_IsBound(DMA_TypeDef * const Select_DMA)
+{
+	int Channel = DMA_Receive_Manager_Channel(Select_DMA);
+	return (Channel >= 0) && (DMA_Receive_Manager_Table[Channel] != NULL);
+}
+
+/**
+ * @brief 空闲检测实现
+ */
+void DMA_Receive_Manager_Poll(void)
+{
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	for (int Channel = 0; Channel < DMA_BUFFER_MANAGER_CHANNELS; Channel++)
+	{
+		DMA_Receive_Manager * Manager = DMA_Receive_Manager_Table[Channel];
+		if (Manager == NULL)
+		{
+			continue;
+		}
+		uint16_t Position = DMA_Receive_Manager_Position(Manager);
+		if (Position != Manager->_Last_Position)
+		{
+			// 仍在接收，重新开始计时
+			Manager->_Last_Position = Position;
+			Manager->_Idle_Count = 0;
+		}
+		else if ((Position != Manager->_Frame_Start) && (++Manager->_Idle_Count >= Manager->_Idle_Periods))
+		{
+			// 线路空闲达到设定时间，当前帧结束
+			DMA_Receive_Manager_Flush(Manager, Position, &xHigherPriorityTaskWoken);
+			Manager->_Idle_Count = 0;
+		}
+	}
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
@@ -0,0 +1,131 @@
+/**
+ * @file DMA-Receive-Manager.h
+ * @brief DMA接收管理模块头文件
+ * @note DMA_Buffer_Manager的接收端：DMA以循环模式把外设数据持续写入环形缓冲区，
+ *       在半传输/传输完成中断以及定时器检测到的线路空闲时切分帧，
+ *       完成的帧放入FreeRTOS消息缓冲区，接收过程中不产生逐字节中断
+ */
+
+#ifndef DMA_Receive_Manager_H
+#define DMA_Receive_Manager_H
+
+#include "DMA-Buffer-Manager.h"
+#include "message_buffer.h"
+
+/**
+ * @struct DMA_Receive_Statistics
+ * @brief 接收统计信息
+ */
+typedef struct
+{
+    uint32_t             Frames;			   // 已放入消息缓冲区的帧数
+    uint32_t             Bytes;				   // 已放入消息缓冲区的字节数
+    uint32_t             Dropped_Frames;	   // 消息缓冲区空间不足被丢弃的帧数
+    uint32_t             Dropped_Bytes;		   // 消息缓冲区空间不足被丢弃的字节数
+} DMA_Receive_Statistics;
+
+/**
+ * @struct DMA_Receive_Manager
+ * @brief DMA接收管理器核心结构体
+ */
+typedef struct
+{
+    volatile uint8_t *   _Buffer;			   // DMA循环写入的环形缓冲区
+    uint16_t             _Buffer_Length;	   // 缓冲区总长度（必须为偶数）
+    volatile uint16_t    _Frame_Start;		   // 当前帧在缓冲区中的起始位置
+    volatile uint16_t    _Last_Position;	   // 上一次定时器检查时DMA的写入位置
+    volatile uint16_t    _Idle_Count;		   // 写入位置连续未变化的定时器周期数
+    uint16_t             _Idle_Periods;		   // 判定线路空闲所需的定时器周期数
+    DMA_TypeDef *      	 _Select_DMA;		   // 选定的DMA控制器
+    void *               _Select_Peripheral;   // 源外设地址
+	DMA_Peripheral_Enum  _Peripheral_Type;	   // 外设类型标识
+    MessageBufferHandle_t _Frames;			   // 完成的帧
+    DMA_Receive_Statistics _Statistics;		   // 接收统计信息
+} DMA_Receive_Manager;
+
+/**
+ * @brief 初始化DMA接收管理器并开始接收
+ * @param Manager 指向管理器实例的指针
+ * @param Buffer_Length DMA环形缓冲区长度（必须为偶数）
+ * @param Frame_Buffer_Length 消息缓冲区长度，每帧额外占用sizeof(size_t)字节
+ * @param Idle_Periods 写入位置连续多少个定时器周期不变时判定为一帧结束
+ * @param Select_DMA 选定的DMA通道（DMA0~DMA1，SC32f10xx为DMA0~DMA3）
+ * @param Select_Peripheral 源外设（UART0/UART1、SPI0/SPI1、TWI0）
+ * @param Peripheral_Type 外设类型枚举
+ * @note DMA通道按外设的RX请求重新配置，并打开外设的接收与DMA接收，
+ *       同一DMA通道不能同时绑定DMA_Buffer_Manager
+ *       半区中断的响应延迟必须小于外设填满半个缓冲区的时间，否则未取走的数据会被覆盖
+ */
+void DMA_Receive_Manager_Initialize(
+    DMA_Receive_Manager * const Manager,
+    const uint16_t Buffer_Length,
+    const size_t Frame_Buffer_Length,
+    const uint16_t Idle_Periods,
+    DMA_TypeDef * const Select_DMA,
+	void * const Select_Peripheral,
+	DMA_Peripheral_Enum Peripheral_Type
+);
+
+/**
+ * @brief 启动空闲检测定时器
+ * @param Select_TIM 定时器（TIM0~TIM3，时钟来自APB0）
+ * @param Period_Us 检测周期（微秒，1~65535）
+ * @note 定时器中断中需清除溢出标志并调用DMA_Receive_Manager_Poll，
+ *       中断优先级与DMA中断相同，两者不会互相抢占
+ */
+void DMA_Receive_Manager_StartTimer(TIM_TypeDef * const Select_TIM, const uint16_t Period_Us);
+
+/**
+ * @brief 读取一帧数据
+ * @param Manager 管理器实例
+ * @param Buffer 接收缓冲区
+ * @param Buffer_Length 接收缓冲区长度，小于帧长度时该帧保留在消息缓冲区中并返回0
+ * @param Timeout 最长等待时间（tick）
+ * @return 帧长度，超时返回0
+ */
+size_t DMA_Receive_Manager_Receive(
+    DMA_Receive_Manager * const Manager,
+    void * const Buffer,
+    const size_t Buffer_Length,
+    TickType_t Timeout
+);
+
+/**
+ * @brief 读取接收统计信息
+ * @param Manager 管理器实例
+ * @param Statistics 输出统计信息
+ * @param Clear 非0时读取后清零
+ */
+void DMA_Receive_Manager_GetStatistics(
+    DMA_Receive_Manager * const Manager,
+    DMA_Receive_Statistics * const Statistics,
+    const uint8_t Clear
+);
+
+/**
+ * @brief DMA半传输/传输完成中断处理程序，把已接收的数据作为一帧提交
+ * @param Manager 管理器实例
+ */
+void DMA_Receive_Manager_IRQHandler(DMA_Receive_Manager * const Manager);
+
+/**
+ * @brief 按DMA通道把中断分发给已登记的接收管理器
+ * @param Select_DMA 产生中断的DMA通道
+ * @note 在DMAx_IRQHandler中清除标志后调用，通道未绑定接收管理器时直接返回
+ */
+void DMA_Receive_Manager_Dispatch(DMA_TypeDef * const Select_DMA);
+
+/**
+ * @brief 查询DMA通道是否已绑定接收管理器
+ * @param Select_DMA DMA通道
+ * @return 已由DMA_Receive_Manager_Initialize绑定返回1，否则返回0
+ */
+uint8_t DMA_Receive_Manager_IsBound(DMA_TypeDef * const Select_DMA);
+
+/**
+ * @brief 空闲检测，在定时器中断中周期性调用
+ * @note 检查所有已登记的接收管理器，写入位置停止变化达到设定周期数时提交当前帧
+ */
+void DMA_Receive_Manager_Poll(void);
+
+#endif // DMA_Receive_Manager_H
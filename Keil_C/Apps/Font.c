@@ -0,0 +1,231 @@
+#include "Font.h"
+
+/**
+ * @struct Font_Decoder
+ * @brief 一个字形的解码位置，逐行解码时在行之间保存
+ */
+typedef struct
+{
+    const uint8_t *      Next;				   // 下一个未读取的字节
+    uint8_t              Low;				   // Next前一字节的低半字节尚未读取
+    uint8_t              Skip;				   // 当前段剩余的透明像素
+    uint8_t              Literal;			   // 当前段剩余的字面像素
+} Font_Decoder;
+
+static uint16_t Font_Buffer[2][FONT_BUFFER_PIXELS];   // 交替发送的行缓冲区
+static Font_Decoder Font_Decoders[FONT_LINE_GLYPHS];  // 各字形的解码位置
+static const Font_Glyph * Font_Line[FONT_LINE_GLYPHS]; // 参与绘制的字形
+static int16_t Font_Left[FONT_LINE_GLYPHS];           // 各字形位图左边在文字框中的列
+
+/**
+ * @brief 查找字符对应的字形（内部函数）
+ * @return 字形，字库中没有该字符也没有'?'时返回NULL
+ */
+static const Font_Glyph * Font_Lookup(const Font * F, char C)
+{
+	uint32_t Index = (uint32_t)(uint8_t)C - F->First;
+	if (Index >= F->Count)
+	{
+		Index = (uint32_t)'?' - F->First;
+		if (Index >= F->Count)
+		{
+			return NULL;
+		}
+	}
+	return &F->Glyphs[Index];
+}
+
+/**
+ * @brief 读取下一个半字节（内部函数）
+ */
+static uint8_t Font_Nibble(Font_Decoder * D)
+{
+	if (D->Low)
+	{
+		D->Low = 0;
+		return D->Next[-1] & 0x0F;
+	}
+	D->Low = 1;
+	return *D->Next++ >> 4;
+}
+
+/**
+ * @brief 解码字形的一行并写入文字框的行缓冲区（内部函数）
+ * @param D 解码状态
+ * @param Width 位图宽度
+ * @param Line 文字框中这一行的像素
+ * @param X 位图左边在文字框中的列（可为负）
+ * @param Limit 文字框宽度，0表示只跳过这一行
+ * @param Palette 透明度0~15对应的颜色
+ * @note 透明像素不写入，前一个字形伸到这里的墨迹得以保留
+ */
+static void Font_Decode_Row(Font_Decoder * D, uint16_t Width, uint16_t * Line, int32_t X, int32_t Limit,
+							const uint16_t * Palette)
+{
+	int32_t End = X + Width;
+	while (X < End)
+	{
+		if (D->Skip == 0 && D->Literal == 0)
+		{
+			D->Skip = Font_Nibble(D);
+			D->Literal = Font_Nibble(D);
+		}
+		else if (D->Skip != 0)
+		{
+			// 透明游程整段跳过
+			uint32_t Count = (uint32_t)(End - X);
+			if (Count > D->Skip)
+			{
+				Count = D->Skip;
+			}
+			D->Skip -= Count;
+			X += Count;
+		}
+		else
+		{
+			uint8_t Alpha = Font_Nibble(D);
+			D->Literal--;
+			if (Alpha != 0 && X >= 0 && X < Limit)
+			{
+				Line[X] = Palette[Alpha];
+			}
+			X++;
+		}
+	}
+}
+
+/**
+ * @brief 计算透明度0~15对应的颜色（内部函数）
+ * @note 每个字符串只计算一次，解码时按透明度查表，不逐像素混合
+ */
+static void Font_Palette(uint16_t * Palette, uint16_t Foreground, uint16_t Background)
+{
+	int32_t R = Background >> 11;
+	int32_t G = (Background >> 5) & 0x3F;
+	int32_t B = Background & 0x1F;
+	int32_t Delta_R = (int32_t)(Foreground >> 11) - R;
+	int32_t Delta_G = (int32_t)((Foreground >> 5) & 0x3F) - G;
+	int32_t Delta_B = (int32_t)(Foreground & 0x1F) - B;
+	for (int32_t Alpha = 0; Alpha < 16; Alpha++)
+	{
+		Palette[Alpha] = (uint16_t)(((R + Delta_R * Alpha / 15) << 11) |
+									((G + Delta_G * Alpha / 15) << 5) |
+									(B + Delta_B * Alpha / 15));
+	}
+}
+
+/**
+ * @brief 计算字符串宽度实现
+ * @param F 字库
+ * @param Text 字符串
+ * @return 宽度
+ */
+uint16_t Font_Measure(const Font * F, const char * Text)
+{
+	uint32_t Width = 0;
+	for (; *Text != '\0'; Text++)
+	{
+		const Font_Glyph * Glyph = Font_Lookup(F, *Text);
+		if (Glyph != NULL)
+		{
+			Width += Glyph->Advance;
+		}
+	}
+	return (Width > 0xFFFF) ? 0xFFFF : (uint16_t)Width;
+}
+
+/**
+ * @brief 绘制一行文字实现
+ * @param F 字库
+ * @param X 左上角列
+ * @param Y 左上角行
+ * @param Text 字符串
+ * @param Foreground 文字颜色
+ * @param Background 背景颜色
+ * @return 绘制的宽度
+ */
+uint16_t Font_Draw_String(const Font * F, uint16_t X, uint16_t Y, const char * Text,
+						  uint16_t Foreground, uint16_t Background)
+{
+	uint16_t Palette[16];
+	uint16_t Width = Font_Measure(F, Text);
+	uint16_t Height = F->Height;
+	uint8_t Count = 0;
+	int32_t Pen = 0;
+
+	// 裁剪到屏幕范围内
+	if (X >= ST7789_WIDTH || Y >= ST7789_HEIGHT || Width == 0)
+	{
+		return 0;
+	}
+	if (Width > ST7789_WIDTH - X)
+	{
+		Width = ST7789_WIDTH - X;
+	}
+	if (Height > ST7789_HEIGHT - Y)
+	{
+		Height = ST7789_HEIGHT - Y;
+	}
+
+	Font_Palette(Palette, Foreground, Background);
+
+	// 收集落在文字框内的字形，位图伸出行顶的部分先解码丢弃
+	for (; *Text != '\0' && Pen < Width && Count < FONT_LINE_GLYPHS; Text++)
+	{
+		const Font_Glyph * Glyph = Font_Lookup(F, *Text);
+		if (Glyph == NULL)
+		{
+			continue;
+		}
+		if (Glyph->Width != 0 && Glyph->Height != 0)
+		{
+			Font_Decoder * D = &Font_Decoders[Count];
+			D->Next = &F->Data[Glyph->Offset];
+			D->Low = 0;
+			D->Skip = 0;
+			D->Literal = 0;
+			for (int32_t Row = Glyph->Y_Offset; Row < 0 && Row < Glyph->Y_Offset + Glyph->Height; Row++)
+			{
+				Font_Decode_Row(D, Glyph->Width, NULL, 0, 0, Palette);
+			}
+			Font_Line[Count] = Glyph;
+			Font_Left[Count] = (int16_t)(Pen + Glyph->X_Offset);
+			Count++;
+		}
+		Pen += Glyph->Advance;
+	}
+
+	// 一个窗口写入整个文字框，行缓冲区装满若干行后发送，两个缓冲区交替使用
+	uint16_t Band_Rows = FONT_BUFFER_PIXELS / Width;
+	uint8_t Next = 0;
+	ST7789_SetWindow(X, Y, X + Width - 1, Y + Height - 1);
+	for (uint16_t Row = 0; Row < Height; Row += Band_Rows)
+	{
+		uint16_t Rows = (Height - Row < Band_Rows) ? Height - Row : Band_Rows;
+		uint16_t * Buffer = Font_Buffer[Next];
+		// 只允许另一个缓冲区仍在发送，这一个必须已被DMA读完
+		ST7789_Wait_Pixels(1);
+		for (uint16_t r = 0; r < Rows; r++)
+		{
+			uint16_t * Line = &Buffer[(uint32_t)r * Width];
+			for (uint16_t c = 0; c < Width; c++)
+			{
+				Line[c] = Palette[0];
+			}
+			for (uint8_t i = 0; i < Count; i++)
+			{
+				const Font_Glyph * Glyph = Font_Line[i];
+				int32_t Glyph_Row = (int32_t)(Row + r) - Glyph->Y_Offset;
+				if (Glyph_Row >= 0 && Glyph_Row < Glyph->Height)
+				{
+					Font_Decode_Row(&Font_Decoders[i], Glyph->Width, Line, Font_Left[i], Width, Palette);
+				}
+			}
+		}
+		ST7789_Write_Pixels(Buffer, (uint32_t)Width * Rows, 1);
+		Next ^= 1;
+	}
+	// 行缓冲区是本模块的静态变量，返回前等待全部读完
+	ST7789_Wait_Pixels(0);
+	return Width;
+}
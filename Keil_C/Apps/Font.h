@@ -0,0 +1,90 @@
+/**
+ * @file Font.h
+ * @brief 抗锯齿字库与文字绘制模块头文件
+ * @note 字库由Tools/font_convert.py从TTF/OTF/BDF生成，以常量存放在程序Flash中：
+ *       每个字形是裁剪后的4位透明度位图，透明像素游程编码，墨迹部分按半字节存放。
+ *       绘制时字形逐行解码进小的行缓冲区，一个字符串只设置一次ST7789窗口，
+ *       两个缓冲区交替由DMA发送，不需要整块文字的像素缓冲区
+ */
+
+#ifndef FONT_H
+#define FONT_H
+
+#include "ST7789.h"
+
+/**
+ * 每个行缓冲区的像素数（两个缓冲区共占4倍字节），不能小于屏幕宽度；
+ * 一次发送 FONT_BUFFER_PIXELS / 字符串宽度 行
+ */
+#ifndef FONT_BUFFER_PIXELS
+#define FONT_BUFFER_PIXELS     ST7789_WIDTH
+#endif
+
+/**
+ * 一个字符串中参与绘制的最多字形数（每个字形保存一份解码状态），超出的部分不绘制
+ */
+#ifndef FONT_LINE_GLYPHS
+#define FONT_LINE_GLYPHS       64
+#endif
+
+/**
+ * @struct Font_Glyph
+ * @brief 一个字形的度量与编码数据位置
+ * @note 编码数据是半字节流（高半字节在前）：每段为透明像素数S、字面像素数K（各0~15），
+ *       随后K个透明度（0~15），按行优先顺序覆盖Width*Height个像素，段可以跨行
+ */
+typedef struct
+{
+    uint32_t             Offset;			   // 编码数据在Font.Data中的起始位置
+    uint8_t              Width;				   // 位图宽度
+    uint8_t              Height;			   // 位图高度
+    int8_t               X_Offset;			   // 位图左边相对笔位置的偏移
+    int8_t               Y_Offset;			   // 位图顶边相对行顶的偏移
+    uint8_t              Advance;			   // 绘制后笔位置前进的距离
+} Font_Glyph;
+
+/**
+ * @struct Font
+ * @brief 字库
+ */
+typedef struct
+{
+    const uint8_t *      Data;				   // 全部字形的编码数据
+    const Font_Glyph *   Glyphs;			   // 字形表，按字符编码连续排列
+    uint16_t             First;				   // 第一个字形的字符编码
+    uint16_t             Count;				   // 字形个数
+    uint8_t              Height;			   // 行高
+    uint8_t              Ascent;			   // 行顶到基线的距离
+} Font;
+
+/**
+ * Tools/font_convert.py生成的字库
+ */
+extern const Font Font_Mono16;				   // Source Code Pro Regular 16px，ASCII 0x20~0x7E
+
+/**
+ * @brief 计算字符串的宽度
+ * @param F 字库
+ * @param Text 以0结尾的字符串
+ * @return 各字形前进距离之和（像素）
+ * @note 字库中没有的字符按'?'计算（字库中也没有'?'时忽略）
+ */
+uint16_t Font_Measure(const Font * F, const char * Text);
+
+/**
+ * @brief 在屏幕上绘制一行文字
+ * @param F 字库
+ * @param X 文字框左上角列
+ * @param Y 文字框左上角行
+ * @param Text 以0结尾的字符串，不处理换行
+ * @param Foreground 文字颜色（RGB565）
+ * @param Background 背景颜色（RGB565）
+ * @return 实际绘制的宽度（超出屏幕的部分被裁剪）
+ * @note 绘制Font_Measure宽、F->Height高的文字框，框内的背景一并写入；
+ *       边缘按透明度在前景与背景之间混合。返回时数据已被DMA读完（片选保持到ST7789_Release），
+ *       可以与Renderer_Flush在同一个任务中交替调用；需先调用ST7789_Initialize，不可重入
+ */
+uint16_t Font_Draw_String(const Font * F, uint16_t X, uint16_t Y, const char * Text,
+						  uint16_t Foreground, uint16_t Background);
+
+#endif // FONT_H
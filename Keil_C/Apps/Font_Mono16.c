@@ -0,0 +1,296 @@
+/**
+ * @file Font_Mono16.c
+ * @brief 字库：SourceCodePro-Regular.ttf 16px，字符0x20~0x7E，行高21像素
+ * @note 由Tools/font_convert.py生成，不要手工修改；
+ *       编码后2942字节（4位透明度未压缩为3550字节）
+ *       Source Code Pro: Copyright 2010, 2012 Adobe Systems Incorporated, SIL Open Font License 1.1
+ */
+
+#include "Font.h"
+
+static const uint8_t Font_Mono16_Data[2942] = {
+	0x1E, 0xD6, 0x0C, 0x60, 0xC6, 0x0C, 0x50, 0xB5, 0x18, 0xB5, 0x0A, 0x40, 0xA4, 0x36, 0x3E, 0xB3,
+	0xEB, 0x0E, 0xED, 0x03, 0xF8, 0xDC, 0x03, 0xF7, 0xCB, 0x15, 0x1F, 0x6A, 0x92, 0x4F, 0x48, 0x72,
+	0x2D, 0x20, 0x25, 0x85, 0x09, 0x43, 0xEB, 0x20, 0xB2, 0x04, 0xFF, 0xFF, 0xFF, 0x42, 0x1D, 0x21,
+	0xD3, 0x51, 0xC0, 0x2B, 0x35, 0x3A, 0x03, 0xA2, 0x79, 0xFF, 0xFF, 0xFF, 0x25, 0x67, 0x06, 0x63,
+	0x58, 0x50, 0x85, 0x35, 0xA3, 0x0A, 0x32, 0x00, 0x32, 0x96, 0x62, 0x96, 0x46, 0x2B, 0xFF, 0xB3,
+	0x2A, 0xD9, 0x11, 0x78, 0x02, 0xF2, 0x63, 0xEA, 0x15, 0x53, 0xDE, 0x92, 0x54, 0x6C, 0xF5, 0x63,
+	0x8F, 0x15, 0xA2, 0xF2, 0x6C, 0x41, 0x1A, 0xC2, 0x67, 0xCF, 0xEA, 0x24, 0x29, 0x66, 0x29, 0x63,
+	0x00, 0x14, 0x9E, 0xC2, 0x2F, 0x2B, 0x05, 0xB1, 0x6B, 0x01, 0xC6, 0x08, 0x71, 0x52, 0xD0, 0xA6,
+	0x27, 0x5B, 0x17, 0xB1, 0x64, 0x49, 0xEC, 0x27, 0x71, 0x60, 0x6E, 0xD5, 0x2F, 0x1B, 0x42, 0xD2,
+	0x3E, 0x01, 0xB7, 0x04, 0xB2, 0x4D, 0x24, 0x92, 0x51, 0xE2, 0x3E, 0x64, 0x6E, 0xD5, 0x10, 0x24,
+	0x3C, 0xE8, 0x65, 0xD6, 0x1E, 0x25, 0x5F, 0x20, 0xD3, 0x54, 0xE4, 0x7C, 0x64, 0x8E, 0xD2, 0x54,
+	0x2D, 0xF4, 0x22, 0x3C, 0x2F, 0xC9, 0x6D, 0x10, 0x89, 0x04, 0xF1, 0x0A, 0xC0, 0x72, 0xE3, 0x04,
+	0xF1, 0x23, 0xBF, 0xA2, 0x91, 0xDA, 0x12, 0xAE, 0xE7, 0x29, 0x2B, 0xEE, 0x91, 0x5C, 0x10, 0x0F,
+	0x1F, 0xA1, 0xFA, 0x0E, 0x80, 0xC6, 0x0B, 0x50, 0x32, 0x95, 0x27, 0x8C, 0x10, 0x3E, 0x12, 0x2C,
+	0x62, 0x32, 0xF1, 0x22, 0x7B, 0x32, 0x99, 0x32, 0xA8, 0x32, 0x99, 0x32, 0x7B, 0x33, 0x2F, 0x13,
+	0x2C, 0x63, 0x34, 0xE1, 0x33, 0x8C, 0x13, 0x29, 0x50, 0x02, 0xA3, 0x33, 0x4E, 0x33, 0x27, 0xC4,
+	0x2C, 0x63, 0x26, 0xB3, 0x32, 0xF1, 0x32, 0xF2, 0x32, 0xE4, 0x32, 0xF2, 0x23, 0x2F, 0x12, 0x26,
+	0xB3, 0x2C, 0x62, 0x27, 0xC2, 0x34, 0xE3, 0x22, 0xA3, 0x30, 0x32, 0x93, 0x62, 0xA4, 0x3F, 0x79,
+	0x4B, 0x66, 0xB2, 0x05, 0xCF, 0xF9, 0x33, 0x46, 0xCD, 0x13, 0x52, 0xD1, 0x6A, 0x32, 0x84, 0x22,
+	0xA2, 0x10, 0x32, 0x11, 0x62, 0xB5, 0x62, 0xB5, 0x62, 0xB5, 0x38, 0xAF, 0xFF, 0xFF, 0xF4, 0x32,
+	0xB5, 0x62, 0xB5, 0x62, 0xB5, 0x62, 0x11, 0x30, 0x08, 0x3E, 0xC1, 0x3E, 0xF5, 0x2C, 0xE3, 0x06,
+	0xD0, 0x7D, 0x20, 0x31, 0x20, 0x08, 0xAF, 0xFF, 0xFF, 0xF4, 0x0B, 0x3E, 0xA0, 0x7F, 0xF1, 0x3E,
+	0xA1, 0x00, 0x52, 0x5C, 0x52, 0xB7, 0x43, 0x2F, 0x14, 0x27, 0xB5, 0x2D, 0x54, 0x24, 0xE5, 0x29,
+	0x94, 0x31, 0xE3, 0x42, 0x5C, 0x52, 0xB7, 0x43, 0x2F, 0x14, 0x27, 0xB5, 0x2D, 0x54, 0x24, 0xE5,
+	0x00, 0x15, 0x3B, 0xFE, 0x82, 0xA1, 0xE8, 0x13, 0xC9, 0x08, 0xC3, 0x53, 0xF2, 0xB7, 0x4F, 0xE5,
+	0xD6, 0x1D, 0x90, 0xC7, 0xD6, 0x1D, 0x91, 0x4C, 0x7B, 0x84, 0x4E, 0x57, 0xC3, 0xA3, 0xF1, 0x1E,
+	0x81, 0x3D, 0x92, 0x53, 0xBF, 0xE8, 0x20, 0x14, 0x59, 0xDC, 0x44, 0x69, 0xCC, 0x62, 0x8C, 0x62,
+	0x8C, 0x62, 0x8C, 0x62, 0x8C, 0x62, 0x8C, 0x62, 0x8C, 0x62, 0x8C, 0x38, 0x7F, 0xFF, 0xFF, 0xF7,
+	0x06, 0x18, 0xDF, 0xC6, 0x29, 0x9B, 0x21, 0x4E, 0x60, 0x14, 0x28, 0xB6, 0x29, 0xB5, 0x31, 0xE5,
+	0x52, 0xBA, 0x53, 0xAC, 0x13, 0x41, 0xAC, 0x13, 0x41, 0xCB, 0x14, 0x8B, 0xFE, 0xFF, 0xFF, 0x50,
+	0x0F, 0x17, 0xDF, 0xD9, 0x10, 0x6B, 0x30, 0x3C, 0xB6, 0x27, 0xD4, 0x41, 0x6E, 0x63, 0x4B, 0xFF,
+	0x65, 0x41, 0x5D, 0x96, 0x43, 0xF2, 0x14, 0xF2, 0xF3, 0xD9, 0x20, 0x3B, 0xC0, 0x29, 0xDF, 0x03,
+	0xD8, 0x11, 0x00, 0x53, 0xAF, 0x25, 0x48, 0x9F, 0x24, 0x55, 0xC2, 0xF2, 0x36, 0x3D, 0x22, 0xF2,
+	0x27, 0x1D, 0x40, 0x2F, 0x22, 0x2C, 0x72, 0xD2, 0xF2, 0x05, 0xFF, 0xFF, 0xFF, 0xFB, 0x53, 0x2F,
+	0x26, 0x32, 0xF2, 0x63, 0x2F, 0x21, 0x00, 0x1A, 0xFF, 0xFF, 0xFD, 0x01, 0xF3, 0x53, 0x2F, 0x15,
+	0x23, 0xF6, 0x73, 0xFF, 0xFE, 0xA2, 0x21, 0x12, 0x42, 0xBD, 0x15, 0x31, 0xF5, 0x5F, 0x2F, 0x4C,
+	0x82, 0x03, 0xCC, 0x03, 0xAD, 0xF0, 0x3D, 0x81, 0x10, 0x2F, 0x7D, 0xFD, 0x81, 0x0A, 0xC3, 0x13,
+	0x91, 0x40, 0x2F, 0x25, 0x28, 0xA6, 0xFB, 0x87, 0xDE, 0xC5, 0x0B, 0xE7, 0x11, 0x6F, 0x03, 0x3A,
+	0x94, 0x4C, 0x76, 0xD4, 0xFC, 0x71, 0xD9, 0x21, 0x7E, 0x20, 0x1A, 0xEE, 0x02, 0xB2, 0x10, 0x08,
+	0xDF, 0xFF, 0xFF, 0xF7, 0x53, 0x6C, 0x14, 0x32, 0xE2, 0x52, 0xB8, 0x53, 0x3E, 0x15, 0x29, 0xA6,
+	0x2D, 0x65, 0x32, 0xF3, 0x53, 0x3F, 0x15, 0x25, 0xF4, 0x00, 0x1E, 0x4C, 0xEE, 0x91, 0x02, 0xF6,
+	0x11, 0x9B, 0x13, 0x2F, 0x12, 0x22, 0xF2, 0x66, 0xB5, 0x1A, 0xC2, 0xE7, 0xFF, 0xFD, 0x20, 0x7E,
+	0x62, 0x8C, 0x51, 0x2C, 0x73, 0x52, 0xE3, 0xC6, 0x4F, 0xD7, 0x6D, 0x41, 0x17, 0xF3, 0x05, 0xCE,
+	0xE0, 0x2B, 0x41, 0x00, 0x15, 0x6C, 0xFD, 0x62, 0xA6, 0xE4, 0x14, 0xD8, 0x0D, 0x63, 0x54, 0xE1,
+	0xD6, 0x4F, 0xF4, 0x8D, 0x30, 0x3A, 0xF6, 0x18, 0xDF, 0xB0, 0x33, 0xE5, 0x53, 0x1F, 0x25, 0xF7,
+	0xD0, 0x47, 0x21, 0x6E, 0x40, 0x3A, 0xEE, 0x02, 0xB4, 0x20, 0x0B, 0x3E, 0xA0, 0x7F, 0xF1, 0x3E,
+	0xAD, 0xB3, 0xEA, 0x07, 0xFF, 0x13, 0xEA, 0x10, 0x0B, 0x3E, 0xA0, 0x7F, 0xF1, 0x3E, 0xAF, 0x02,
+	0x83, 0xEC, 0x13, 0xEF, 0x52, 0xCE, 0x30, 0x6D, 0x07, 0xD2, 0x03, 0x12, 0x00, 0x52, 0x29, 0x43,
+	0x6D, 0x42, 0x42, 0xBB, 0x12, 0x36, 0xE7, 0x33, 0x1F, 0x65, 0x36, 0xE7, 0x54, 0x2B, 0xB1, 0x53,
+	0x6D, 0x45, 0x22, 0x90, 0x08, 0xAF, 0xFF, 0xFF, 0xF4, 0xF0, 0x98, 0xAF, 0xFF, 0xFF, 0xF4, 0x02,
+	0x47, 0x63, 0x8C, 0x25, 0x34, 0xD7, 0x54, 0x1B, 0xC2, 0x52, 0xBA, 0x34, 0x1B, 0xC2, 0x23, 0x4D,
+	0x73, 0x38, 0xC2, 0x32, 0x47, 0x50, 0x1D, 0x5C, 0xFD, 0x60, 0x1B, 0x51, 0x4E, 0x55, 0x2A, 0x95,
+	0x2C, 0x74, 0x37, 0xE1, 0x33, 0x5E, 0x34, 0x2E, 0x64, 0x32, 0xF1, 0xB3, 0x6E, 0x84, 0x35, 0xE8,
+	0x20, 0x26, 0x18, 0xDF, 0xD4, 0x3A, 0xCA, 0x21, 0x4E, 0x20, 0x7B, 0x45, 0x78, 0x0D, 0x34, 0x43,
+	0xA2, 0xE2, 0xF1, 0x6B, 0xEB, 0x3C, 0x01, 0xD9, 0x45, 0xB3, 0x04, 0xC0, 0x6B, 0x2E, 0x4B, 0x1E,
+	0x04, 0xD1, 0x2C, 0xB0, 0xD4, 0x18, 0x9E, 0xC3, 0x90, 0x6B, 0x86, 0xBA, 0x30, 0x28, 0x45, 0x7D,
+	0xEC, 0x61, 0x00, 0x33, 0x2F, 0xB6, 0x47, 0xAF, 0x15, 0x4B, 0x6C, 0x54, 0x51, 0xF2, 0x9A, 0x46,
+	0x6D, 0x05, 0xE1, 0x36, 0xB9, 0x01, 0xF5, 0x23, 0x1F, 0x52, 0x2C, 0xA2, 0x75, 0xFF, 0xFF, 0xFE,
+	0x22, 0xAB, 0x36, 0x2F, 0x41, 0xE6, 0x45, 0xC9, 0x5F, 0x14, 0x27, 0xE0, 0x0A, 0x5F, 0xFF, 0xD9,
+	0x10, 0x5F, 0x26, 0x3B, 0xC0, 0x5F, 0x35, 0x4F, 0x15, 0xF3, 0x54, 0xF1, 0x5F, 0x2E, 0x3C, 0x80,
+	0x5F, 0xFF, 0xFB, 0x20, 0x5F, 0x26, 0x16, 0xE4, 0x5F, 0x44, 0xAA, 0x5F, 0x44, 0xBA, 0x5F, 0x2B,
+	0x27, 0xF4, 0x5F, 0xFF, 0xEB, 0x41, 0x00, 0x2F, 0x6C, 0xFE, 0x91, 0x09, 0xD4, 0x02, 0xA4, 0x40,
+	0x2F, 0x35, 0x2A, 0xB6, 0x2D, 0x86, 0x2E, 0x76, 0x2D, 0x86, 0x2A, 0xB6, 0x34, 0xF3, 0x67, 0x9E,
+	0x50, 0x2A, 0x92, 0x66, 0xDF, 0xE9, 0x10, 0x06, 0xAF, 0xFE, 0xC6, 0x2A, 0xAA, 0x01, 0x6E, 0x80,
+	0xAA, 0x35, 0x4F, 0x3A, 0xA4, 0x4D, 0x8A, 0xA4, 0x4A, 0xBA, 0xA4, 0x49, 0xBA, 0xA4, 0x4B, 0xBA,
+	0xA4, 0x4D, 0x8A, 0xA3, 0xF5, 0xF3, 0xAA, 0x01, 0x6E, 0x80, 0xAF, 0xFE, 0x02, 0xC5, 0x20, 0x0B,
+	0x2F, 0xFF, 0xFF, 0xF5, 0x2F, 0x35, 0x32, 0xF3, 0x53, 0x2F, 0x35, 0x32, 0xF3, 0x5B, 0x2F, 0xFF,
+	0xFF, 0x80, 0x2F, 0x35, 0x32, 0xF3, 0x53, 0x2F, 0x35, 0x32, 0xF3, 0x58, 0x2F, 0xFF, 0xFF, 0xF7,
+	0x09, 0xDF, 0xFF, 0xFF, 0x9D, 0x75, 0x2D, 0x75, 0x2D, 0x75, 0x2D, 0x75, 0x9D, 0xFF, 0xFF, 0xC0,
+	0xD7, 0x52, 0xD7, 0x52, 0xD7, 0x52, 0xD7, 0x52, 0xD7, 0x50, 0x26, 0x18, 0xDF, 0xD8, 0x2C, 0x1C,
+	0xC3, 0x03, 0xB2, 0x08, 0xE1, 0x62, 0xD8, 0x63, 0x1F, 0x56, 0x32, 0xF4, 0x27, 0xCF, 0xF8, 0x1F,
+	0x54, 0x5B, 0x80, 0xD8, 0x46, 0xB8, 0x08, 0xE1, 0x3B, 0xB8, 0x01, 0xCC, 0x31, 0x4D, 0x72, 0x61,
+	0x8D, 0xFD, 0x71, 0x00, 0x02, 0xB9, 0x44, 0xF5, 0xB9, 0x44, 0xF5, 0xB9, 0x44, 0xF5, 0xB9, 0x44,
+	0xF5, 0xB9, 0x4C, 0xF5, 0xBF, 0xFF, 0xFF, 0xF5, 0xB9, 0x44, 0xF5, 0xB9, 0x44, 0xF5, 0xB9, 0x44,
+	0xF5, 0xB9, 0x44, 0xF5, 0xB9, 0x42, 0xF5, 0x08, 0x7F, 0xFF, 0xFF, 0xF1, 0x32, 0xD7, 0x62, 0xD7,
+	0x62, 0xD7, 0x62, 0xD7, 0x62, 0xD7, 0x62, 0xD7, 0x62, 0xD7, 0x62, 0xD7, 0x62, 0xD7, 0x38, 0x7F,
+	0xFF, 0xFF, 0xF1, 0x16, 0xDF, 0xFF, 0xFD, 0x52, 0x7D, 0x52, 0x7D, 0x52, 0x7D, 0x52, 0x7D, 0x52,
+	0x7D, 0x52, 0x7D, 0x54, 0x7D, 0x02, 0x3F, 0x9B, 0x7D, 0x31, 0x4E, 0x50, 0x8D, 0xFD, 0x71, 0x00,
+	0x02, 0x7E, 0x36, 0x2E, 0x70, 0x7E, 0x32, 0xCA, 0x22, 0x7E, 0x23, 0x9D, 0x12, 0x67, 0xE0, 0x6E,
+	0x33, 0x57, 0xE4, 0xFB, 0x46, 0x7E, 0xEA, 0xF4, 0x36, 0x7F, 0xA0, 0x9C, 0x37, 0x7E, 0x10, 0x2F,
+	0x52, 0x27, 0xE3, 0x28, 0xD2, 0x27, 0xE3, 0x61, 0xE7, 0x07, 0xE4, 0x37, 0xE1, 0x02, 0xD7, 0x52,
+	0xD7, 0x52, 0xD7, 0x52, 0xD7, 0x52, 0xD7, 0x52, 0xD7, 0x52, 0xD7, 0x52, 0xD7, 0x52, 0xD7, 0x52,
+	0xD7, 0x57, 0xDF, 0xFF, 0xFF, 0xA0, 0x02, 0xBE, 0x36, 0x5F, 0x4B, 0xD3, 0x26, 0x9D, 0x4B, 0x97,
+	0x2F, 0xBC, 0x4B, 0x6B, 0x03, 0x9C, 0x4B, 0x6A, 0x10, 0xF7, 0x4C, 0x4B, 0x66, 0x5A, 0x0C, 0x4B,
+	0x61, 0x0F, 0xA9, 0x0C, 0x4B, 0x60, 0xB5, 0x0C, 0x4B, 0x64, 0x4C, 0x4B, 0x64, 0x4C, 0x4B, 0x64,
+	0x2C, 0x40, 0x02, 0xAE, 0x45, 0xF4, 0xAC, 0x63, 0x5F, 0x4A, 0x8D, 0x36, 0xF4, 0xA8, 0xA6, 0x26,
+	0xF4, 0xA9, 0x4D, 0x2F, 0xF4, 0xA9, 0x0C, 0x60, 0xF4, 0xA9, 0x05, 0xD1, 0x4F, 0x4A, 0x92, 0x6C,
+	0x4E, 0x4A, 0x92, 0x65, 0xAE, 0x4A, 0x93, 0x5C, 0xD4, 0xA9, 0x33, 0x5F, 0x40, 0x25, 0x3B, 0xEE,
+	0x83, 0x72, 0xE8, 0x12, 0xCA, 0x22, 0xAB, 0x36, 0x2F, 0x40, 0xF6, 0x45, 0xC9, 0x3F, 0x44, 0x5A,
+	0xB3, 0xF2, 0x45, 0x9C, 0x2F, 0x44, 0x5A, 0xB0, 0xF6, 0x45, 0xC9, 0x0A, 0xC3, 0xB3, 0xF4, 0x02,
+	0xE8, 0x12, 0xCA, 0x35, 0x3B, 0xEE, 0x82, 0x00, 0x0A, 0x6F, 0xFF, 0xEB, 0x40, 0x6E, 0x26, 0x17,
+	0xF4, 0x6E, 0x44, 0xB9, 0x6E, 0x44, 0xAA, 0x6E, 0x44, 0xC9, 0x6E, 0x2E, 0x28, 0xE2, 0x6F, 0xFF,
+	0xEB, 0x30, 0x6E, 0x62, 0x6E, 0x62, 0x6E, 0x62, 0x6E, 0x60, 0x25, 0x3B, 0xED, 0x83, 0x72, 0xE8,
+	0x13, 0xCA, 0x22, 0xAB, 0x36, 0x3F, 0x30, 0xF6, 0x45, 0xD8, 0x2F, 0x44, 0x5A, 0xA3, 0xF2, 0x45,
+	0x9B, 0x2F, 0x44, 0x5B, 0xA0, 0xE6, 0x45, 0xD8, 0x09, 0xC3, 0xB3, 0xF2, 0x02, 0xE8, 0x13, 0xD9,
+	0x35, 0x3C, 0xFE, 0x96, 0x2A, 0xB7, 0x52, 0xE8, 0x11, 0x54, 0x3C, 0xEA, 0x0A, 0x6F, 0xFF, 0xEB,
+	0x40, 0x6E, 0x26, 0x17, 0xF3, 0x6E, 0x44, 0xD7, 0x6E, 0x44, 0xE7, 0x6E, 0x2E, 0x29, 0xF2, 0x6F,
+	0xFF, 0xFB, 0x30, 0x6E, 0x13, 0x1E, 0x82, 0x26, 0xE2, 0x67, 0xE1, 0x06, 0xE2, 0x61, 0xE8, 0x06,
+	0xE3, 0x57, 0xE1, 0x6E, 0x42, 0xD9, 0x1F, 0x2A, 0xEE, 0xC4, 0x01, 0xE8, 0x11, 0x5B, 0x10, 0x25,
+	0xF6, 0x34, 0xF4, 0x64, 0xBF, 0x93, 0x55, 0x6D, 0xFB, 0x35, 0x44, 0xCE, 0x25, 0x51, 0xE8, 0x11,
+	0x4F, 0xD8, 0xAD, 0x41, 0x18, 0xE2, 0x18, 0xCF, 0xE0, 0x2A, 0x31, 0x00, 0x09, 0x5F, 0xFF, 0xFF,
+	0xFF, 0xE4, 0x2D, 0x77, 0x2D, 0x77, 0x2D, 0x77, 0x2D, 0x77, 0x2D, 0x77, 0x2D, 0x77, 0x2D, 0x77,
+	0x2D, 0x77, 0x2D, 0x77, 0x2D, 0x73, 0x00, 0x02, 0xB9, 0x44, 0xE5, 0xB9, 0x44, 0xE5, 0xB9, 0x44,
+	0xE5, 0xB9, 0x44, 0xE5, 0xB9, 0x44, 0xE5, 0xB9, 0x44, 0xE5, 0xB9, 0x44, 0xE5, 0xAA, 0x44, 0xF4,
+	0x8D, 0x3A, 0x3F, 0x22, 0xE8, 0x12, 0xCA, 0x26, 0x4B, 0xED, 0x91, 0x10, 0x03, 0x2F, 0x34, 0x59,
+	0xB0, 0xD8, 0x45, 0xD7, 0x08, 0xC3, 0x72, 0xF2, 0x04, 0xF1, 0x22, 0x6D, 0x32, 0xE5, 0x22, 0xA8,
+	0x32, 0xA9, 0x22, 0xE4, 0x35, 0x5D, 0x03, 0xE4, 0x51, 0xF2, 0x7A, 0x54, 0xB6, 0xB5, 0x54, 0x6A,
+	0xE1, 0x53, 0x2F, 0xB3, 0x00, 0x02, 0xC8, 0x64, 0xD5, 0x9A, 0x64, 0xF3, 0x7C, 0x55, 0x2F, 0x15,
+	0xE2, 0xFB, 0x70, 0x3E, 0x03, 0xF0, 0x1B, 0xB0, 0x5C, 0x19, 0x1F, 0x24, 0x7D, 0x07, 0xA2, 0x8D,
+	0x48, 0x4A, 0x48, 0x82, 0x8B, 0x5C, 0x17, 0x8A, 0x62, 0x89, 0x7C, 0x03, 0xBB, 0x42, 0x37, 0xC9,
+	0x23, 0xDC, 0x12, 0x34, 0xF5, 0x22, 0xBE, 0x20, 0x02, 0xAC, 0x36, 0x2F, 0x42, 0xF5, 0x22, 0xAB,
+	0x26, 0x8D, 0x02, 0xF3, 0x25, 0x1E, 0x6A, 0x94, 0x47, 0xEE, 0x24, 0x32, 0xFB, 0x54, 0xAB, 0xF3,
+	0x35, 0x3F, 0x29, 0xC3, 0xAB, 0x90, 0x2E, 0x50, 0x5E, 0x22, 0x58, 0xD0, 0xD8, 0x33, 0x1E, 0x70,
+	0x03, 0x2F, 0x44, 0x59, 0xB0, 0xAB, 0x37, 0x2F, 0x40, 0x2F, 0x32, 0x28, 0xB3, 0x6A, 0xB0, 0x1E,
+	0x43, 0x52, 0xF3, 0x8B, 0x54, 0xAA, 0xE4, 0x53, 0x3F, 0xB7, 0x2D, 0x77, 0x2D, 0x77, 0x2D, 0x77,
+	0x2D, 0x73, 0x00, 0x08, 0x7F, 0xFF, 0xFF, 0xF8, 0x53, 0x6E, 0x14, 0x31, 0xE6, 0x52, 0xAB, 0x53,
+	0x4F, 0x24, 0x31, 0xD8, 0x52, 0x8D, 0x53, 0x3F, 0x45, 0x2C, 0x95, 0x36, 0xE1, 0x58, 0xEF, 0xFF,
+	0xFF, 0xF9, 0x07, 0x6F, 0xFF, 0xF6, 0xA3, 0x26, 0xA3, 0x26, 0xA3, 0x26, 0xA3, 0x26, 0xA3, 0x26,
+	0xA3, 0x26, 0xA3, 0x26, 0xA3, 0x26, 0xA3, 0x26, 0xA3, 0x26, 0xA3, 0x26, 0xA3, 0x56, 0xFF, 0xFF,
+	0x02, 0x4E, 0x62, 0xD5, 0x52, 0x7B, 0x53, 0x2F, 0x15, 0x2B, 0x75, 0x25, 0xC5, 0x31, 0xE3, 0x52,
+	0x99, 0x52, 0x4E, 0x62, 0xD5, 0x52, 0x7B, 0x53, 0x2F, 0x15, 0x2B, 0x75, 0x25, 0xC0, 0x05, 0x6F,
+	0xFF, 0xF3, 0x21, 0xF3, 0x21, 0xF3, 0x21, 0xF3, 0x21, 0xF3, 0x21, 0xF3, 0x21, 0xF3, 0x21, 0xF3,
+	0x21, 0xF3, 0x21, 0xF3, 0x21, 0xF3, 0x21, 0xF3, 0x71, 0xF6, 0xFF, 0xFF, 0x23, 0x1E, 0x94, 0x46,
+	0xBE, 0x13, 0x4C, 0x4A, 0x62, 0x53, 0xD0, 0x4C, 0x22, 0x98, 0x25, 0xD3, 0x1E, 0x22, 0x28, 0x90,
+	0x09, 0x1F, 0xFF, 0xFF, 0xFF, 0xA0, 0x02, 0x9B, 0x22, 0xA7, 0x1E, 0x6B, 0xEE, 0xB2, 0x02, 0xB4,
+	0x12, 0xBC, 0x6F, 0x3F, 0x20, 0x16, 0xAD, 0xEF, 0x33, 0xEA, 0x50, 0x62, 0x2F, 0x4A, 0xB3, 0xF1,
+	0xF4, 0x8D, 0x20, 0x4C, 0xF4, 0x1A, 0xEE, 0x04, 0xA3, 0xD4, 0x02, 0x8C, 0x62, 0x8C, 0x62, 0x8C,
+	0x6F, 0x8C, 0x5D, 0xFC, 0x30, 0x8F, 0x92, 0x19, 0xE0, 0x31, 0x8C, 0x44, 0xE7, 0x8C, 0x44, 0xB9,
+	0x8C, 0x44, 0xC9, 0x8C, 0x3F, 0x1F, 0x58, 0xF7, 0x12, 0xBC, 0x08, 0x97, 0xE0, 0x3E, 0xA1, 0x10,
+	0x1F, 0x17, 0xDF, 0xD8, 0x10, 0xBC, 0x41, 0x3A, 0x20, 0x36, 0xE2, 0x52, 0xAB, 0x62, 0xAB, 0x63,
+	0x7E, 0x16, 0xFC, 0xC4, 0x12, 0x95, 0x01, 0x8D, 0xFD, 0x81, 0x53, 0x3F, 0x25, 0x33, 0xF2, 0x5F,
+	0x3F, 0x20, 0x4C, 0xFC, 0x6F, 0x24, 0xF7, 0x10, 0x63, 0xBF, 0x2C, 0xA3, 0x53, 0xF2, 0xF6, 0x35,
+	0x3F, 0x2F, 0x63, 0x53, 0xF2, 0xC9, 0x3F, 0x3F, 0x26, 0xE5, 0x13, 0xCF, 0x20, 0x6D, 0xF0, 0x4B,
+	0x2F, 0x20, 0x1F, 0x2A, 0xEE, 0xB3, 0x01, 0xD7, 0x11, 0x6E, 0x10, 0x29, 0xA4, 0xCB, 0x7D, 0xFF,
+	0xFF, 0xFF, 0x9D, 0x86, 0x29, 0xD6, 0x71, 0xEB, 0x31, 0x38, 0x27, 0x29, 0xEE, 0xC7, 0x10, 0x36,
+	0x3B, 0xEE, 0xC1, 0x35, 0xD9, 0x10, 0x33, 0x32, 0xF3, 0x48, 0x5E, 0xFF, 0xFF, 0xF7, 0x33, 0x2F,
+	0x36, 0x32, 0xF3, 0x63, 0x2F, 0x36, 0x32, 0xF3, 0x63, 0x2F, 0x36, 0x32, 0xF3, 0x63, 0x2F, 0x34,
+	0x00, 0x1E, 0x4C, 0xFF, 0xFF, 0xF2, 0xF6, 0x13, 0xE4, 0x12, 0x5E, 0x3A, 0x99, 0x02, 0xE6, 0x13,
+	0xE6, 0x25, 0xAC, 0xFD, 0x72, 0x24, 0xD6, 0x34, 0xE2, 0x69, 0xCE, 0xFF, 0xFD, 0x69, 0x84, 0xF7,
+	0xFB, 0xA2, 0x01, 0x4B, 0xB2, 0xAD, 0xFE, 0x02, 0xC6, 0x10, 0x02, 0x8C, 0x62, 0x8C, 0x62, 0x8C,
+	0x6F, 0x8C, 0x2B, 0xED, 0x50, 0x8D, 0xB3, 0x18, 0xF0, 0x41, 0x8D, 0x13, 0x4F, 0x48, 0xC4, 0x4E,
+	0x68, 0xC4, 0x4E, 0x68, 0xC4, 0x4E, 0x68, 0xC4, 0x4E, 0x68, 0xC4, 0x2E, 0x60, 0x33, 0x4E, 0x63,
+	0x34, 0xE6, 0xC6, 0x8F, 0xFF, 0xF6, 0x42, 0xE6, 0x42, 0xE6, 0x42, 0xE6, 0x42, 0xE6, 0x42, 0xE6,
+	0x42, 0xE6, 0x42, 0xE6, 0x33, 0x4E, 0x63, 0x34, 0xE6, 0xC6, 0x8F, 0xFF, 0xF6, 0x42, 0xE6, 0x42,
+	0xE6, 0x42, 0xE6, 0x42, 0xE6, 0x42, 0xE6, 0x42, 0xE6, 0x42, 0xE6, 0x4D, 0xF4, 0x41, 0x18, 0xE1,
+	0xBE, 0xFC, 0x31, 0x00, 0x02, 0x4F, 0x62, 0x4F, 0x62, 0x4F, 0x62, 0x4F, 0x35, 0x4E, 0x54, 0xF2,
+	0xA3, 0xE6, 0x04, 0xF0, 0x2E, 0x82, 0x54, 0xF2, 0xDD, 0x36, 0x4F, 0xD8, 0xD7, 0x2A, 0x4F, 0x30,
+	0x3F, 0x40, 0x4F, 0x35, 0x7E, 0x24, 0xF4, 0x2A, 0xC0, 0x05, 0xBF, 0xFF, 0x45, 0x31, 0xF4, 0x53,
+	0x1F, 0x45, 0x31, 0xF4, 0x53, 0x1F, 0x45, 0x31, 0xF4, 0x53, 0x1F, 0x45, 0x31, 0xF4, 0x62, 0xF4,
+	0x65, 0xCA, 0x12, 0x23, 0x53, 0xCF, 0xD5, 0x0F, 0x1F, 0x6E, 0xD3, 0xCE, 0x41, 0xF9, 0x1C, 0xC0,
+	0xF2, 0x9C, 0x1F, 0x30, 0x97, 0x06, 0xD1, 0xF3, 0x1F, 0x97, 0x06, 0xD1, 0xF3, 0x09, 0x70, 0x6D,
+	0x10, 0xEF, 0x30, 0x97, 0x06, 0xD1, 0xF3, 0x09, 0x71, 0xB6, 0xD1, 0xF3, 0x09, 0x70, 0x6D, 0x0F,
+	0x89, 0x2B, 0xED, 0x50, 0x8D, 0xB3, 0x18, 0xF0, 0x41, 0x8D, 0x13, 0x4F, 0x48, 0xC4, 0x4E, 0x68,
+	0xC4, 0x4E, 0x68, 0xC4, 0x4E, 0x68, 0xC4, 0x4E, 0x68, 0xC4, 0x2E, 0x60, 0x1E, 0x3B, 0xFE, 0x81,
+	0x03, 0xF7, 0x12, 0xBC, 0x12, 0xCA, 0x35, 0x2F, 0x5F, 0x64, 0x4C, 0x9F, 0x64, 0x4C, 0x9C, 0xA3,
+	0xA1, 0xF6, 0x3F, 0x71, 0x2B, 0xC2, 0x63, 0xBF, 0xE9, 0x11, 0x00, 0x0F, 0x89, 0x5D, 0xFC, 0x30,
+	0x8F, 0x92, 0x19, 0xE0, 0x31, 0x8C, 0x44, 0xE7, 0x8C, 0x44, 0xB9, 0x8C, 0x44, 0xC9, 0x8C, 0x3F,
+	0x1E, 0x58, 0xF7, 0x12, 0xBC, 0x08, 0xC7, 0xD0, 0x6E, 0xA1, 0x08, 0xC6, 0x28, 0xC6, 0x28, 0xC6,
+	0x00, 0x1F, 0x4C, 0xFC, 0x4F, 0x24, 0xF7, 0x13, 0xBF, 0x20, 0x2C, 0xA3, 0x53, 0xF2, 0xF6, 0x35,
+	0x3F, 0x2F, 0x63, 0x53, 0xF2, 0xC9, 0x3F, 0x3F, 0x26, 0xE5, 0x13, 0xCF, 0x20, 0x6D, 0xF0, 0x4B,
+	0x5F, 0x25, 0x33, 0xF2, 0x53, 0x3F, 0x25, 0x33, 0xF2, 0x0F, 0xA7, 0x2A, 0xEE, 0x6A, 0xAC, 0x51,
+	0x11, 0xA0, 0x2D, 0x14, 0x2A, 0xA5, 0x2A, 0xA5, 0x2A, 0xA5, 0x2A, 0xA5, 0x2A, 0xA5, 0x00, 0x1E,
+	0x5C, 0xEE, 0xB4, 0x03, 0xF5, 0x12, 0x67, 0x13, 0x4F, 0x36, 0x57, 0xEC, 0x73, 0x46, 0x15, 0x9E,
+	0xA1, 0x5F, 0x2F, 0x58, 0xA3, 0x11, 0x6F, 0x31, 0x7C, 0xE0, 0x3E, 0xC4, 0x10, 0x22, 0x89, 0x62,
+	0x99, 0x48, 0xDF, 0xFF, 0xFF, 0xF7, 0x22, 0xB9, 0x62, 0xB9, 0x62, 0xB9, 0x62, 0xB9, 0x62, 0x9A,
+	0x66, 0x5E, 0x40, 0x22, 0x35, 0x8E, 0xFD, 0x70, 0x02, 0xC8, 0x35, 0x4F, 0x1C, 0x83, 0x54, 0xF1,
+	0xC8, 0x35, 0x4F, 0x1C, 0x83, 0x54, 0xF1, 0xB8, 0x35, 0x4F, 0x1A, 0xA3, 0xF6, 0xF1, 0x7E, 0x31,
+	0x6B, 0xF1, 0x19, 0xEE, 0x04, 0x81, 0xF1, 0x03, 0x1E, 0x54, 0x5A, 0x90, 0x9B, 0x37, 0x1F, 0x30,
+	0x2F, 0x22, 0x27, 0xC3, 0x2B, 0x82, 0x2D, 0x63, 0x65, 0xD0, 0x3E, 0x14, 0x4E, 0x49, 0x85, 0x48,
+	0xAE, 0x25, 0x32, 0xFB, 0x30, 0x02, 0xC9, 0x22, 0xD7, 0x2E, 0xD5, 0x8C, 0x01, 0xEB, 0x01, 0xF2,
+	0x5F, 0x1F, 0x4A, 0xE0, 0x4E, 0x02, 0xF3, 0x76, 0xC2, 0x70, 0x1B, 0x28, 0xD6, 0xA3, 0x95, 0xA8,
+	0x28, 0xA9, 0xD0, 0x68, 0xD5, 0x28, 0x7C, 0xC0, 0x2C, 0xF1, 0x23, 0x4F, 0x82, 0x2E, 0xD2, 0x00,
+	0x03, 0x6E, 0x22, 0xA6, 0xE1, 0x0A, 0xB0, 0x1E, 0x52, 0x51, 0xE6, 0xA9, 0x44, 0x4F, 0xD1, 0x44,
+	0x7E, 0xD1, 0x35, 0x3E, 0x3B, 0xB2, 0xA1, 0xD7, 0x01, 0xE7, 0x09, 0xC3, 0x34, 0xF3, 0x03, 0x1E,
+	0x54, 0x59, 0x90, 0x8B, 0x37, 0x1E, 0x30, 0x2F, 0x32, 0x26, 0xC3, 0x29, 0x92, 0x2C, 0x63, 0x53,
+	0xE1, 0x2E, 0x54, 0xB7, 0x88, 0x54, 0x4D, 0xD2, 0x62, 0xCB, 0x72, 0xC5, 0x53, 0x19, 0xB5, 0x4B,
+	0xEA, 0x14, 0x00, 0x08, 0x4F, 0xFF, 0xFF, 0xF4, 0x43, 0x1D, 0x95, 0x2B, 0xB5, 0x39, 0xD1, 0x43,
+	0x7E, 0x24, 0x35, 0xF4, 0x43, 0x3E, 0x75, 0x8C, 0xFF, 0xFF, 0xFF, 0x80, 0x34, 0x4C, 0xEF, 0x33,
+	0xC8, 0x14, 0x2D, 0x35, 0x2D, 0x45, 0x2C, 0x43, 0x41, 0x4E, 0x32, 0x41, 0xFF, 0x74, 0x41, 0x5E,
+	0x25, 0x2C, 0x45, 0x2C, 0x45, 0x2D, 0x45, 0x2D, 0x45, 0x3C, 0x91, 0x44, 0x3C, 0xEF, 0x0F, 0xC6,
+	0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC0, 0xF6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x02,
+	0xC6, 0x05, 0x6F, 0xEA, 0x14, 0x32, 0xD6, 0x52, 0x97, 0x52, 0xA6, 0x52, 0xA6, 0x53, 0x9A, 0x24,
+	0x41, 0xCF, 0xA3, 0x38, 0xB2, 0x42, 0xA6, 0x52, 0xA6, 0x52, 0xA7, 0x52, 0x97, 0x43, 0x2D, 0x52,
+	0x46, 0xFE, 0x93, 0x00, 0x0F, 0x1B, 0xEB, 0x31, 0xB2, 0x87, 0x16, 0xDE, 0x71, 0x00,
+};
+
+static const Font_Glyph Font_Mono16_Glyphs[95] = {
+	{     0,   0,   0,   0,   0,  10 }, // 0x20
+	{     0,   3,  11,   3,   5,  10 }, // !
+	{    17,   6,   5,   2,   5,  10 }, // "
+	{    34,   8,  10,   1,   6,  10 }, // #
+	{    72,   8,  14,   1,   4,  10 }, // $
+	{   113,  10,  10,   0,   6,  10 }, // %
+	{   159,  10,  11,   0,   5,  10 }, // &
+	{   207,   3,   5,   3,   5,  10 }, // '
+	{   216,   5,  15,   3,   4,  10 }, // (
+	{   249,   5,  15,   2,   4,  10 }, // )
+	{   282,   8,   7,   1,   7,  10 }, // *
+	{   306,   8,   9,   1,   6,  10 }, // +
+	{   328,   4,   6,   3,  14,  10 }, // ,
+	{   341,   8,   1,   1,  10,  10 }, // -
+	{   346,   4,   3,   3,  13,  10 }, // .
+	{   354,   7,  14,   1,   5,  10 }, // /
+	{   385,   8,  10,   1,   6,  10 }, // 0
+	{   423,   8,  10,   1,   6,  10 }, // 1
+	{   448,   8,  10,   1,   6,  10 }, // 2
+	{   480,   8,  10,   1,   6,  10 }, // 3
+	{   515,   9,  10,   0,   6,  10 }, // 4
+	{   551,   8,  10,   1,   6,  10 }, // 5
+	{   585,   8,  10,   1,   6,  10 }, // 6
+	{   623,   8,  10,   1,   6,  10 }, // 7
+	{   650,   8,  10,   1,   6,  10 }, // 8
+	{   692,   8,  10,   1,   6,  10 }, // 9
+	{   730,   4,   9,   3,   7,  10 }, // :
+	{   744,   4,  13,   3,   7,  10 }, // ;
+	{   765,   7,   9,   1,   6,  10 }, // <
+	{   788,   8,   5,   1,   8,  10 }, // =
+	{   799,   7,   9,   1,   6,  10 }, // >
+	{   822,   7,  11,   1,   5,  10 }, // ?
+	{   849,   9,  12,   0,   6,  10 }, // @
+	{   899,   9,  11,   0,   5,  10 }, // A
+	{   940,   8,  11,   1,   5,  10 }, // B
+	{   983,   8,  11,   1,   5,  10 }, // C
+	{  1015,   8,  11,   1,   5,  10 }, // D
+	{  1055,   8,  11,   1,   5,  10 }, // E
+	{  1088,   7,  11,   2,   5,  10 }, // F
+	{  1114,   9,  11,   0,   5,  10 }, // G
+	{  1156,   8,  11,   1,   5,  10 }, // H
+	{  1191,   8,  11,   1,   5,  10 }, // I
+	{  1219,   7,  11,   1,   5,  10 }, // J
+	{  1248,   9,  11,   1,   5,  10 }, // K
+	{  1293,   7,  11,   2,   5,  10 }, // L
+	{  1318,   8,  11,   1,   5,  10 }, // M
+	{  1362,   8,  11,   1,   5,  10 }, // N
+	{  1405,   9,  11,   0,   5,  10 }, // O
+	{  1448,   8,  11,   1,   5,  10 }, // P
+	{  1482,   9,  14,   0,   5,  10 }, // Q
+	{  1532,   8,  11,   1,   5,  10 }, // R
+	{  1574,   8,  11,   1,   5,  10 }, // S
+	{  1612,   9,  11,   0,   5,  10 }, // T
+	{  1639,   8,  11,   1,   5,  10 }, // U
+	{  1676,   9,  11,   0,   5,  10 }, // V
+	{  1717,  10,  11,   0,   5,  10 }, // W
+	{  1768,   8,  11,   1,   5,  10 }, // X
+	{  1808,   9,  11,   0,   5,  10 }, // Y
+	{  1843,   8,  11,   1,   5,  10 }, // Z
+	{  1874,   5,  14,   3,   5,  10 }, // [
+	{  1904,   7,  14,   1,   5,  10 }, // 0x5C
+	{  1934,   5,  14,   1,   5,  10 }, // ]
+	{  1964,   7,   6,   1,   5,  10 }, // ^
+	{  1984,   9,   1,   0,  17,  10 }, // _
+	{  1990,   3,   2,   3,   5,  10 }, // `
+	{  1994,   8,   8,   1,   8,  10 }, // a
+	{  2026,   8,  11,   1,   5,  10 }, // b
+	{  2064,   8,   8,   1,   8,  10 }, // c
+	{  2090,   8,  11,   1,   5,  10 }, // d
+	{  2130,   8,   8,   1,   8,  10 }, // e
+	{  2159,   9,  11,   1,   5,  10 }, // f
+	{  2193,   8,  11,   1,   8,  10 }, // g
+	{  2234,   8,  11,   1,   5,  10 }, // h
+	{  2269,   6,  12,   1,   4,  10 }, // i
+	{  2292,   6,  15,   1,   4,  10 }, // j
+	{  2324,   8,  11,   1,   5,  10 }, // k
+	{  2361,   8,  11,   1,   5,  10 }, // l
+	{  2391,   9,   8,   0,   8,  10 }, // m
+	{  2431,   8,   8,   1,   8,  10 }, // n
+	{  2460,   8,   8,   1,   8,  10 }, // o
+	{  2491,   8,  11,   1,   8,  10 }, // p
+	{  2529,   8,  11,   1,   8,  10 }, // q
+	{  2569,   7,   8,   2,   8,  10 }, // r
+	{  2591,   8,   8,   1,   8,  10 }, // s
+	{  2621,   8,  10,   1,   6,  10 }, // t
+	{  2648,   8,   8,   1,   8,  10 }, // u
+	{  2679,   9,   8,   0,   8,  10 }, // v
+	{  2709,  10,   8,   0,   8,  10 }, // w
+	{  2752,   8,   8,   1,   8,  10 }, // x
+	{  2782,   9,  11,   0,   8,  10 }, // y
+	{  2819,   8,   8,   1,   8,  10 }, // z
+	{  2844,   7,  14,   1,   5,  10 }, // {
+	{  2878,   2,  16,   4,   4,  10 }, // |
+	{  2897,   7,  14,   1,   5,  10 }, // }
+	{  2932,   8,   2,   1,  10,  10 }, // ~
+};
+
+const Font Font_Mono16 = { Font_Mono16_Data, Font_Mono16_Glyphs, 0x20, 95, 21, 16 };
@@ -0,0 +1,265 @@
+#include "Image.h"
+
+#define IMAGE_QOI_OP_INDEX     0x00            // 00xxxxxx：Index中的像素
+#define IMAGE_QOI_OP_DIFF      0x40            // 01rrggbb：各分量与前一像素相差-2~1
+#define IMAGE_QOI_OP_LUMA      0x80            // 10gggggg rrrrbbbb：G相差-32~31，R、B相对G的差-8~7
+#define IMAGE_QOI_OP_RUN       0xC0            // 11xxxxxx：重复前一像素1~62次
+#define IMAGE_QOI_OP_RGB       0xFE            // 随后3字节RGB
+#define IMAGE_QOI_OP_RGBA      0xFF            // 随后4字节RGBA
+
+static uint16_t Image_Buffer[2][IMAGE_BUFFER_PIXELS];  // 交替发送的行缓冲区
+static const uint8_t Image_Zero[8];                    // 数据耗尽后提供的全零数据（OP_INDEX 0）
+
+/**
+ * @brief 读入下一块压缩数据（内部函数）
+ * @note 程序Flash中的图片没有后续数据，数据不完整时改为读取全零数据
+ */
+static void Image_Refill(Image_QOI * D)
+{
+	if (D->Remaining == 0)
+	{
+		D->Next = Image_Zero;
+		D->End = Image_Zero + sizeof(Image_Zero);
+		return;
+	}
+	uint32_t Length = (D->Remaining < IMAGE_CHUNK_SIZE) ? D->Remaining : IMAGE_CHUNK_SIZE;
+	// 已提交的像素与Flash读取共用SPI0，读取的完成通知排在它们之后，先取走像素的通知
+	ST7789_Wait_Pixels(0);
+	SPI_Flash_Read(D->Address, D->Chunk, Length);
+	D->Address += Length;
+	D->Remaining -= Length;
+	D->Next = D->Chunk;
+	D->End = D->Chunk + Length;
+	// 屏幕的片选被Flash读取打断，显存写入需要用RAMWRC继续
+	D->Resume = 1;
+}
+
+/**
+ * @brief 读取一个压缩数据字节（内部函数）
+ */
+static inline uint8_t Image_Byte(Image_QOI * D)
+{
+	if (D->Next == D->End)
+	{
+		Image_Refill(D);
+	}
+	return *D->Next++;
+}
+
+/**
+ * @brief 解析文件头并复位解码状态（内部函数）
+ * @param D 解码器
+ * @param Header 文件头
+ * @return 文件头有效返回1
+ */
+static uint8_t Image_QOI_Header(Image_QOI * D, const uint8_t * Header)
+{
+	uint32_t Width = ((uint32_t)Header[4] << 24) | ((uint32_t)Header[5] << 16) | ((uint32_t)Header[6] << 8) | Header[7];
+	uint32_t Height = ((uint32_t)Header[8] << 24) | ((uint32_t)Header[9] << 16) | ((uint32_t)Header[10] << 8) | Header[11];
+	if (Header[0] != 'q' || Header[1] != 'o' || Header[2] != 'i' || Header[3] != 'f' ||
+		Width == 0 || Width > 0xFFFF || Height == 0 || Height > 0xFFFF)
+	{
+		return 0;
+	}
+	D->Width = (uint16_t)Width;
+	D->Height = (uint16_t)Height;
+	D->Resume = 0;
+	D->Run = 0;
+	D->Pixel = 0xFF000000u;
+	D->Color = 0;
+	for (uint32_t i = 0; i < 64; i++)
+	{
+		D->Index[i] = 0;
+	}
+	return 1;
+}
+
+/**
+ * @brief 打开程序Flash中的图片实现
+ * @param D 解码器
+ * @param Data 文件数据
+ * @param Size 文件长度
+ * @return 文件头有效返回1
+ */
+uint8_t Image_QOI_Open(Image_QOI * D, const uint8_t * Data, uint32_t Size)
+{
+	if (Size < IMAGE_QOI_HEADER || !Image_QOI_Header(D, Data))
+	{
+		return 0;
+	}
+	D->Next = Data + IMAGE_QOI_HEADER;
+	D->End = Data + Size;
+	D->Address = 0;
+	D->Remaining = 0;
+	return 1;
+}
+
+/**
+ * @brief 打开SPI Flash中的图片实现
+ * @param D 解码器
+ * @param Address 文件起始地址
+ * @return 文件头有效返回1
+ */
+uint8_t Image_QOI_Open_Flash(Image_QOI * D, uint32_t Address)
+{
+	uint32_t Size = SPI_Flash_GetInfo()->Size;
+	if (Address + IMAGE_QOI_HEADER > Size)
+	{
+		return 0;
+	}
+	SPI_Flash_Read(Address, D->Chunk, IMAGE_QOI_HEADER);
+	if (!Image_QOI_Header(D, D->Chunk))
+	{
+		return 0;
+	}
+	// 文件头中没有数据长度，按需读到Flash末尾为止
+	D->Next = D->Chunk;
+	D->End = D->Chunk;
+	D->Address = Address + IMAGE_QOI_HEADER;
+	D->Remaining = Size - D->Address;
+	return 1;
+}
+
+/**
+ * @brief 解码一行实现
+ * @param D 解码器
+ * @param Row 输出像素
+ * @param Count 保存的像素数
+ * @note 分量保存在局部变量中，只在更新Index时合成32位值；
+ *       RGB565在像素变化时计算一次，重复像素直接复制
+ */
+void Image_QOI_Decode_Row(Image_QOI * D, uint16_t * Row, uint16_t Count)
+{
+	uint8_t R = (uint8_t)D->Pixel;
+	uint8_t G = (uint8_t)(D->Pixel >> 8);
+	uint8_t B = (uint8_t)(D->Pixel >> 16);
+	uint8_t A = (uint8_t)(D->Pixel >> 24);
+	uint16_t Color = D->Color;
+	uint16_t Width = D->Width;
+	uint16_t X = 0;
+
+	while (X < Width)
+	{
+		if (D->Run != 0)
+		{
+			uint16_t End = (D->Run < Width - X) ? X + D->Run : Width;
+			D->Run -= (uint8_t)(End - X);
+			for (; X < End; X++)
+			{
+				if (X < Count)
+				{
+					Row[X] = Color;
+				}
+			}
+			continue;
+		}
+
+		uint8_t Op = Image_Byte(D);
+		if (Op == IMAGE_QOI_OP_RGB)
+		{
+			R = Image_Byte(D);
+			G = Image_Byte(D);
+			B = Image_Byte(D);
+		}
+		else if (Op == IMAGE_QOI_OP_RGBA)
+		{
+			R = Image_Byte(D);
+			G = Image_Byte(D);
+			B = Image_Byte(D);
+			A = Image_Byte(D);
+		}
+		else if (Op < IMAGE_QOI_OP_DIFF)
+		{
+			uint32_t Pixel = D->Index[Op];
+			R = (uint8_t)Pixel;
+			G = (uint8_t)(Pixel >> 8);
+			B = (uint8_t)(Pixel >> 16);
+			A = (uint8_t)(Pixel >> 24);
+		}
+		else if (Op < IMAGE_QOI_OP_LUMA)
+		{
+			R += ((Op >> 4) & 0x03) - 2;
+			G += ((Op >> 2) & 0x03) - 2;
+			B += (Op & 0x03) - 2;
+		}
+		else if (Op < IMAGE_QOI_OP_RUN)
+		{
+			uint8_t Next = Image_Byte(D);
+			uint8_t Delta_G = (uint8_t)((Op & 0x3F) - 32);
+			R += Delta_G - 8 + (Next >> 4);
+			G += Delta_G;
+			B += Delta_G - 8 + (Next & 0x0F);
+		}
+		else
+		{
+			// 本像素与之后的Run-1个像素都是前一像素，在循环开头写出
+			D->Run = (uint8_t)((Op & 0x3F) + 1);
+		}
+		D->Index[(R * 3 + G * 5 + B * 7 + A * 11) & 63] =
+			(uint32_t)R | ((uint32_t)G << 8) | ((uint32_t)B << 16) | ((uint32_t)A << 24);
+		if (D->Run == 0)
+		{
+			Color = ST7789_RGB565(R, G, B);
+			if (X < Count)
+			{
+				Row[X] = Color;
+			}
+			X++;
+		}
+	}
+	D->Pixel = (uint32_t)R | ((uint32_t)G << 8) | ((uint32_t)B << 16) | ((uint32_t)A << 24);
+	D->Color = Color;
+}
+
+/**
+ * @brief 显示图片实现
+ * @param D 解码器
+ * @param X 左上角列
+ * @param Y 左上角行
+ * @return 显示的行数
+ */
+uint16_t Image_QOI_Draw(Image_QOI * D, uint16_t X, uint16_t Y)
+{
+	uint16_t Width = D->Width;
+	uint16_t Height = D->Height;
+
+	// 裁剪到屏幕范围内，右边超出的像素解码后丢弃，下边超出的行不解码
+	if (X >= ST7789_WIDTH || Y >= ST7789_HEIGHT)
+	{
+		return 0;
+	}
+	if (Width > ST7789_WIDTH - X)
+	{
+		Width = ST7789_WIDTH - X;
+	}
+	if (Height > ST7789_HEIGHT - Y)
+	{
+		Height = ST7789_HEIGHT - Y;
+	}
+
+	uint16_t Band_Rows = IMAGE_BUFFER_PIXELS / Width;
+	uint8_t Next = 0;
+	ST7789_SetWindow(X, Y, X + Width - 1, Y + Height - 1);
+	D->Resume = 0;
+	for (uint16_t Row = 0; Row < Height; Row += Band_Rows)
+	{
+		uint16_t Rows = (Height - Row < Band_Rows) ? Height - Row : Band_Rows;
+		uint16_t * Buffer = Image_Buffer[Next];
+		// 只允许另一个缓冲区仍在发送，这一个必须已被DMA读完
+		ST7789_Wait_Pixels(1);
+		for (uint16_t r = 0; r < Rows; r++)
+		{
+			Image_QOI_Decode_Row(D, &Buffer[(uint32_t)r * Width], Width);
+		}
+		if (D->Resume)
+		{
+			ST7789_Write_Command(ST7789_RAMWRC, NULL, 0);
+			D->Resume = 0;
+		}
+		ST7789_Write_Pixels(Buffer, (uint32_t)Width * Rows, 1);
+		Next ^= 1;
+	}
+	// 行缓冲区是本模块的静态变量，返回前等待全部读完
+	ST7789_Wait_Pixels(0);
+	return Height;
+}
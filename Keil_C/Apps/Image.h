@@ -0,0 +1,98 @@
+/**
+ * @file Image.h
+ * @brief QOI图片流式解码与显示模块头文件
+ * @note 图片以QOI格式（https://qoiformat.org）存放在程序Flash或SPI Flash中，由Tools/image_convert.py从PNG生成。
+ *       解码逐行进行，不需要整幅图片的像素缓冲区：一个行带解码完成后交给DMA发送，
+ *       同时解码下一个行带，两个行缓冲区交替使用。透明度通道被忽略（转换时已与背景合成）
+ */
+
+#ifndef IMAGE_H
+#define IMAGE_H
+
+#include "ST7789.h"
+#include "SPI_Flash.h"
+
+/**
+ * 每个行缓冲区的像素数（两个缓冲区共占4倍字节），不能小于屏幕宽度；
+ * 窄图片一次发送 IMAGE_BUFFER_PIXELS / 显示宽度 行
+ */
+#ifndef IMAGE_BUFFER_PIXELS
+#define IMAGE_BUFFER_PIXELS    (ST7789_WIDTH * 2)
+#endif
+
+/**
+ * 从SPI Flash读取图片时每次读入的压缩数据字节数
+ */
+#ifndef IMAGE_CHUNK_SIZE
+#define IMAGE_CHUNK_SIZE       128
+#endif
+
+#define IMAGE_QOI_HEADER       14              // 文件头："qoif"、宽、高（大端32位）、通道数、色彩空间
+
+/**
+ * @struct Image_QOI
+ * @brief QOI解码器
+ * @note 从SPI Flash读取时压缩数据由DMA写入Chunk
+ */
+typedef struct
+{
+    const uint8_t *      Next;				   // 下一个未读取的压缩数据字节
+    const uint8_t *      End;				   // 当前可读数据的结束位置
+    uint32_t             Address;			   // SPI Flash中下一次读入的地址
+    uint32_t             Remaining;			   // SPI Flash中尚未读入的字节数，程序Flash中的图片为0
+    uint8_t              Resume;			   // 读入数据打断了显存写入，发送像素前需RAMWRC
+    uint8_t              Run;				   // 前一像素剩余的重复次数
+    uint16_t             Color;				   // 前一像素的RGB565颜色
+    uint32_t             Pixel;				   // 前一像素（R | G<<8 | B<<16 | A<<24）
+    uint32_t             Index[64];			   // 最近出现过的像素，按哈希值存放
+    uint16_t             Width;				   // 图片宽度
+    uint16_t             Height;			   // 图片高度
+    uint8_t              Chunk[IMAGE_CHUNK_SIZE]; // SPI Flash数据的读入缓冲区
+} Image_QOI;
+
+/**
+ * Tools/image_convert.py生成的图片
+ */
+extern const uint8_t Image_TestCard[];		   // 128x96测试图（彩条、渐变、细格）
+extern const uint32_t Image_TestCard_Size;
+
+/**
+ * @brief 打开程序Flash（或RAM）中的QOI图片
+ * @param D 解码器
+ * @param Data 文件数据
+ * @param Size 文件长度
+ * @return 文件头有效返回1，否则返回0
+ */
+uint8_t Image_QOI_Open(Image_QOI * D, const uint8_t * Data, uint32_t Size);
+
+/**
+ * @brief 打开SPI Flash中的QOI图片
+ * @param D 解码器
+ * @param Address 文件起始地址
+ * @return 文件头有效返回1，否则返回0
+ * @note 需先调用SPI_Flash_Initialize；压缩数据按IMAGE_CHUNK_SIZE分块读入
+ */
+uint8_t Image_QOI_Open_Flash(Image_QOI * D, uint32_t Address);
+
+/**
+ * @brief 解码下一行
+ * @param D 解码器
+ * @param Row 输出的RGB565像素（本机字节序）
+ * @param Count 保存到Row的像素数，超出部分解码后丢弃
+ * @note 不检查是否已超过图片高度，数据不完整时以全零数据继续解码
+ */
+void Image_QOI_Decode_Row(Image_QOI * D, uint16_t * Row, uint16_t Count);
+
+/**
+ * @brief 解码图片并显示在屏幕上
+ * @param D 刚打开的解码器
+ * @param X 左上角列
+ * @param Y 左上角行
+ * @return 显示的行数（超出屏幕的部分被裁剪）
+ * @note 只设置一次窗口，行带解码与DMA发送重叠；从SPI Flash读入数据时先等待已提交的行带发完
+ *       （两者共用SPI0），之后用RAMWRC继续写入显存。返回时数据已被DMA读完，
+ *       片选保持到ST7789_Release；需先调用ST7789_Initialize，不可重入
+ */
+uint16_t Image_QOI_Draw(Image_QOI * D, uint16_t X, uint16_t Y);
+
+#endif // IMAGE_H
@@ -0,0 +1,1027 @@
+/**
+ * @file Image_TestCard.c
+ * @brief 图片：test card，128x96，QOI格式
+ * @note 由Tools/image_convert.py生成，不要手工修改；
+ *       16218字节（RGB565原始数据为24576字节）
+ */
+
+#include "Image.h"
+
+const uint8_t Image_TestCard[16218] = {
+	0x71, 0x6F, 0x69, 0x66, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x60, 0x03, 0x00, 0x9C, 0x44,
+	0xCE, 0xFE, 0xF8, 0xFC, 0x00, 0xCE, 0xFE, 0x00, 0xFC, 0xF8, 0xCE, 0xFE, 0x00, 0xFC, 0x00, 0xCE,
+	0xFE, 0xF8, 0x00, 0xF8, 0xCE, 0xFE, 0xF8, 0x00, 0x00, 0xCE, 0xFE, 0x00, 0x00, 0xF8, 0xCE, 0xFE,
+	0x00, 0x00, 0x00, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x11, 0xCE, 0x09, 0xCE, 0x29, 0xCE, 0x21, 0xCE, 0x25, 0xCE, 0x1D, 0xCE,
+	0x3D, 0xCE, 0x35, 0xCE, 0x1D, 0xFE, 0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24,
+	0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54,
+	0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84,
+	0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4,
+	0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4,
+	0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18,
+	0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48,
+	0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78,
+	0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8,
+	0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8,
+	0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8,
+	0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8,
+	0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8,
+	0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8,
+	0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8,
+	0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8,
+	0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8,
+	0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8,
+	0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8,
+	0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8,
+	0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8,
+	0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0,
+	0x80, 0xA0, 0x80, 0xFE, 0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE,
+	0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE,
+	0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE,
+	0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE,
+	0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE,
+	0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00,
+	0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00,
+	0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00,
+	0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00,
+	0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00,
+	0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00,
+	0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00,
+	0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00,
+	0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00,
+	0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00,
+	0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08,
+	0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38,
+	0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68,
+	0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98,
+	0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8,
+	0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8,
+	0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0,
+	0x80, 0xFE, 0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30,
+	0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60,
+	0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90,
+	0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0,
+	0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0,
+	0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28,
+	0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58,
+	0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88,
+	0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8,
+	0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8,
+	0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8,
+	0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8,
+	0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8,
+	0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8,
+	0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8,
+	0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8,
+	0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8,
+	0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8,
+	0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8,
+	0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8,
+	0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8,
+	0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0, 0x80, 0xFE,
+	0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE,
+	0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE,
+	0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE,
+	0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE,
+	0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE,
+	0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC,
+	0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00,
+	0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00,
+	0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00,
+	0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00,
+	0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00,
+	0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00,
+	0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00,
+	0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00,
+	0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00,
+	0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00,
+	0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10,
+	0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40,
+	0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70,
+	0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0,
+	0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0,
+	0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE,
+	0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0, 0x80, 0xFE, 0xF8, 0x0C,
+	0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C,
+	0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C,
+	0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C,
+	0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC,
+	0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC,
+	0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0,
+	0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30,
+	0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60,
+	0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90,
+	0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0,
+	0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0,
+	0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8,
+	0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8,
+	0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8,
+	0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8,
+	0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8,
+	0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8,
+	0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8,
+	0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8,
+	0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8,
+	0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8,
+	0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00,
+	0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0, 0x80, 0xFE, 0xF8, 0x0C, 0x00, 0xFE,
+	0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE,
+	0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE,
+	0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE,
+	0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE,
+	0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0,
+	0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00,
+	0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00,
+	0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00,
+	0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00,
+	0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00,
+	0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00,
+	0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00,
+	0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00,
+	0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00,
+	0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00,
+	0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00,
+	0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20,
+	0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50,
+	0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80,
+	0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0,
+	0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0,
+	0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0, 0x80, 0xFE, 0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18,
+	0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48,
+	0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78,
+	0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8,
+	0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8,
+	0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0,
+	0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10,
+	0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40,
+	0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70,
+	0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0,
+	0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0,
+	0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8,
+	0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8,
+	0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8,
+	0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8,
+	0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8,
+	0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8,
+	0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8,
+	0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8,
+	0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8,
+	0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8,
+	0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8,
+	0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0, 0x80, 0xFE, 0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE,
+	0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE,
+	0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE,
+	0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE,
+	0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE,
+	0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE,
+	0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00,
+	0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00,
+	0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00,
+	0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00,
+	0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00,
+	0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00,
+	0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00,
+	0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00,
+	0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00,
+	0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00,
+	0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00,
+	0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28,
+	0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58,
+	0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88,
+	0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8,
+	0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8,
+	0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x10, 0xA0, 0x80, 0xA0, 0x80, 0xFE, 0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24,
+	0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54,
+	0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84,
+	0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4,
+	0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4,
+	0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18,
+	0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48,
+	0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78,
+	0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8,
+	0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8,
+	0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8,
+	0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8,
+	0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8,
+	0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8,
+	0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8,
+	0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8,
+	0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8,
+	0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8,
+	0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8,
+	0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8,
+	0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8,
+	0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0,
+	0x80, 0xA0, 0x80, 0xFE, 0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE,
+	0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE,
+	0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE,
+	0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE,
+	0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE,
+	0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00,
+	0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00,
+	0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00,
+	0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00,
+	0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00,
+	0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00,
+	0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00,
+	0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00,
+	0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00,
+	0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00,
+	0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08,
+	0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38,
+	0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68,
+	0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98,
+	0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8,
+	0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8,
+	0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0,
+	0x80, 0xFE, 0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30,
+	0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60,
+	0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90,
+	0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0,
+	0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0,
+	0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28,
+	0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58,
+	0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88,
+	0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8,
+	0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8,
+	0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8,
+	0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8,
+	0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8,
+	0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8,
+	0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8,
+	0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8,
+	0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8,
+	0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8,
+	0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8,
+	0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8,
+	0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8,
+	0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0, 0x80, 0xFE,
+	0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE,
+	0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE,
+	0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE,
+	0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE,
+	0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE,
+	0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC,
+	0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00,
+	0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00,
+	0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00,
+	0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00,
+	0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00,
+	0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00,
+	0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00,
+	0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00,
+	0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00,
+	0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00,
+	0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10,
+	0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40,
+	0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70,
+	0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0,
+	0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0,
+	0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE,
+	0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0, 0x80, 0xFE, 0xF8, 0x0C,
+	0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C,
+	0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C,
+	0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C,
+	0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC,
+	0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC,
+	0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0,
+	0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30,
+	0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60,
+	0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90,
+	0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0,
+	0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0,
+	0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8,
+	0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8,
+	0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8,
+	0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8,
+	0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8,
+	0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8,
+	0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8,
+	0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8,
+	0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8,
+	0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8,
+	0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00,
+	0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0, 0x80, 0xFE, 0xF8, 0x0C, 0x00, 0xFE,
+	0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE,
+	0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE,
+	0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE,
+	0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE,
+	0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0,
+	0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00,
+	0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00,
+	0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00,
+	0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00,
+	0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00,
+	0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00,
+	0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00,
+	0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00,
+	0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00,
+	0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00,
+	0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00,
+	0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20,
+	0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50,
+	0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80,
+	0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0,
+	0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0,
+	0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0, 0x80, 0xFE, 0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18,
+	0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48,
+	0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78,
+	0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8,
+	0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8,
+	0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0,
+	0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10,
+	0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40,
+	0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70,
+	0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0,
+	0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0,
+	0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8,
+	0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8,
+	0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8,
+	0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8,
+	0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8,
+	0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8,
+	0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8,
+	0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8,
+	0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8,
+	0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8,
+	0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8,
+	0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0, 0x80, 0xFE, 0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE,
+	0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE,
+	0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE,
+	0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE,
+	0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE,
+	0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE,
+	0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00,
+	0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00,
+	0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00,
+	0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00,
+	0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00,
+	0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00,
+	0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00,
+	0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00,
+	0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00,
+	0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00,
+	0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00,
+	0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28,
+	0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58,
+	0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88,
+	0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8,
+	0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8,
+	0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x10, 0xA0, 0x80, 0xA0, 0x80, 0xFE, 0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24,
+	0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54,
+	0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84,
+	0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4,
+	0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4,
+	0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18,
+	0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48,
+	0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78,
+	0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8,
+	0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8,
+	0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8,
+	0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8,
+	0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8,
+	0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8,
+	0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8,
+	0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8,
+	0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8,
+	0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8,
+	0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8,
+	0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8,
+	0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8,
+	0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0,
+	0x80, 0xA0, 0x80, 0xFE, 0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE,
+	0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE,
+	0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE,
+	0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE,
+	0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE,
+	0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00,
+	0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00,
+	0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00,
+	0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00,
+	0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00,
+	0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00,
+	0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00,
+	0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00,
+	0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00,
+	0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00,
+	0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08,
+	0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38,
+	0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68,
+	0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98,
+	0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8,
+	0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8,
+	0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0,
+	0x80, 0xFE, 0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30,
+	0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60,
+	0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90,
+	0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0,
+	0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0,
+	0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28,
+	0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58,
+	0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88,
+	0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8,
+	0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8,
+	0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8,
+	0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8,
+	0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8,
+	0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8,
+	0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8,
+	0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8,
+	0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8,
+	0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8,
+	0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8,
+	0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8,
+	0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8,
+	0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0, 0x80, 0xFE,
+	0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE,
+	0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE,
+	0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE,
+	0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE,
+	0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE,
+	0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC,
+	0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00,
+	0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00,
+	0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00,
+	0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00,
+	0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00,
+	0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00,
+	0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00,
+	0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00,
+	0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00,
+	0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00,
+	0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10,
+	0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40,
+	0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70,
+	0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0,
+	0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0,
+	0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE,
+	0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0, 0x80, 0xFE, 0xF8, 0x0C,
+	0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C,
+	0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C,
+	0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C,
+	0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC,
+	0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC,
+	0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0,
+	0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30,
+	0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60,
+	0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90,
+	0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0,
+	0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0,
+	0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8,
+	0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8,
+	0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8,
+	0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8,
+	0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8,
+	0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8,
+	0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8,
+	0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8,
+	0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8,
+	0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8,
+	0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00,
+	0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0, 0x80, 0xFE, 0xF8, 0x0C, 0x00, 0xFE,
+	0xF8, 0x18, 0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE,
+	0xF8, 0x48, 0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE,
+	0xF8, 0x78, 0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE,
+	0xF8, 0xA8, 0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE,
+	0xF8, 0xD8, 0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0,
+	0x08, 0xA0, 0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0xA8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00,
+	0xFC, 0x10, 0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00,
+	0xFC, 0x40, 0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00,
+	0xFC, 0x70, 0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00,
+	0xFC, 0xA0, 0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00,
+	0xFC, 0xD0, 0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00,
+	0xFC, 0xF8, 0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00,
+	0xCC, 0xF8, 0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00,
+	0x9C, 0xF8, 0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00,
+	0x6C, 0xF8, 0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00,
+	0x3C, 0xF8, 0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00,
+	0x0C, 0xF8, 0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20,
+	0x00, 0xF8, 0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50,
+	0x00, 0xF8, 0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80,
+	0x00, 0xF8, 0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0,
+	0x00, 0xF8, 0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0,
+	0x00, 0xF8, 0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0xA0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0, 0x80, 0xFE, 0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18,
+	0x00, 0xFE, 0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48,
+	0x00, 0xFE, 0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78,
+	0x00, 0xFE, 0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8,
+	0x00, 0xFE, 0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8,
+	0x00, 0xFE, 0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0,
+	0x08, 0xFE, 0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x60, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10,
+	0xFE, 0x00, 0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40,
+	0xFE, 0x00, 0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70,
+	0xFE, 0x00, 0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0,
+	0xFE, 0x00, 0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0,
+	0xFE, 0x00, 0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8,
+	0xFE, 0x00, 0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8,
+	0xFE, 0x00, 0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8,
+	0xFE, 0x00, 0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8,
+	0xFE, 0x00, 0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8,
+	0xFE, 0x00, 0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8,
+	0xFE, 0x00, 0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8,
+	0xFE, 0x28, 0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8,
+	0xFE, 0x58, 0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8,
+	0xFE, 0x88, 0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8,
+	0xFE, 0xB8, 0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8,
+	0xFE, 0xE8, 0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x58, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x10, 0xA0, 0x80, 0xA0, 0x80, 0xFE, 0xF8, 0x0C, 0x00, 0xFE, 0xF8, 0x18, 0x00, 0xFE,
+	0xF8, 0x24, 0x00, 0xFE, 0xF8, 0x30, 0x00, 0xFE, 0xF8, 0x3C, 0x00, 0xFE, 0xF8, 0x48, 0x00, 0xFE,
+	0xF8, 0x54, 0x00, 0xFE, 0xF8, 0x60, 0x00, 0xFE, 0xF8, 0x6C, 0x00, 0xFE, 0xF8, 0x78, 0x00, 0xFE,
+	0xF8, 0x84, 0x00, 0xFE, 0xF8, 0x90, 0x00, 0xFE, 0xF8, 0x9C, 0x00, 0xFE, 0xF8, 0xA8, 0x00, 0xFE,
+	0xF8, 0xB4, 0x00, 0xFE, 0xF8, 0xC0, 0x00, 0xFE, 0xF8, 0xCC, 0x00, 0xFE, 0xF8, 0xD8, 0x00, 0xFE,
+	0xF8, 0xE4, 0x00, 0xFE, 0xF8, 0xF0, 0x00, 0xFE, 0xF8, 0xFC, 0x00, 0xA0, 0x08, 0xA0, 0x08, 0xFE,
+	0xD8, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xC0, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0xA8, 0xFC, 0x00, 0xA0,
+	0x08, 0xFE, 0x90, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x78, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x60, 0xFC,
+	0x00, 0xA0, 0x08, 0xFE, 0x48, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x30, 0xFC, 0x00, 0xA0, 0x08, 0xFE,
+	0x18, 0xFC, 0x00, 0xA0, 0x08, 0xFE, 0x00, 0xFC, 0x00, 0xC0, 0xFE, 0x00, 0xFC, 0x10, 0xFE, 0x00,
+	0xFC, 0x18, 0xFE, 0x00, 0xFC, 0x28, 0xFE, 0x00, 0xFC, 0x30, 0xFE, 0x00, 0xFC, 0x40, 0xFE, 0x00,
+	0xFC, 0x48, 0xFE, 0x00, 0xFC, 0x58, 0xFE, 0x00, 0xFC, 0x60, 0xFE, 0x00, 0xFC, 0x70, 0xFE, 0x00,
+	0xFC, 0x78, 0xFE, 0x00, 0xFC, 0x88, 0xFE, 0x00, 0xFC, 0x90, 0xFE, 0x00, 0xFC, 0xA0, 0xFE, 0x00,
+	0xFC, 0xA8, 0xFE, 0x00, 0xFC, 0xB8, 0xFE, 0x00, 0xFC, 0xC0, 0xFE, 0x00, 0xFC, 0xD0, 0xFE, 0x00,
+	0xFC, 0xD8, 0xFE, 0x00, 0xFC, 0xE8, 0xFE, 0x00, 0xFC, 0xF0, 0xFE, 0x00, 0xFC, 0xF8, 0xFE, 0x00,
+	0xF0, 0xF8, 0xFE, 0x00, 0xE4, 0xF8, 0xFE, 0x00, 0xD8, 0xF8, 0xFE, 0x00, 0xCC, 0xF8, 0xFE, 0x00,
+	0xC0, 0xF8, 0xFE, 0x00, 0xB4, 0xF8, 0xFE, 0x00, 0xA8, 0xF8, 0xFE, 0x00, 0x9C, 0xF8, 0xFE, 0x00,
+	0x90, 0xF8, 0xFE, 0x00, 0x84, 0xF8, 0xFE, 0x00, 0x78, 0xF8, 0xFE, 0x00, 0x6C, 0xF8, 0xFE, 0x00,
+	0x60, 0xF8, 0xFE, 0x00, 0x54, 0xF8, 0xFE, 0x00, 0x48, 0xF8, 0xFE, 0x00, 0x3C, 0xF8, 0xFE, 0x00,
+	0x30, 0xF8, 0xFE, 0x00, 0x24, 0xF8, 0xFE, 0x00, 0x18, 0xF8, 0xFE, 0x00, 0x0C, 0xF8, 0xFE, 0x00,
+	0x00, 0xF8, 0xFE, 0x08, 0x00, 0xF8, 0xFE, 0x10, 0x00, 0xF8, 0xFE, 0x20, 0x00, 0xF8, 0xFE, 0x28,
+	0x00, 0xF8, 0xFE, 0x38, 0x00, 0xF8, 0xFE, 0x40, 0x00, 0xF8, 0xFE, 0x50, 0x00, 0xF8, 0xFE, 0x58,
+	0x00, 0xF8, 0xFE, 0x68, 0x00, 0xF8, 0xFE, 0x70, 0x00, 0xF8, 0xFE, 0x80, 0x00, 0xF8, 0xFE, 0x88,
+	0x00, 0xF8, 0xFE, 0x98, 0x00, 0xF8, 0xFE, 0xA0, 0x00, 0xF8, 0xFE, 0xB0, 0x00, 0xF8, 0xFE, 0xB8,
+	0x00, 0xF8, 0xFE, 0xC8, 0x00, 0xF8, 0xFE, 0xD0, 0x00, 0xF8, 0xFE, 0xE0, 0x00, 0xF8, 0xFE, 0xE8,
+	0x00, 0xF8, 0xFE, 0xF8, 0x00, 0xF8, 0xC0, 0xFE, 0xF8, 0x00, 0xE8, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0xD0, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xB8, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0xA0, 0xA0, 0x80, 0xFE,
+	0xF8, 0x00, 0x88, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x70, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x58, 0xA0,
+	0x80, 0xFE, 0xF8, 0x00, 0x40, 0xA0, 0x80, 0xFE, 0xF8, 0x00, 0x28, 0xA0, 0x80, 0xFE, 0xF8, 0x00,
+	0x10, 0xA0, 0x80, 0xFE, 0x00, 0x00, 0x00, 0xFD, 0xFD, 0xC2, 0xA8, 0x88, 0xFD, 0xFD, 0xC2, 0xAC,
+	0x44, 0xFD, 0xFD, 0xC2, 0xAC, 0xCC, 0xFD, 0xFD, 0xC2, 0xAC, 0x44, 0xFD, 0xFD, 0xC2, 0xA8, 0x88,
+	0xFD, 0xFD, 0xC2, 0xAC, 0xCC, 0xFD, 0xFD, 0xC2, 0xAC, 0x44, 0xFD, 0xFD, 0xC2, 0xAC, 0xCC, 0xFD,
+	0xFD, 0xC2, 0xA8, 0x88, 0xFD, 0xFD, 0xC2, 0xAC, 0x44, 0xFD, 0xFD, 0xC2, 0xAC, 0xCC, 0xFD, 0xFD,
+	0xC2, 0xAC, 0x44, 0xFD, 0xFD, 0xC2, 0xAC, 0xCC, 0xFD, 0xFD, 0xC2, 0xA8, 0x88, 0xFD, 0xFD, 0xC2,
+	0xAC, 0x44, 0xFD, 0xFD, 0xC2, 0xAC, 0xCC, 0xFD, 0xFD, 0xC2, 0xAC, 0x44, 0xFD, 0xFD, 0xC2, 0xA8,
+	0x88, 0xFD, 0xFD, 0xC2, 0xAC, 0xCC, 0xFD, 0xFD, 0xC2, 0xAC, 0x44, 0xFD, 0xFD, 0xC2, 0xAC, 0xCC,
+	0xFD, 0xFD, 0xC2, 0xA8, 0x88, 0xFD, 0xFD, 0xC2, 0xAC, 0x44, 0xFD, 0xFD, 0xC2, 0xA4, 0xCC, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xA4,
+	0x44, 0x2D, 0xA4, 0x44, 0xA4, 0xCC, 0x39, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4,
+	0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0x19, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xC1, 0xA4, 0xCC, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC1, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xC1, 0xA4, 0xCC, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC1, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xC1, 0xA4, 0xCC, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC1, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xC1, 0xA4, 0xCC, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC1, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xC1, 0xA4, 0xCC, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC1, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xC1, 0xA4, 0xCC, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC1,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xC1, 0xA4,
+	0xCC, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC1, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xC1, 0xA4, 0xCC, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC1, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xC1, 0xA4, 0xCC, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC1, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xC1, 0xA4, 0xCC, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC1, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35,
+	0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xC1, 0xA4, 0xCC, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0,
+	0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC1, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44,
+	0xA4, 0xCC, 0xA4, 0x44, 0xC1, 0xA4, 0xCC, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0, 0x11, 0xC0, 0x35, 0xC0,
+	0x11, 0xC0, 0x35, 0xC1, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC, 0xA4, 0x44, 0xA4, 0xCC,
+	0xA4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+};
+
+const uint32_t Image_TestCard_Size = sizeof(Image_TestCard);
@@ -0,0 +1,118 @@
+#include "Parallel_8080.h"
+
+#define PARALLEL_8080_CONTROL  (PARALLEL_8080_WR_PIN | PARALLEL_8080_DC_PIN | PARALLEL_8080_CS_PIN)
+
+/**
+ * @brief 计算WR为低时的端口值（内部函数）
+ * @param DC D/C电平
+ * @return 数据线为0、CS与WR为低、D/C按参数，高8位其余引脚保持当前电平
+ */
+static uint32_t Parallel_8080_Base(uint8_t DC)
+{
+	uint32_t Base = PARALLEL_8080_PORT->PIN & ~(uint32_t)(0x00FF | PARALLEL_8080_CONTROL);
+	return DC ? (Base | PARALLEL_8080_DC_PIN) : Base;
+}
+
+/**
+ * @brief 初始化引脚实现
+ */
+void Parallel_8080_Initialize(void)
+{
+	GPIO_InitTypeDef GPIO_InitStruct;
+	GPIO_InitStruct.GPIO_Pin = GPIO_PIN_LNIB | PARALLEL_8080_CONTROL;
+	GPIO_InitStruct.GPIO_Mode = GPIO_Mode_OUT_PP;
+	GPIO_InitStruct.GPIO_DriveLevel = 0;
+	GPIO_Init(PARALLEL_8080_PORT, &GPIO_InitStruct);
+	PARALLEL_8080_WRITE((PARALLEL_8080_PORT->PIN & ~(uint32_t)0x00FF) | PARALLEL_8080_CONTROL);
+}
+
+/**
+ * @brief 写入字节实现
+ * @param DC D/C电平
+ * @param Data 数据
+ * @param Length 字节数
+ */
+void Parallel_8080_Write(uint8_t DC, const uint8_t * Data, uint32_t Length)
+{
+	uint32_t Low = Parallel_8080_Base(DC);
+	uint32_t High = Low | PARALLEL_8080_WR_PIN;
+	while (Length--)
+	{
+		uint32_t Byte = *Data++;
+		PARALLEL_8080_WRITE(Low | Byte);
+		PARALLEL_8080_WRITE(High | Byte);
+	}
+}
+
+/**
+ * @brief 写入像素实现
+ * @param Pixels 像素
+ * @param Count 像素个数
+ */
+void Parallel_8080_Write_Pixels(const uint16_t * Pixels, uint32_t Count)
+{
+	uint32_t Low = Parallel_8080_Base(1);
+	uint32_t High = Low | PARALLEL_8080_WR_PIN;
+	// 每次循环两个像素，减少循环判断与跳转
+	for (; Count >= 2; Count -= 2, Pixels += 2)
+	{
+		uint32_t First = Pixels[0];
+		uint32_t Second = Pixels[1];
+		PARALLEL_8080_WRITE(Low | (First >> 8));
+		PARALLEL_8080_WRITE(High | (First >> 8));
+		PARALLEL_8080_WRITE(Low | (First & 0xFF));
+		PARALLEL_8080_WRITE(High | (First & 0xFF));
+		PARALLEL_8080_WRITE(Low | (Second >> 8));
+		PARALLEL_8080_WRITE(High | (Second >> 8));
+		PARALLEL_8080_WRITE(Low | (Second & 0xFF));
+		PARALLEL_8080_WRITE(High | (Second & 0xFF));
+	}
+	if (Count != 0)
+	{
+		uint32_t Pixel = *Pixels;
+		PARALLEL_8080_WRITE(Low | (Pixel >> 8));
+		PARALLEL_8080_WRITE(High | (Pixel >> 8));
+		PARALLEL_8080_WRITE(Low | (Pixel & 0xFF));
+		PARALLEL_8080_WRITE(High | (Pixel & 0xFF));
+	}
+}
+
+/**
+ * @brief 重复写入像素实现
+ * @param Color RGB565颜色
+ * @param Count 像素个数
+ */
+void Parallel_8080_Fill(uint16_t Color, uint32_t Count)
+{
+	uint32_t Low = Parallel_8080_Base(1);
+	uint32_t High_Low = Low | (Color >> 8);
+	uint32_t High_High = High_Low | PARALLEL_8080_WR_PIN;
+	uint32_t Low_Low = Low | (Color & 0xFF);
+	uint32_t Low_High = Low_Low | PARALLEL_8080_WR_PIN;
+	for (; Count >= 2; Count -= 2)
+	{
+		PARALLEL_8080_WRITE(High_Low);
+		PARALLEL_8080_WRITE(High_High);
+		PARALLEL_8080_WRITE(Low_Low);
+		PARALLEL_8080_WRITE(Low_High);
+		PARALLEL_8080_WRITE(High_Low);
+		PARALLEL_8080_WRITE(High_High);
+		PARALLEL_8080_WRITE(Low_Low);
+		PARALLEL_8080_WRITE(Low_High);
+	}
+	if (Count != 0)
+	{
+		PARALLEL_8080_WRITE(High_Low);
+		PARALLEL_8080_WRITE(High_High);
+		PARALLEL_8080_WRITE(Low_Low);
+		PARALLEL_8080_WRITE(Low_High);
+	}
+}
+
+/**
+ * @brief 结束传输实现
+ */
+void Parallel_8080_Release(void)
+{
+	PARALLEL_8080_WRITE(PARALLEL_8080_PORT->PIN | PARALLEL_8080_CS_PIN | PARALLEL_8080_WR_PIN);
+}
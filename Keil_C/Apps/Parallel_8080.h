@@ -0,0 +1,71 @@
+/**
+ * @file Parallel_8080.h
+ * @brief 8080并口（8位）屏幕总线头文件
+ * @note 数据线D0~D7接同一端口的Pin0~7，WR、D/C、CS接该端口的高8位，RD接高电平。
+ *       每个字节由CPU写两次PIN寄存器：第一次放出数据并拉低WR，第二次拉高WR，
+ *       屏幕在WR上升沿锁存，数据与控制线一次写入，不需要读-改-写。
+ *       写入是同步的，函数返回时数据已全部送出。
+ *       没有定时器触发DMA的版本：DMA0/DMA1已分别用于终端与SPI0发送；
+ *       按字节写PIN地址会落到单引脚的位寄存器上，DMA只能按半字写整个端口，
+ *       每个字节要在内存中展开成两个半字（每像素8字节），展开的开销与CPU直接写端口相同
+ */
+
+#ifndef PARALLEL_8080_H
+#define PARALLEL_8080_H
+
+#include "SC_Init.h"
+
+/**
+ * 引脚分配（推挽输出），需按实际接线修改；端口高8位中其余引脚的电平在每次写入时保持，
+ * 但写入期间不能由其他任务或中断修改
+ */
+#ifndef PARALLEL_8080_PORT
+#define PARALLEL_8080_PORT     GPIOA
+#define PARALLEL_8080_WR_PIN   GPIO_Pin_8
+#define PARALLEL_8080_DC_PIN   GPIO_Pin_9
+#define PARALLEL_8080_CS_PIN   GPIO_Pin_10
+#endif
+
+/**
+ * 写整个端口，默认直接写PIN寄存器（与GPIO_Write相同，但不经过函数调用）
+ */
+#ifndef PARALLEL_8080_WRITE
+#define PARALLEL_8080_WRITE(Value) (PARALLEL_8080_PORT->PIN = (Value))
+#endif
+
+/**
+ * @brief 初始化引脚
+ * @note 数据线与控制线设为推挽输出，CS、WR、D/C为高电平
+ */
+void Parallel_8080_Initialize(void);
+
+/**
+ * @brief 写入字节
+ * @param DC D/C电平（0命令，1数据）
+ * @param Data 数据
+ * @param Length 字节数
+ * @note 拉低CS，保持到Parallel_8080_Release
+ */
+void Parallel_8080_Write(uint8_t DC, const uint8_t * Data, uint32_t Length);
+
+/**
+ * @brief 写入RGB565像素（D/C为数据）
+ * @param Pixels 像素（本机字节序），每个像素高字节在前
+ * @param Count 像素个数
+ */
+void Parallel_8080_Write_Pixels(const uint16_t * Pixels, uint32_t Count);
+
+/**
+ * @brief 重复写入同一个像素（D/C为数据）
+ * @param Color RGB565颜色
+ * @param Count 像素个数
+ * @note 四个端口值在循环前算好，每个像素只有四次写入
+ */
+void Parallel_8080_Fill(uint16_t Color, uint32_t Count);
+
+/**
+ * @brief 拉高CS结束传输
+ */
+void Parallel_8080_Release(void);
+
+#endif // PARALLEL_8080_H
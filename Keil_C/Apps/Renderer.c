@@ -0,0 +1,164 @@
+#include "Renderer.h"
+
+#if (RENDERER_BUFFER_PIXELS < ST7789_WIDTH)
+#error "RENDERER_BUFFER_PIXELS must hold at least one full line"
+#endif
+
+static Renderer_Draw Renderer_Draw_Callback;	   // 绘制回调
+static void * Renderer_Context;					   // 绘制回调的参数
+static Renderer_Rect Renderer_Dirty[RENDERER_DIRTY_MAX]; // 脏矩形
+static uint8_t Renderer_Dirty_Count;			   // 脏矩形个数
+static uint8_t Renderer_Next;					   // 下一个用于绘制的缓冲区
+
+/**
+ * 两个行带缓冲区，本机字节序，由SPI0以16位帧直接发送
+ */
+static uint16_t Renderer_Buffer[2][RENDERER_BUFFER_PIXELS];
+
+/**
+ * @brief 判断两个矩形是否重叠或相邻（内部函数）
+ */
+static int Renderer_Touch(const Renderer_Rect * A, const Renderer_Rect * B)
+{
+	return (A->X <= B->X + B->Width) && (B->X <= A->X + A->Width) &&
+		   (A->Y <= B->Y + B->Height) && (B->Y <= A->Y + A->Height);
+}
+
+/**
+ * @brief 求包含两个矩形的最小矩形（内部函数）
+ */
+static Renderer_Rect Renderer_Union(const Renderer_Rect * A, const Renderer_Rect * B)
+{
+	Renderer_Rect R;
+	uint16_t Right = (A->X + A->Width > B->X + B->Width) ? A->X + A->Width : B->X + B->Width;
+	uint16_t Bottom = (A->Y + A->Height > B->Y + B->Height) ? A->Y + A->Height : B->Y + B->Height;
+	R.X = (A->X < B->X) ? A->X : B->X;
+	R.Y = (A->Y < B->Y) ? A->Y : B->Y;
+	R.Width = Right - R.X;
+	R.Height = Bottom - R.Y;
+	return R;
+}
+
+/**
+ * @brief 矩形面积（内部函数）
+ */
+static uint32_t Renderer_Area(const Renderer_Rect * R)
+{
+	return (uint32_t)R->Width * R->Height;
+}
+
+/**
+ * @brief 初始化渲染器实现
+ * @param Draw 绘制回调
+ * @param Context 传给绘制回调的参数
+ */
+void Renderer_Initialize(Renderer_Draw Draw, void * Context)
+{
+	Renderer_Draw_Callback = Draw;
+	Renderer_Context = Context;
+	Renderer_Next = 0;
+	Renderer_Dirty_Count = 0;
+	Renderer_Invalidate(0, 0, ST7789_WIDTH, ST7789_HEIGHT);
+}
+
+/**
+ * @brief 标记需要重绘的矩形实现
+ * @param X 左上角列
+ * @param Y 左上角行
+ * @param Width 宽度
+ * @param Height 高度
+ */
+void Renderer_Invalidate(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height)
+{
+	if (X >= ST7789_WIDTH || Y >= ST7789_HEIGHT || Width == 0 || Height == 0)
+	{
+		return;
+	}
+	Renderer_Rect Rect = { X, Y, Width, Height };
+	if (Rect.Width > ST7789_WIDTH - X)
+	{
+		Rect.Width = ST7789_WIDTH - X;
+	}
+	if (Rect.Height > ST7789_HEIGHT - Y)
+	{
+		Rect.Height = ST7789_HEIGHT - Y;
+	}
+	taskENTER_CRITICAL(); // 进入临界区
+	// 与重叠或相邻的矩形合并，合并后的矩形可能接触到其他矩形，因此从头再查
+	for (uint8_t i = 0; i < Renderer_Dirty_Count; )
+	{
+		if (Renderer_Touch(&Renderer_Dirty[i], &Rect))
+		{
+			Rect = Renderer_Union(&Renderer_Dirty[i], &Rect);
+			Renderer_Dirty[i] = Renderer_Dirty[--Renderer_Dirty_Count];
+			i = 0;
+		}
+		else
+		{
+			i++;
+		}
+	}
+	if (Renderer_Dirty_Count < RENDERER_DIRTY_MAX)
+	{
+		Renderer_Dirty[Renderer_Dirty_Count++] = Rect;
+	}
+	else
+	{
+		// 列表已满：并入使面积增加最少的矩形
+		uint8_t Best = 0;
+		uint32_t Best_Growth = UINT32_MAX;
+		for (uint8_t i = 0; i < RENDERER_DIRTY_MAX; i++)
+		{
+			Renderer_Rect Merged = Renderer_Union(&Renderer_Dirty[i], &Rect);
+			uint32_t Growth = Renderer_Area(&Merged) - Renderer_Area(&Renderer_Dirty[i]);
+			if (Growth < Best_Growth)
+			{
+				Best = i;
+				Best_Growth = Growth;
+			}
+		}
+		Renderer_Dirty[Best] = Renderer_Union(&Renderer_Dirty[Best], &Rect);
+	}
+	taskEXIT_CRITICAL(); // 退出临界区
+}
+
+/**
+ * @brief 重绘并发送全部脏矩形实现
+ * @return 本次发送的像素数
+ */
+uint32_t Renderer_Flush(void)
+{
+	Renderer_Rect Dirty[RENDERER_DIRTY_MAX];
+	uint8_t Count;
+	uint32_t Sent = 0;
+
+	// 取走当前的脏矩形，绘制期间新标记的区域留到下一次刷新
+	taskENTER_CRITICAL(); // 进入临界区
+	Count = Renderer_Dirty_Count;
+	for (uint8_t i = 0; i < Count; i++)
+	{
+		Dirty[i] = Renderer_Dirty[i];
+	}
+	Renderer_Dirty_Count = 0;
+	taskEXIT_CRITICAL(); // 退出临界区
+
+	for (uint8_t i = 0; i < Count; i++)
+	{
+		const Renderer_Rect * Rect = &Dirty[i];
+		uint16_t Band_Rows = RENDERER_BUFFER_PIXELS / Rect->Width;
+		ST7789_SetWindow(Rect->X, Rect->Y, Rect->X + Rect->Width - 1, Rect->Y + Rect->Height - 1);
+		for (uint16_t Row = 0; Row < Rect->Height; Row += Band_Rows)
+		{
+			uint16_t Rows = (Rect->Height - Row < Band_Rows) ? Rect->Height - Row : Band_Rows;
+			uint32_t Pixels = (uint32_t)Rect->Width * Rows;
+			uint16_t * Buffer = Renderer_Buffer[Renderer_Next];
+			// 只允许另一个缓冲区仍在发送，这一个必须已被DMA读完
+			ST7789_Wait_Pixels(1);
+			Renderer_Draw_Callback(Rect->X, Rect->Y + Row, Rect->Width, Rows, Buffer, Renderer_Context);
+			ST7789_Write_Pixels(Buffer, Pixels, 1);
+			Renderer_Next ^= 1;
+			Sent += Pixels;
+		}
+	}
+	return Sent;
+}
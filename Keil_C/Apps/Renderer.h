@@ -0,0 +1,81 @@
+/**
+ * @file Renderer.h
+ * @brief 双缓冲分块渲染模块头文件
+ * @note 不保存整帧显存：应用程序标记需要重绘的矩形（脏矩形），刷新时按行带
+ *       调用绘制回调把像素画进两个小缓冲区之一，一个缓冲区由DMA发往屏幕的同时
+ *       CPU绘制另一个，只有脏矩形内的像素会被重新发送
+ */
+
+#ifndef RENDERER_H
+#define RENDERER_H
+
+#include "ST7789.h"
+
+/**
+ * 每个行带缓冲区的像素数（两个缓冲区共占4倍字节），不能小于屏幕宽度
+ */
+#ifndef RENDERER_BUFFER_PIXELS
+#define RENDERER_BUFFER_PIXELS  (ST7789_WIDTH * 2)
+#endif
+
+/**
+ * 最多记录的脏矩形个数，超出时合并到增加面积最小的矩形
+ */
+#ifndef RENDERER_DIRTY_MAX
+#define RENDERER_DIRTY_MAX      8
+#endif
+
+/**
+ * @brief 绘制回调
+ * @param X 区域左上角列
+ * @param Y 区域左上角行
+ * @param Width 区域宽度（同时是Pixels的行跨度）
+ * @param Height 区域高度
+ * @param Pixels 输出的RGB565像素，按行排列、本机字节序，每个像素都必须写入
+ * @param Context Renderer_Initialize传入的参数
+ * @note 在调用Renderer_Flush的任务中执行，只能读取界面状态，不能调用本模块的函数
+ */
+typedef void (*Renderer_Draw)(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height,
+							  uint16_t * Pixels, void * Context);
+
+/**
+ * @struct Renderer_Rect
+ * @brief 屏幕上的矩形区域
+ */
+typedef struct
+{
+	uint16_t             X;					   // 左上角列
+	uint16_t             Y;					   // 左上角行
+	uint16_t             Width;				   // 宽度
+	uint16_t             Height;			   // 高度
+} Renderer_Rect;
+
+/**
+ * @brief 初始化渲染器
+ * @param Draw 绘制回调
+ * @param Context 传给绘制回调的参数
+ * @note 需先调用ST7789_Initialize；初始化后整个屏幕被标记为脏
+ */
+void Renderer_Initialize(Renderer_Draw Draw, void * Context);
+
+/**
+ * @brief 标记需要重绘的矩形
+ * @param X 左上角列
+ * @param Y 左上角行
+ * @param Width 宽度
+ * @param Height 高度
+ * @note 超出屏幕的部分被裁剪，与已有脏矩形重叠时合并，
+ *       可在任意任务中调用（与Renderer_Flush之间用临界区保护）
+ */
+void Renderer_Invalidate(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height);
+
+/**
+ * @brief 重绘并发送全部脏矩形
+ * @return 本次发送的像素数
+ * @note 每个行带发出后立即绘制下一个行带，只在要复用的缓冲区仍在发送时等待，
+ *       返回时最后一个行带可能仍在发送（下一次Flush或ST7789_Release前完成）；
+ *       传输完成通知发给调用任务，因此必须始终在同一个任务中调用
+ */
+uint32_t Renderer_Flush(void);
+
+#endif // RENDERER_H
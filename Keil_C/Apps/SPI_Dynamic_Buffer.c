@@ -1,53 +1,414 @@
 #include "SPI_Dynamic_Buffer.h"
 #include "sc32f1xxx_dma.h"
+#include "DMA-Receive-Manager.h"
+#include <string.h>
+
+#define SPI_QUEUE_MASK (SPI_QUEUE_LENGTH - 1u)
 
 SPI_Chunk_Buffer spi0;
 
+/*
+ * Wait until everything written to SPI0 has been shifted out.
+ * TXEIF only says the last frame has moved into the shift register, so spin for
+ * one more frame (8 SPI clocks = 8 << SPR APB0 cycles, at least one cycle per loop).
+ */
+static void spi_drain(void) {
+    while (SPI_GetFlagStatus(SPI0, SPI_Flag_TXEIF) == RESET);
+    for (volatile uint32_t spin = 8u << ((SPI0->SPI_CON & SPI_CON_SPR_Msk) >> SPI_CON_SPR_Pos); spin != 0; spin--);
+}
+
+/* SPI0 frame size a transaction needs: 1 for 16-bit frames, 0 for bytes */
+static uint8_t spi_wide(const SPI_Transaction *txn) {
+    return (txn->flags & (SPI_TXN_WIDE | SPI_TXN_FILL)) ? 1u : 0u;
+}
+
+/* hand the next segment of the active transaction to DMA1 */
+static void spi_start_segment(SPI_Chunk_Buffer *spi) {
+    uint32_t units = spi->remaining >> spi->wide;   // DMA1 counts frames, not bytes
+    if (units > SPI_SEGMENT_MAX) {
+        units = SPI_SEGMENT_MAX;
+    }
+
+    if (spi->rx_next != NULL) {
+        // armed before DMA1 starts clocking so the first received byte already has somewhere to go
+        DMA_SetDstAddress(spi->rx_dma, (uint32_t)spi->rx_next);
+        DMA_SetCurrDataCounter(spi->rx_dma, units);
+        spi->rx_next += units;
+        DMA_SoftwareTrigger(spi->rx_dma);
+    }
+    DMA_SetSrcAddress(DMA1, (uint32_t)spi->next);
+    DMA_SetCurrDataCounter(DMA1, units);
+    if (!spi->fixed) {
+        spi->next += units << spi->wide;
+    }
+    spi->remaining -= units << spi->wide;
+    DMA_SoftwareTrigger(DMA1);
+}
+
+/*
+ * switch DMA1 and SPI0 between byte transfers, halfword transfers and fixed-source fills or dummy bytes,
+ * only while SPI0 is idle (the firmware library has no call to change the source mode or
+ * width on their own)
+ */
+static void spi_set_mode(SPI_Chunk_Buffer *spi, uint8_t wide, uint8_t fixed) {
+    uint32_t cfg = DMA1->DMA_CFG & ~(DMA_CFG_SAINC | DMA_CFG_TXWIDTH);
+
+    cfg |= fixed ? DMA_SourceMode_FIXED : spi->source_mode;
+    cfg |= wide ? DMA_DataSize_HakfWord : DMA_DataSize_Byte;
+    DMA1->DMA_CFG = cfg;
+    if (wide != spi->wide) {
+        SPI_DataSizeConfig(SPI0, wide ? SPI_DataSize_16B : SPI_DataSize_8B);
+    }
+    spi->wide = wide;
+    spi->fixed = fixed;
+}
+
+/*
+ * Switch SPI0 receive DMA on or off, only while SPI0 is idle. Bytes left over from transmit-only
+ * transfers are dropped first so they do not end up in rx. While receiving, completions come from
+ * the rx channel, which only finishes once the last byte is in, so the DMA1 interrupt is masked:
+ * a late DMA1 completion must not be taken for the next transaction.
+ */
+static void spi_set_receive(SPI_Chunk_Buffer *spi, uint8_t on) {
+    if (on) {
+        DMA_ITConfig(DMA1, DMA_IT_TCIE, DISABLE);
+        while (SPI_GetFlagStatus(SPI0, SPI_Flag_RINEIF) == SET) {
+            (void)SPI_ReceiveData(SPI0);
+        }
+        SPI_ClearFlag(SPI0, SPI_Flag_RXFIF);
+        SPI_DMACmd(SPI0, SPI_DMAReq_RX, ENABLE);
+    } else {
+        SPI_DMACmd(SPI0, SPI_DMAReq_RX, DISABLE);
+        DMA_ClearFlag(DMA1, DMA_FLAG_GIF | DMA_FLAG_TCIF | DMA_FLAG_HTIF | DMA_FLAG_TEIF);
+        DMA_ITConfig(DMA1, DMA_IT_TCIE, ENABLE);
+    }
+    spi->receiving = on;
+}
+
+/* set up the pins for queue[head] and start it, called from the ISR or inside a critical section */
+static void spi_start(SPI_Chunk_Buffer *spi) {
+    SPI_Transaction *txn = &spi->queue[spi->head];
+
+    if (txn->cs_port != NULL) {
+        // another device still selected from a SPI_TXN_KEEP_CS transaction, the bus is drained already
+        if (spi->cs_port != NULL && (spi->cs_port != txn->cs_port || spi->cs_pin != txn->cs_pin)) {
+            GPIO_SetBits(spi->cs_port, spi->cs_pin);
+        }
+        GPIO_ResetBits(txn->cs_port, txn->cs_pin);
+        spi->cs_port = txn->cs_port;
+        spi->cs_pin = txn->cs_pin;
+    }
+    if (txn->dc_port != NULL) {
+        GPIO_WriteBit(txn->dc_port, txn->dc_pin, txn->dc ? Bit_SET : Bit_RESET);
+    }
+    uint8_t fixed = (txn->flags & (SPI_TXN_FILL | SPI_TXN_DUMMY)) != 0;
+    if (spi_wide(txn) != spi->wide || fixed != spi->fixed) {
+        spi_set_mode(spi, spi_wide(txn), fixed);
+    }
+    if ((txn->rx != NULL) != spi->receiving) {
+        spi_set_receive(spi, txn->rx != NULL);
+    }
+    spi->rx_next = txn->rx;
+    spi->next = (txn->bytes != NULL) ? txn->bytes : txn->immediate;
+    spi->remaining = txn->len;
+    spi_start_segment(spi);
+}
+
+/* the shift register only has to be empty if the pins change before the next byte goes out */
+static bool spi_needs_drain(const SPI_Transaction *done, const SPI_Transaction *next) {
+    if (done->rx != NULL) {
+        return false; // completed on the last received byte, the bus is idle already
+    }
+    if (next == NULL || !(done->flags & SPI_TXN_KEEP_CS) || spi_wide(next) != spi_wide(done) || next->rx != NULL) {
+        return true;
+    }
+    if (next->cs_port != NULL && (next->cs_port != done->cs_port || next->cs_pin != done->cs_pin)) {
+        return true;
+    }
+    return next->dc_port != NULL &&
+           (next->dc_port != done->dc_port || next->dc_pin != done->dc_pin || next->dc != done->dc);
+}
+
+/*
+ * Wait until at most limit transactions are queued, one waiting task at a time.
+ * Returns pdFALSE if the timeout expired first.
+ */
+static BaseType_t spi_wait_count(SPI_Chunk_Buffer *spi, uint8_t limit, TimeOut_t *time_out, TickType_t *ticks) {
+    BaseType_t reached = pdFALSE;
+
+    if (xSemaphoreTake(spi->using_s, *ticks) == pdTRUE) {
+        for (;;) {
+            taskENTER_CRITICAL();
+            if (spi->count <= limit) {
+                taskEXIT_CRITICAL();
+                reached = pdTRUE;
+                break;
+            }
+            spi->waiting = xTaskGetCurrentTaskHandle(); // the ISR notifies after every completion
+            taskEXIT_CRITICAL();
+            if (xTaskCheckForTimeOut(time_out, ticks) != pdFALSE) {
+                break;
+            }
+            ulTaskNotifyTakeIndexed(SPI_PROGRESS_INDEX, pdTRUE, *ticks);
+        }
+        taskENTER_CRITICAL();
+        spi->waiting = NULL;
+        taskEXIT_CRITICAL();
+        xSemaphoreGive(spi->using_s);
+    }
+    return reached;
+}
+
+/* reset the queue and DMA1 bookkeeping, everything but the mutex */
+static void spi_reset(SPI_Chunk_Buffer *spi) {
+    spi->head = 0;
+    spi->count = 0;
+    spi->remaining = 0;
+    spi->waiting = NULL;
+    spi->cs_port = NULL;
+    spi->wide = 0;
+    spi->fixed = 0;
+    spi->source_mode = DMA1->DMA_CFG & DMA_CFG_SAINC;
+    spi->rx_dma = NULL;
+    spi->rx_next = NULL;
+    spi->receiving = 0;
+}
+
 void SPI_ChunkBuffer_Init(SPI_Chunk_Buffer *spi) {
+    spi_reset(spi);
     spi->using_s = xSemaphoreCreateMutex();
     if (spi->using_s == NULL) {
         while (1);
     }
-    
-    spi->transmit_s = xSemaphoreCreateBinary();
-    if (spi->transmit_s == NULL) {
+}
+
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+void SPI_ChunkBuffer_InitStatic(SPI_Chunk_Buffer *spi, StaticSemaphore_t *mutex_storage) {
+    if (mutex_storage == NULL) {
         while (1);
     }
-    xSemaphoreGive(spi->transmit_s);
+    spi_reset(spi);
+    spi->using_s = xSemaphoreCreateMutexStatic(mutex_storage);
 }
+#endif
 
-void SPI_Send_One(SPI_Chunk_Buffer *spi, uint8_t bytes) {
-    if (xSemaphoreTake(spi->using_s, portMAX_DELAY) == pdTRUE) {
-        if (xSemaphoreTake(spi->transmit_s, portMAX_DELAY) == pdTRUE) {
-            SPI_SendData(SPI0, bytes);
+void SPI_ChunkBuffer_AttachRx(SPI_Chunk_Buffer *spi, DMA_TypeDef *rx_dma) {
+    DMA_InitTypeDef init;
+    IRQn_Type irq;
+
+    if (rx_dma == DMA0) {
+        irq = DMA0_IRQn;
+#if defined (SC32f10xx)
+    } else if (rx_dma == DMA2) {
+        irq = DMA2_IRQn;
+    } else if (rx_dma == DMA3) {
+        irq = DMA3_IRQn;
+#endif
+    } else {
+        while (1); // DMA1 carries the transmit side
+    }
+    configASSERT(spi->count == 0);
+    // DMA_Init below would take the channel away from the terminal or a UART receiver without any trace
+    configASSERT(!DMA_Buffer_Manager_IsBound(rx_dma) && !DMA_Receive_Manager_IsBound(rx_dma));
+
+    DMA_StructInit(&init);
+    init.DMA_Priority = DMA_Priority_HIGH;   // ahead of DMA1 so the receive side never falls behind
+    init.DMA_SourceMode = DMA_SourceMode_FIXED;
+    init.DMA_TargetMode = DMA_TargetMode_INC;
+    init.DMA_DataSize = DMA_DataSize_Byte;
+    init.DMA_SrcAddress = (uint32_t)&SPI0->SPI_DATA;
+    init.DMA_Request = DMA_Request_SPI0_RX;
+    DMA_Init(rx_dma, &init);
+    DMA_ITConfig(rx_dma, DMA_IT_INTEN | DMA_IT_TCIE, ENABLE);
+    DMA_ITConfig(rx_dma, DMA_IT_HTIE | DMA_IT_TEIE, DISABLE);
+    DMA_DMACmd(rx_dma, DMA_DMAReq_CHRQ, DISABLE);
+    NVIC_SetPriority(irq, 2);   // same level as DMA1 so the two completion paths never preempt each other
+    NVIC_EnableIRQ(irq);
+    DMA_Cmd(rx_dma, ENABLE);
+    spi->rx_dma = rx_dma;
+}
+
+BaseType_t SPI_Submit(SPI_Chunk_Buffer *spi, const SPI_Transaction *txn, TickType_t timeout) {
+    TimeOut_t time_out;
+
+    if (txn->flags & SPI_TXN_FILL) {
+        // len counts the bytes sent, the source is always a single halfword
+        configASSERT(txn->len != 0 && txn->len % 2 == 0 && ((uintptr_t)txn->bytes & 1u) == 0);
+    } else if (txn->flags & SPI_TXN_DUMMY) {
+        configASSERT(txn->len != 0 && txn->bytes == NULL && !(txn->flags & SPI_TXN_WIDE));
+    } else {
+        configASSERT(txn->len != 0 && (txn->bytes != NULL || txn->len <= sizeof(txn->immediate)));
+        configASSERT(!(txn->flags & SPI_TXN_WIDE) || (txn->len % 2 == 0 && ((uintptr_t)txn->bytes & 1u) == 0));
+    }
+    configASSERT(txn->rx == NULL || (spi->rx_dma != NULL && spi_wide(txn) == 0));
+    vTaskSetTimeOutState(&time_out);
+    for (;;) {
+        taskENTER_CRITICAL();
+        if (spi->count < SPI_QUEUE_LENGTH) {
+            SPI_Transaction *slot = &spi->queue[(spi->head + spi->count) & SPI_QUEUE_MASK];
+            *slot = *txn;
+            slot->task = xTaskGetCurrentTaskHandle();
+            if (spi->count++ == 0) {
+                spi_start(spi); // bus idle, nothing will come back through the ISR to start it
+            }
+            taskEXIT_CRITICAL();
+            return pdTRUE;
+        }
+        taskEXIT_CRITICAL();
+        if (spi_wait_count(spi, SPI_QUEUE_LENGTH - 1, &time_out, &timeout) == pdFALSE) {
+            return pdFALSE;
         }
-        xSemaphoreGive(spi->using_s);
     }
 }
 
+BaseType_t SPI_Wait_Complete(TickType_t timeout) {
+    return (ulTaskNotifyTakeIndexed(SPI_NOTIFY_INDEX, pdFALSE, timeout) != 0) ? pdTRUE : pdFALSE;
+}
+
+void SPI_Send_One(SPI_Chunk_Buffer *spi, uint8_t bytes) {
+    SPI_Transaction txn = { 0 };
+
+    txn.len = 1;
+    txn.immediate[0] = bytes;
+    SPI_Submit(spi, &txn, portMAX_DELAY);
+}
+
 void SPI_Send_Multi(SPI_Chunk_Buffer *spi, uint8_t *bytes, uint8_t len) {
-    if (xSemaphoreTake(spi->using_s, portMAX_DELAY) == pdTRUE) {
-        if (xSemaphoreTake(spi->transmit_s, portMAX_DELAY) == pdTRUE) {
-            DMA_SetSrcAddress(DMA1, (uint32_t)bytes);
-            DMA_SetCurrDataCounter(DMA1, len);
-            DMA_SoftwareTrigger(DMA1);
+    SPI_Send_Large(spi, bytes, len);
+}
+
+void SPI_Send_Large(SPI_Chunk_Buffer *spi, const uint8_t *bytes, uint32_t len) {
+    SPI_Transaction txn = { 0 };
+
+    if (len == 0) {
+        return;
+    }
+    txn.bytes = bytes;
+    txn.len = len;
+    SPI_Submit(spi, &txn, portMAX_DELAY);
+}
+
+void SPI_Send_Wide(SPI_Chunk_Buffer *spi, const uint16_t *values, uint32_t count) {
+    SPI_Transaction txn = { 0 };
+
+    if (count == 0) {
+        return;
+    }
+    txn.flags = SPI_TXN_WIDE;
+    txn.bytes = (const uint8_t *)values;
+    txn.len = count * 2;
+    SPI_Submit(spi, &txn, portMAX_DELAY);
+}
+
+void SPI_Send_Fill(SPI_Chunk_Buffer *spi, uint16_t value, uint32_t count) {
+    SPI_Transaction txn = { 0 };
+
+    if (count == 0) {
+        return;
+    }
+    txn.flags = SPI_TXN_FILL;
+    txn.len = count * 2;
+    memcpy(txn.immediate, &value, sizeof(value));
+    SPI_Submit(spi, &txn, portMAX_DELAY);
+}
+
+void SPI_Transfer(SPI_Chunk_Buffer *spi, const uint8_t *tx, uint8_t *rx, uint32_t len) {
+    SPI_Transaction txn = { 0 };
+
+    if (len == 0) {
+        return;
+    }
+    if (tx == NULL) {
+        txn.flags = SPI_TXN_DUMMY;
+        txn.immediate[0] = 0xFF;
+    }
+    txn.bytes = tx;
+    txn.rx = rx;
+    txn.len = len;
+    SPI_Submit(spi, &txn, portMAX_DELAY);
+}
+
+void SPI_Wait_Idle(SPI_Chunk_Buffer *spi) {
+    TimeOut_t time_out;
+    TickType_t ticks = portMAX_DELAY;
+
+    vTaskSetTimeOutState(&time_out);
+    spi_wait_count(spi, 0, &time_out, &ticks);
+}
+
+void SPI_ChunkBuffer_SetMode(SPI_Chunk_Buffer *spi, uint8_t mode) {
+    uint32_t bits = ((mode & 2u) ? SPI_CON_CPOL : 0u) | ((mode & 1u) ? SPI_CON_CPHA : 0u);
+
+    configASSERT(mode <= 3u);
+    for (;;) {
+        SPI_Wait_Idle(spi);
+        taskENTER_CRITICAL();
+        if (spi->count == 0) {
+            // the last transaction was drained before it completed, no frame is on the wire
+            SPI0->SPI_CON = (SPI0->SPI_CON & ~(SPI_CON_CPOL | SPI_CON_CPHA)) | bits;
+            taskEXIT_CRITICAL();
+            return;
         }
-        xSemaphoreGive(spi->using_s);
+        taskEXIT_CRITICAL(); // another task queued a transfer after SPI_Wait_Idle returned
     }
 }
 
-void DMA1_IRQHandler(void) {
-	DMA_ClearFlag(DMA1, DMA_FLAG_GIF|DMA_FLAG_TCIF|DMA_FLAG_HTIF|DMA_FLAG_TEIF);
-    
-    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-    xSemaphoreGiveFromISR(spi0.transmit_s, &xHigherPriorityTaskWoken);
-    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+void SPI_Release(SPI_Chunk_Buffer *spi) {
+    SPI_Wait_Idle(spi);
+    taskENTER_CRITICAL();
+    if (spi->count == 0 && spi->cs_port != NULL) {
+        GPIO_SetBits(spi->cs_port, spi->cs_pin);
+        spi->cs_port = NULL;
+    }
+    taskEXIT_CRITICAL();
 }
 
-void SPI0_IRQHandler(void) {
-	SPI_ClearFlag(SPI0, SPI_Flag_SPIF|SPI_Flag_RINEIF|SPI_Flag_TXEIF|SPI_Flag_RXFIF|SPI_Flag_RXHIF|SPI_Flag_TXHIF|SPI_Flag_WCOL);
-    
+/* the active transaction's current segment is finished, continue it or move on to the next one */
+static void spi_segment_done(SPI_Chunk_Buffer *spi) {
+    if (spi->remaining != 0) {
+        spi_start_segment(spi); // keep streaming, nobody needs to wake up yet
+        return;
+    }
+
     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-    xSemaphoreGiveFromISR(spi0.transmit_s, &xHigherPriorityTaskWoken);
+    SPI_Transaction *done = &spi->queue[spi->head];
+    SPI_Transaction *next = (spi->count > 1) ? &spi->queue[(spi->head + 1) & SPI_QUEUE_MASK] : NULL;
+
+    if (spi_needs_drain(done, next)) {
+        spi_drain();
+    }
+    if (!(done->flags & SPI_TXN_KEEP_CS) && done->cs_port != NULL) {
+        GPIO_SetBits(done->cs_port, done->cs_pin);
+        spi->cs_port = NULL;
+    }
+    if (done->callback != NULL) {
+        done->callback(done->context);
+    }
+    if (done->flags & SPI_TXN_NOTIFY) {
+        vTaskNotifyGiveIndexedFromISR(done->task, SPI_NOTIFY_INDEX, &xHigherPriorityTaskWoken);
+    }
+
+    spi->head = (spi->head + 1) & SPI_QUEUE_MASK;
+    if (--spi->count != 0) {
+        spi_start(spi);
+    }
+    if (spi->waiting != NULL) {
+        vTaskNotifyGiveIndexedFromISR(spi->waiting, SPI_PROGRESS_INDEX, &xHigherPriorityTaskWoken);
+        spi->waiting = NULL;
+    }
     portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 }
+
+void SPI_ChunkBuffer_IRQHandler(SPI_Chunk_Buffer *spi) {
+    if (spi->using_s == NULL || spi->count == 0 || spi->receiving) {
+        return; // not initialised (DMA1 is used by another module), nothing in flight or rx channel in charge
+    }
+    spi_segment_done(spi);
+}
+
+void SPI_ChunkBuffer_RxDispatch(SPI_Chunk_Buffer *spi, DMA_TypeDef *dma) {
+    if (dma != spi->rx_dma || spi->using_s == NULL || spi->count == 0 || !spi->receiving) {
+        return;
+    }
+    spi_segment_done(spi);
+}
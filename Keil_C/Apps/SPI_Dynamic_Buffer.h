@@ -5,18 +5,147 @@
 #include "SC_Init.h"
 #include "FreeRTOS.h"
 #include "semphr.h"
+#include "task.h"
+
+/* longest segment handed to DMA1 in one go, kept within the DMA_CNT range */
+#ifndef SPI_SEGMENT_MAX
+#define SPI_SEGMENT_MAX 4095u
+#endif
+
+/* transactions that can be queued at once, must be a power of two */
+#ifndef SPI_QUEUE_LENGTH
+#define SPI_QUEUE_LENGTH 16u
+#endif
+
+/* task notification indexes: completions of SPI_TXN_NOTIFY transactions, queue progress for waiters */
+#define SPI_NOTIFY_INDEX   2
+#define SPI_PROGRESS_INDEX 3
+
+/* transaction flags */
+#define SPI_TXN_KEEP_CS 0x01u   // leave CS asserted after this transaction, e.g. command followed by data
+#define SPI_TXN_NOTIFY  0x02u   // give the submitting task one SPI_NOTIFY_INDEX notification on completion
+#define SPI_TXN_FILL    0x04u   // repeat one 16-bit value len / 2 times from a fixed DMA source (16-bit frames)
+#define SPI_TXN_WIDE    0x08u   // send bytes as native uint16_t values in 16-bit frames, high byte first
+#define SPI_TXN_DUMMY   0x10u   // send immediate[0] len times from a fixed DMA source, e.g. to clock in rx
+
+/*
+ * One queued SPI0 transfer. SPI_Submit copies the descriptor, only the data pointed to by
+ * bytes has to stay valid until the transaction completes.
+ */
+typedef struct {
+    GPIO_TypeDef *cs_port;           // chip select, driven low before the transfer; NULL leaves CS alone
+    uint16_t cs_pin;
+    GPIO_TypeDef *dc_port;           // D/C line set to dc before the transfer; NULL leaves it alone
+    uint16_t dc_pin;
+    uint8_t dc;                      // D/C level (0 command, 1 data on display controllers)
+    uint8_t flags;                   // SPI_TXN_*
+    const uint8_t *bytes;            // data to send, NULL sends immediate[] instead
+    uint8_t *rx;                     // receives len bytes while sending (8-bit frames only), NULL to discard;
+                                     // needs SPI_ChunkBuffer_AttachRx
+    uint32_t len;                    // number of bytes, at least 1 (at most 4 with immediate[], even in 16-bit modes)
+    uint8_t immediate[4];            // short commands and parameters, or the SPI_TXN_FILL value in native order;
+                                     // follows a 32-bit member so it is word aligned for halfword DMA
+    void (*callback)(void *context); // called from the DMA1 ISR once DMA1 has read the last byte
+    void *context;
+    TaskHandle_t task;               // submitting task, filled in by SPI_Submit
+} SPI_Transaction;
 
 typedef struct {
-    SemaphoreHandle_t transmit_s;
-    SemaphoreHandle_t using_s;
+    SemaphoreHandle_t using_s;       // serialises tasks waiting on queue progress
+    const uint8_t *next;             // start of the next segment, advanced by the DMA1 ISR
+    volatile uint32_t remaining;     // bytes of the active transaction not yet handed to DMA1
+    SPI_Transaction queue[SPI_QUEUE_LENGTH];
+    volatile uint8_t head;           // active transaction
+    volatile uint8_t count;          // queued transactions including the active one
+    TaskHandle_t volatile waiting;   // task waiting for space or for the queue to empty
+    GPIO_TypeDef *cs_port;           // chip select currently held low, NULL if none
+    uint16_t cs_pin;
+    uint8_t wide;                    // SPI0 sends 16-bit frames and DMA1 moves halfwords
+    uint8_t fixed;                   // DMA1 source address does not advance (SPI_TXN_FILL)
+    uint32_t source_mode;            // DMA1 source address mode from SC_DMA1_Init, restored after fills
+    DMA_TypeDef *rx_dma;             // channel on DMA_Request_SPI0_RX, NULL if receiving is not available
+    uint8_t *rx_next;                // start of the next receive segment, NULL if the active transaction has no rx
+    uint8_t receiving;               // SPI0 RX DMA requests on, DMA1 completion interrupt masked
 } SPI_Chunk_Buffer;
 
 extern SPI_Chunk_Buffer spi0;
 
 void SPI_ChunkBuffer_Init(SPI_Chunk_Buffer *spi);
 
+#if (configSUPPORT_STATIC_ALLOCATION == 1)
+/*
+ * same as SPI_ChunkBuffer_Init, but the mutex lives in mutex_storage instead of the FreeRTOS heap;
+ * the transaction queue is already part of SPI_Chunk_Buffer, so nothing else is allocated.
+ * mutex_storage has to stay valid for as long as spi is used
+ */
+void SPI_ChunkBuffer_InitStatic(SPI_Chunk_Buffer *spi, StaticSemaphore_t *mutex_storage);
+#endif
+
+/*
+ * set up rx_dma to move SPI0 receive data into transaction rx buffers, call after SPI_ChunkBuffer_Init.
+ * Transactions with rx complete on this channel's interrupt, once the last byte has been received.
+ * SC32F12xx only has DMA0 and DMA1, so this has to be a channel no other module is using
+ * (e.g. DMA0 without the DMA terminal); SC32F10xx can use DMA2 or DMA3.
+ * Channels bound to a DMA_Buffer_Manager or DMA_Receive_Manager trip configASSERT.
+ */
+void SPI_ChunkBuffer_AttachRx(SPI_Chunk_Buffer *spi, DMA_TypeDef *rx_dma);
+
+/*
+ * queue a transaction behind the ones already submitted and return without waiting for it,
+ * blocks up to timeout while the queue is full and returns pdFALSE if it stayed full
+ */
+BaseType_t SPI_Submit(SPI_Chunk_Buffer *spi, const SPI_Transaction *txn, TickType_t timeout);
+
+/* consume one completion of a SPI_TXN_NOTIFY transaction submitted by the calling task */
+BaseType_t SPI_Wait_Complete(TickType_t timeout);
+
+/* queue one byte, it is copied so the caller does not keep anything alive */
 void SPI_Send_One(SPI_Chunk_Buffer *spi, uint8_t bytes);
 
+/* queue len bytes, bytes must stay valid until the transfer completes (see SPI_Wait_Idle) */
 void SPI_Send_Multi(SPI_Chunk_Buffer *spi, uint8_t *bytes, uint8_t len);
 
+/*
+ * same as SPI_Send_Multi for any length: the DMA1 ISR chains SPI_SEGMENT_MAX segments
+ * back to back and only moves on once the whole buffer has been sent
+ */
+void SPI_Send_Large(SPI_Chunk_Buffer *spi, const uint8_t *bytes, uint32_t len);
+
+/*
+ * queue count native-order uint16_t values as 16-bit frames, half the DMA transfers of SPI_Send_Large
+ * for the same data and no byte swapping; values must stay valid until the transfer completes
+ */
+void SPI_Send_Wide(SPI_Chunk_Buffer *spi, const uint16_t *values, uint32_t count);
+
+/*
+ * queue count repetitions of one RGB565 value without a RAM buffer: DMA1 reads the value from a fixed
+ * address in halfword steps and SPI0 shifts it out as 16-bit frames, high byte first
+ */
+void SPI_Send_Fill(SPI_Chunk_Buffer *spi, uint16_t value, uint32_t count);
+
+/*
+ * queue a full-duplex transfer of len bytes: tx is sent (NULL sends 0xFF dummy bytes from a fixed
+ * source) while the same number of bytes is received into rx; both must stay valid until the
+ * transfer completes (see SPI_Wait_Idle)
+ */
+void SPI_Transfer(SPI_Chunk_Buffer *spi, const uint8_t *tx, uint8_t *rx, uint32_t len);
+
+/* blocks until every queued transaction has completed and its last byte has left SPI0 */
+void SPI_Wait_Idle(SPI_Chunk_Buffer *spi);
+
+/*
+ * switch SPI0 to SPI mode 0-3 (bit 1 CPOL, bit 0 CPHA) once the queue is empty and the last frame
+ * has left the bus; SC_SPI0_Init leaves mode 2, which neither the ST7789 nor SPI NOR flash accept
+ */
+void SPI_ChunkBuffer_SetMode(SPI_Chunk_Buffer *spi, uint8_t mode);
+
+/* SPI_Wait_Idle, then raise a chip select left asserted by SPI_TXN_KEEP_CS */
+void SPI_Release(SPI_Chunk_Buffer *spi);
+
+/* call from DMA1_IRQHandler after the flags are cleared */
+void SPI_ChunkBuffer_IRQHandler(SPI_Chunk_Buffer *spi);
+
+/* call from the DMA IRQ handlers after the flags are cleared, only acts on the channel given to SPI_ChunkBuffer_AttachRx */
+void SPI_ChunkBuffer_RxDispatch(SPI_Chunk_Buffer *spi, DMA_TypeDef *dma);
+
 #endif // SPI_DYNAMIC_BUFFER_H
@@ -0,0 +1,429 @@
+#include "SPI_Flash.h"
+#include <string.h>
+
+#define SPI_FLASH_CACHE_EMPTY 0xFFFFFFFFUL	   // 空缓存页的页号
+
+/**
+ * @struct SPI_Flash_Cache_Page
+ * @brief 一个缓存页
+ */
+typedef struct
+{
+    uint32_t             Page;				   // 页号（地址/SPI_FLASH_PAGE_SIZE），空页为SPI_FLASH_CACHE_EMPTY
+    uint32_t             Used;				   // 最近一次访问的序号，最小者最先被替换
+    uint8_t              Data[SPI_FLASH_PAGE_SIZE]; // 页内容（DMA直接接收到这里）
+} SPI_Flash_Cache_Page;
+
+static SPI_Chunk_Buffer * SPI_Flash_SPI;			  // SPI0的传输管理
+static SemaphoreHandle_t SPI_Flash_Lock;			  // 保证一条命令序列不被其他任务打断
+static SPI_Flash_Info SPI_Flash_Chip;				  // JEDEC ID与容量
+static SPI_Flash_Statistics SPI_Flash_Stats;		  // 读取统计
+static SPI_Flash_Cache_Page SPI_Flash_Cache[SPI_FLASH_CACHE_PAGES]; // 页缓存
+static uint32_t SPI_Flash_Clock;					  // 缓存访问序号
+static uint8_t SPI_Flash_Pending;					  // 已发出擦除命令，尚未确认完成
+static uint8_t SPI_Flash_Header[5];				  // 快速读的命令、地址与哑字节（DMA从这里读取）
+static uint8_t SPI_Flash_Reply[3];				  // 状态寄存器与JEDEC ID（DMA接收到这里）
+
+/**
+ * @brief 把一段传输加入SPI0队列（内部函数）
+ * @param Data 发送的数据，NULL时发送Immediate中的字节，两者都为NULL时发送哑字节0xFF
+ * @param Immediate 不超过4字节的短数据（随描述符复制，调用者无需保留）
+ * @param Rx 接收缓冲区，NULL时丢弃收到的数据
+ * @param Length 长度
+ * @param Flags SPI_TXN_KEEP_CS（命令序列还有后续）或SPI_TXN_NOTIFY（序列的最后一段）
+ */
+static void SPI_Flash_Queue(const uint8_t * Data, const uint8_t * Immediate, uint8_t * Rx, uint32_t Length, uint8_t Flags)
+{
+	SPI_Transaction Transaction = { 0 };
+	Transaction.cs_port = SPI_FLASH_CS_PORT;
+	Transaction.cs_pin = SPI_FLASH_CS_PIN;
+	Transaction.flags = Flags;
+	Transaction.bytes = Data;
+	Transaction.rx = Rx;
+	Transaction.len = Length;
+	if (Immediate != NULL)
+	{
+		memcpy(Transaction.immediate, Immediate, Length);
+	}
+	else if (Data == NULL)
+	{
+		Transaction.flags |= SPI_TXN_DUMMY;
+		Transaction.immediate[0] = 0xFF;
+	}
+	SPI_Submit(SPI_Flash_SPI, &Transaction, portMAX_DELAY);
+}
+
+/**
+ * @brief 发送命令与3字节地址（内部函数）
+ */
+static void SPI_Flash_Command(uint8_t Command, uint32_t Address, uint8_t Flags)
+{
+	uint8_t Head[4] = { Command, (uint8_t)(Address >> 16), (uint8_t)(Address >> 8), (uint8_t)Address };
+	SPI_Flash_Queue(NULL, Head, NULL, sizeof(Head), Flags);
+}
+
+/**
+ * @brief 写使能（内部函数）
+ * @note 单独占用一次片选，片选拉高后WEL才生效
+ */
+static void SPI_Flash_Write_Enable(void)
+{
+	uint8_t Command = SPI_FLASH_WRITE_ENABLE;
+	SPI_Flash_Queue(NULL, &Command, NULL, 1, 0);
+}
+
+/**
+ * @brief 读取寄存器到SPI_Flash_Reply（内部函数）
+ * @param Command 读命令（状态寄存器或JEDEC ID）
+ * @param Length 读取的字节数
+ */
+static void SPI_Flash_Read_Register(uint8_t Command, uint32_t Length)
+{
+	SPI_Flash_Queue(NULL, &Command, NULL, 1, SPI_TXN_KEEP_CS);
+	SPI_Flash_Queue(NULL, NULL, SPI_Flash_Reply, Length, SPI_TXN_NOTIFY);
+	SPI_Wait_Complete(portMAX_DELAY);
+}
+
+/**
+ * @brief 轮询状态寄存器直到Flash不忙（内部函数，调用者持有锁）
+ * @param Timeout 最长等待时间（tick）
+ * @param Sleep 非0时每次轮询间隔一个tick（擦除），否则只让出CPU（页编程约1ms内完成）
+ * @return 完成返回pdTRUE，超时返回pdFALSE
+ */
+static BaseType_t SPI_Flash_Wait_Ready(TickType_t Timeout, uint8_t Sleep)
+{
+	TimeOut_t Time_Out;
+	vTaskSetTimeOutState(&Time_Out);
+	for (;;)
+	{
+		SPI_Flash_Read_Register(SPI_FLASH_READ_STATUS, 1);
+		if (!(SPI_Flash_Reply[0] & SPI_FLASH_STATUS_BUSY))
+		{
+			SPI_Flash_Pending = 0;
+			return pdTRUE;
+		}
+		if (xTaskCheckForTimeOut(&Time_Out, &Timeout) != pdFALSE)
+		{
+			return pdFALSE;
+		}
+		if (Sleep)
+		{
+			vTaskDelay(1);
+		}
+		else
+		{
+			taskYIELD();
+		}
+	}
+}
+
+/**
+ * @brief 获取锁并等待尚未结束的擦除（内部函数）
+ */
+static void SPI_Flash_Enter(void)
+{
+	xSemaphoreTake(SPI_Flash_Lock, portMAX_DELAY);
+	if (SPI_Flash_Pending)
+	{
+		SPI_Flash_Wait_Ready(portMAX_DELAY, 1);
+	}
+}
+
+/**
+ * @brief 快速读：命令、地址与哑字节之后由DMA连续接收（内部函数）
+ */
+static void SPI_Flash_Burst(uint32_t Address, uint8_t * Buffer, uint32_t Length)
+{
+	SPI_Flash_Header[0] = SPI_FLASH_FAST_READ;
+	SPI_Flash_Header[1] = (uint8_t)(Address >> 16);
+	SPI_Flash_Header[2] = (uint8_t)(Address >> 8);
+	SPI_Flash_Header[3] = (uint8_t)Address;
+	SPI_Flash_Header[4] = 0xFF;
+	SPI_Flash_Queue(SPI_Flash_Header, NULL, NULL, sizeof(SPI_Flash_Header), SPI_TXN_KEEP_CS);
+	SPI_Flash_Queue(NULL, NULL, Buffer, Length, SPI_TXN_NOTIFY);
+	SPI_Wait_Complete(portMAX_DELAY);
+	SPI_Flash_Stats.Bus_Reads++;
+}
+
+/**
+ * @brief 作废与地址范围重叠的缓存页（内部函数）
+ */
+static void SPI_Flash_Drop(uint32_t Address, uint32_t Length)
+{
+	uint32_t First = Address / SPI_FLASH_PAGE_SIZE;
+	uint32_t Last = (Address + Length - 1) / SPI_FLASH_PAGE_SIZE;
+	for (uint32_t i = 0; i < SPI_FLASH_CACHE_PAGES; i++)
+	{
+		if (SPI_Flash_Cache[i].Page >= First && SPI_Flash_Cache[i].Page <= Last)
+		{
+			SPI_Flash_Cache[i].Page = SPI_FLASH_CACHE_EMPTY;
+		}
+	}
+}
+
+/**
+ * @brief 查找缓存页，未命中时替换最久未使用的页（内部函数）
+ * @param Page 页号
+ * @return 已装入该页内容的缓存页
+ */
+static SPI_Flash_Cache_Page * SPI_Flash_Lookup(uint32_t Page)
+{
+	SPI_Flash_Cache_Page * Victim = &SPI_Flash_Cache[0];
+	for (uint32_t i = 0; i < SPI_FLASH_CACHE_PAGES; i++)
+	{
+		SPI_Flash_Cache_Page * Entry = &SPI_Flash_Cache[i];
+		if (Entry->Page == Page)
+		{
+			Entry->Used = ++SPI_Flash_Clock;
+			SPI_Flash_Stats.Cache_Hits++;
+			return Entry;
+		}
+		// 空页优先，其次是最久未使用的页
+		if (Victim->Page != SPI_FLASH_CACHE_EMPTY &&
+			(Entry->Page == SPI_FLASH_CACHE_EMPTY || Entry->Used < Victim->Used))
+		{
+			Victim = Entry;
+		}
+	}
+	SPI_Flash_Stats.Cache_Misses++;
+	Victim->Page = SPI_FLASH_CACHE_EMPTY; // 装入失败时不留下旧内容
+	SPI_Flash_Burst(Page * SPI_FLASH_PAGE_SIZE, Victim->Data, SPI_FLASH_PAGE_SIZE);
+	Victim->Page = Page;
+	Victim->Used = ++SPI_Flash_Clock;
+	return Victim;
+}
+
+/**
+ * @brief 发出擦除命令（内部函数）
+ * @param Command 擦除命令
+ * @param Address 区域内任意地址
+ * @param Size 区域大小
+ */
+static void SPI_Flash_Erase(uint8_t Command, uint32_t Address, uint32_t Size)
+{
+	Address &= ~(Size - 1);
+	configASSERT(Address < SPI_Flash_Chip.Size);
+	SPI_Flash_Enter();
+	SPI_Flash_Write_Enable();
+	SPI_Flash_Command(Command, Address, SPI_TXN_NOTIFY);
+	SPI_Wait_Complete(portMAX_DELAY);
+	SPI_Flash_Pending = 1;
+	SPI_Flash_Drop(Address, Size);
+	xSemaphoreGive(SPI_Flash_Lock);
+}
+
+/**
+ * @brief 初始化Flash实现
+ * @param SPI SPI0的传输管理
+ * @return 读到有效的JEDEC ID返回1，否则返回0
+ */
+uint8_t SPI_Flash_Initialize(SPI_Chunk_Buffer * const SPI)
+{
+	if (SPI == NULL || SPI->using_s == NULL || SPI->rx_dma == NULL)
+	{
+		while(1); // 需先调用SPI_ChunkBuffer_Init与SPI_ChunkBuffer_AttachRx
+	}
+	if (SPI_Flash_Lock == NULL)
+	{
+		SPI_Flash_Lock = xSemaphoreCreateMutex();
+		if (SPI_Flash_Lock == NULL)
+		{
+			while(1);
+		}
+	}
+	SPI_Flash_SPI = SPI;
+	SPI_ChunkBuffer_SetMode(SPI, 3); // NOR Flash只支持模式0/3
+	GPIO_InitTypeDef GPIO_InitStruct;
+	GPIO_InitStruct.GPIO_Pin = SPI_FLASH_CS_PIN;
+	GPIO_InitStruct.GPIO_Mode = GPIO_Mode_OUT_PP;
+	GPIO_InitStruct.GPIO_DriveLevel = 0;
+	GPIO_Init(SPI_FLASH_CS_PORT, &GPIO_InitStruct);
+	GPIO_SetBits(SPI_FLASH_CS_PORT, SPI_FLASH_CS_PIN);
+
+	xSemaphoreTake(SPI_Flash_Lock, portMAX_DELAY);
+	SPI_Flash_Pending = 0;
+	memset(&SPI_Flash_Stats, 0, sizeof(SPI_Flash_Stats));
+	for (uint32_t i = 0; i < SPI_FLASH_CACHE_PAGES; i++)
+	{
+		SPI_Flash_Cache[i].Page = SPI_FLASH_CACHE_EMPTY;
+	}
+	SPI_Flash_Read_Register(SPI_FLASH_JEDEC_ID, 3);
+	SPI_Flash_Chip.Manufacturer = SPI_Flash_Reply[0];
+	SPI_Flash_Chip.Memory_Type = SPI_Flash_Reply[1];
+	SPI_Flash_Chip.Capacity = SPI_Flash_Reply[2];
+	// 没有接Flash时MISO读到全0或全1；容量代码超出3字节地址范围的芯片不支持
+	uint8_t Valid = (SPI_Flash_Chip.Manufacturer != 0x00) && (SPI_Flash_Chip.Manufacturer != 0xFF) &&
+					(SPI_Flash_Chip.Capacity >= 0x10) && (SPI_Flash_Chip.Capacity <= 0x18);
+	SPI_Flash_Chip.Size = Valid ? (1UL << SPI_Flash_Chip.Capacity) : 0;
+	xSemaphoreGive(SPI_Flash_Lock);
+	return Valid;
+}
+
+/**
+ * @brief 读取JEDEC ID与容量实现
+ */
+const SPI_Flash_Info * SPI_Flash_GetInfo(void)
+{
+	return &SPI_Flash_Chip;
+}
+
+/**
+ * @brief 直接从Flash读取实现
+ * @param Address 起始地址
+ * @param Buffer 输出缓冲区
+ * @param Length 长度
+ */
+void SPI_Flash_Read(uint32_t Address, uint8_t * Buffer, uint32_t Length)
+{
+	if (Length == 0)
+	{
+		return;
+	}
+	configASSERT(Address + Length <= SPI_Flash_Chip.Size);
+	SPI_Flash_Enter();
+	SPI_Flash_Burst(Address, Buffer, Length);
+	xSemaphoreGive(SPI_Flash_Lock);
+}
+
+/**
+ * @brief 经页缓存读取实现
+ * @param Address 起始地址
+ * @param Buffer 输出缓冲区
+ * @param Length 长度
+ */
+void SPI_Flash_Read_Cached(uint32_t Address, uint8_t * Buffer, uint32_t Length)
+{
+	if (Length == 0)
+	{
+		return;
+	}
+	configASSERT(Address + Length <= SPI_Flash_Chip.Size);
+	SPI_Flash_Enter();
+	while (Length != 0)
+	{
+		uint32_t Offset = Address % SPI_FLASH_PAGE_SIZE;
+		uint32_t Chunk = (Length < SPI_FLASH_PAGE_SIZE - Offset) ? Length : SPI_FLASH_PAGE_SIZE - Offset;
+		SPI_Flash_Cache_Page * Entry = SPI_Flash_Lookup(Address / SPI_FLASH_PAGE_SIZE);
+		memcpy(Buffer, &Entry->Data[Offset], Chunk);
+		Address += Chunk;
+		Buffer += Chunk;
+		Length -= Chunk;
+	}
+	xSemaphoreGive(SPI_Flash_Lock);
+}
+
+/**
+ * @brief 写入数据实现
+ * @param Address 起始地址
+ * @param Data 数据
+ * @param Length 长度
+ */
+void SPI_Flash_Program(uint32_t Address, const uint8_t * Data, uint32_t Length)
+{
+	if (Length == 0)
+	{
+		return;
+	}
+	configASSERT(Address + Length <= SPI_Flash_Chip.Size);
+	SPI_Flash_Enter();
+	SPI_Flash_Drop(Address, Length);
+	while (Length != 0)
+	{
+		// 页编程在页内回绕，跨页的数据必须拆开
+		uint32_t Chunk = SPI_FLASH_PAGE_SIZE - Address % SPI_FLASH_PAGE_SIZE;
+		if (Chunk > Length)
+		{
+			Chunk = Length;
+		}
+		SPI_Flash_Write_Enable();
+		SPI_Flash_Command(SPI_FLASH_PAGE_PROGRAM, Address, SPI_TXN_KEEP_CS);
+		SPI_Flash_Queue(Data, NULL, NULL, Chunk, SPI_TXN_NOTIFY);
+		SPI_Wait_Complete(portMAX_DELAY);
+		SPI_Flash_Wait_Ready(portMAX_DELAY, 0);
+		Address += Chunk;
+		Data += Chunk;
+		Length -= Chunk;
+	}
+	xSemaphoreGive(SPI_Flash_Lock);
+}
+
+/**
+ * @brief 擦除扇区实现
+ * @param Address 扇区内任意地址
+ */
+void SPI_Flash_Erase_Sector(uint32_t Address)
+{
+	SPI_Flash_Erase(SPI_FLASH_SECTOR_ERASE, Address, SPI_FLASH_SECTOR_SIZE);
+}
+
+/**
+ * @brief 擦除块实现
+ * @param Address 块内任意地址
+ */
+void SPI_Flash_Erase_Block(uint32_t Address)
+{
+	SPI_Flash_Erase(SPI_FLASH_BLOCK_ERASE, Address, SPI_FLASH_BLOCK_SIZE);
+}
+
+/**
+ * @brief 查询是否忙实现
+ * @return 忙返回1
+ */
+uint8_t SPI_Flash_Busy(void)
+{
+	xSemaphoreTake(SPI_Flash_Lock, portMAX_DELAY);
+	if (SPI_Flash_Pending)
+	{
+		SPI_Flash_Read_Register(SPI_FLASH_READ_STATUS, 1);
+		SPI_Flash_Pending = SPI_Flash_Reply[0] & SPI_FLASH_STATUS_BUSY;
+	}
+	uint8_t Busy = SPI_Flash_Pending;
+	xSemaphoreGive(SPI_Flash_Lock);
+	return Busy;
+}
+
+/**
+ * @brief 等待擦除完成实现
+ * @param Timeout 最长等待时间（tick）
+ * @return 完成返回pdTRUE，超时返回pdFALSE
+ */
+BaseType_t SPI_Flash_Wait(TickType_t Timeout)
+{
+	BaseType_t Done = pdTRUE;
+	xSemaphoreTake(SPI_Flash_Lock, portMAX_DELAY);
+	if (SPI_Flash_Pending)
+	{
+		Done = SPI_Flash_Wait_Ready(Timeout, 1);
+	}
+	xSemaphoreGive(SPI_Flash_Lock);
+	return Done;
+}
+
+/**
+ * @brief 读取统计信息实现
+ * @param Statistics 输出统计信息
+ * @param Clear 非0时读取后清零
+ */
+void SPI_Flash_GetStatistics(SPI_Flash_Statistics * const Statistics, const uint8_t Clear)
+{
+	xSemaphoreTake(SPI_Flash_Lock, portMAX_DELAY);
+	*Statistics = SPI_Flash_Stats;
+	if (Clear)
+	{
+		memset(&SPI_Flash_Stats, 0, sizeof(SPI_Flash_Stats));
+	}
+	xSemaphoreGive(SPI_Flash_Lock);
+}
+
+/**
+ * @brief 作废全部缓存页实现
+ */
+void SPI_Flash_Invalidate(void)
+{
+	xSemaphoreTake(SPI_Flash_Lock, portMAX_DELAY);
+	for (uint32_t i = 0; i < SPI_FLASH_CACHE_PAGES; i++)
+	{
+		SPI_Flash_Cache[i].Page = SPI_FLASH_CACHE_EMPTY;
+	}
+	xSemaphoreGive(SPI_Flash_Lock);
+}
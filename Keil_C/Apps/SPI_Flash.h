@@ -0,0 +1,154 @@
+/**
+ * @file SPI_Flash.h
+ * @brief SPI NOR Flash驱动头文件
+ * @note 挂在SPI0的传输队列上，与ST7789等设备按各自的片选共用总线：
+ *       读取使用快速读（0x0B）全双工DMA突发，需先调用SPI_ChunkBuffer_AttachRx；
+ *       擦除只发出命令即返回，忙状态在之后的操作或SPI_Flash_Wait中轮询；
+ *       常用的页缓存在RAM中（LRU替换），反复读取的字库、图片不必每次访问总线。
+ *       只支持3字节地址（容量不超过16MB）
+ */
+
+#ifndef SPI_FLASH_H
+#define SPI_FLASH_H
+
+#include "SC_Init.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "SPI_Dynamic_Buffer.h"
+
+/**
+ * 片选引脚（推挽输出），需按实际接线修改，SCK/MOSI/MISO由SC_SPI0_Init配置
+ */
+#ifndef SPI_FLASH_CS_PORT
+#define SPI_FLASH_CS_PORT      GPIOB
+#define SPI_FLASH_CS_PIN       GPIO_Pin_5
+#endif
+
+/**
+ * 页缓存的页数（每页SPI_FLASH_PAGE_SIZE字节）
+ */
+#ifndef SPI_FLASH_CACHE_PAGES
+#define SPI_FLASH_CACHE_PAGES  4
+#endif
+
+#define SPI_FLASH_PAGE_SIZE    256u            // 页编程与缓存的单位
+#define SPI_FLASH_SECTOR_SIZE  4096u           // 扇区擦除的单位
+#define SPI_FLASH_BLOCK_SIZE   65536u          // 块擦除的单位
+
+#define SPI_FLASH_WRITE_ENABLE 0x06
+#define SPI_FLASH_READ_STATUS  0x05
+#define SPI_FLASH_PAGE_PROGRAM 0x02
+#define SPI_FLASH_FAST_READ    0x0B
+#define SPI_FLASH_SECTOR_ERASE 0x20
+#define SPI_FLASH_BLOCK_ERASE  0xD8
+#define SPI_FLASH_JEDEC_ID     0x9F
+
+#define SPI_FLASH_STATUS_BUSY  0x01            // 状态寄存器WIP位
+
+/**
+ * @struct SPI_Flash_Info
+ * @brief JEDEC ID及由其得到的容量
+ */
+typedef struct
+{
+    uint8_t              Manufacturer;		   // 厂商ID
+    uint8_t              Memory_Type;		   // 存储器类型
+    uint8_t              Capacity;			   // 容量代码（容量为2的Capacity次方字节）
+    uint32_t             Size;				   // 容量（字节）
+} SPI_Flash_Info;
+
+/**
+ * @struct SPI_Flash_Statistics
+ * @brief 读取统计
+ */
+typedef struct
+{
+    uint32_t             Cache_Hits;		   // 经缓存读取时命中的页数
+    uint32_t             Cache_Misses;		   // 经缓存读取时未命中、从Flash装入的页数
+    uint32_t             Bus_Reads;			   // 发出的快速读命令次数
+} SPI_Flash_Statistics;
+
+/**
+ * @brief 初始化Flash
+ * @param SPI SPI0的传输管理（需已调用SPI_ChunkBuffer_Init与SPI_ChunkBuffer_AttachRx）
+ * @return 读到有效的JEDEC ID返回1，否则返回0
+ * @note 配置片选引脚并读取JEDEC ID，必须在任务中调用；会通过SPI_ChunkBuffer_SetMode把SPI0切换为模式3，
+ *       总线上的其他设备需支持模式3
+ */
+uint8_t SPI_Flash_Initialize(SPI_Chunk_Buffer * const SPI);
+
+/**
+ * @brief 读取Initialize得到的JEDEC ID与容量
+ */
+const SPI_Flash_Info * SPI_Flash_GetInfo(void);
+
+/**
+ * @brief 直接从Flash读取（不经过缓存）
+ * @param Address 起始地址
+ * @param Buffer 输出缓冲区
+ * @param Length 长度
+ * @note 一条快速读命令后由DMA连续接收全部数据，返回时数据已就绪；
+ *       适合一次性读取的大块数据（如图片流），不会挤掉缓存中的常用页
+ */
+void SPI_Flash_Read(uint32_t Address, uint8_t * Buffer, uint32_t Length);
+
+/**
+ * @brief 经页缓存读取
+ * @param Address 起始地址
+ * @param Buffer 输出缓冲区
+ * @param Length 长度
+ * @note 按页查找缓存，未命中的页整页读入并替换最久未使用的页，适合反复访问的小块数据
+ */
+void SPI_Flash_Read_Cached(uint32_t Address, uint8_t * Buffer, uint32_t Length);
+
+/**
+ * @brief 写入数据（页编程）
+ * @param Address 起始地址
+ * @param Data 数据
+ * @param Length 长度
+ * @note 按页边界拆分，每页编程后等待完成；只能把1写成0，写入前需擦除；
+ *       涉及的缓存页被作废
+ */
+void SPI_Flash_Program(uint32_t Address, const uint8_t * Data, uint32_t Length);
+
+/**
+ * @brief 擦除Address所在的扇区（4KB）
+ * @note 发出命令后立即返回，不等待擦除完成；之后的读写操作会先等待擦除结束
+ */
+void SPI_Flash_Erase_Sector(uint32_t Address);
+
+/**
+ * @brief 擦除Address所在的块（64KB）
+ * @note 同SPI_Flash_Erase_Sector
+ */
+void SPI_Flash_Erase_Block(uint32_t Address);
+
+/**
+ * @brief 查询擦除或编程是否仍在进行
+ * @return 忙返回1
+ */
+uint8_t SPI_Flash_Busy(void);
+
+/**
+ * @brief 等待擦除或编程完成
+ * @param Timeout 最长等待时间（tick）
+ * @return 完成返回pdTRUE，超时返回pdFALSE
+ * @note 每个tick读一次状态寄存器，等待期间不占用总线与CPU
+ */
+BaseType_t SPI_Flash_Wait(TickType_t Timeout);
+
+/**
+ * @brief 读取统计信息
+ * @param Statistics 输出统计信息
+ * @param Clear 非0时读取后清零
+ */
+void SPI_Flash_GetStatistics(SPI_Flash_Statistics * const Statistics, const uint8_t Clear);
+
+/**
+ * @brief 作废全部缓存页
+ * @note 其他途径修改了Flash内容时调用
+ */
+void SPI_Flash_Invalidate(void);
+
+#endif // SPI_FLASH_H
@@ -0,0 +1,325 @@
+#include "ST7789.h"
+#include <string.h>
+
+/**
+ * @struct ST7789_Init_Step
+ * @brief 初始化序列中的一条命令
+ */
+typedef struct
+{
+    uint8_t              Command;			   // 命令
+    uint8_t              Length;			   // 参数长度
+    uint8_t              Delay_Ms;			   // 命令发送后的等待时间
+    uint8_t              Parameter[4];		   // 参数
+} ST7789_Init_Step;
+
+/**
+ * @brief 初始化序列
+ * @note SLPOUT之后至少等待5ms才能发送下一条命令（退出睡眠后120ms内不能再次进入睡眠）
+ */
+static const ST7789_Init_Step ST7789_Init_Sequence[] = {
+	{ ST7789_SWRESET,    0, 150, { 0 } },
+	{ ST7789_SLPOUT,     0, 120, { 0 } },
+	{ ST7789_COLMOD,     1, 10,  { 0x55 } },		  // 16位RGB565
+	{ ST7789_MADCTL_CMD, 1, 0,   { ST7789_MADCTL } },
+	{ ST7789_INVON,      0, 10,  { 0 } },			  // IPS模块需反色显示
+	{ ST7789_NORON,      0, 10,  { 0 } },
+	{ ST7789_DISPON,     0, 10,  { 0 } },
+};
+
+static SPI_Chunk_Buffer * ST7789_SPI;				  // SPI0的传输管理，NULL时屏幕接在8080并口上
+static uint8_t ST7789_Pending;						  // 已提交、完成通知尚未取走的像素写入次数
+
+/**
+ * @brief 把一次传输加入SPI0队列（内部函数）
+ * @param DC D/C电平（0命令，1数据）
+ * @param Data 数据，NULL时发送Immediate中的字节
+ * @param Length 数据长度
+ * @param Immediate 不超过4字节的短数据（随描述符复制，调用者无需保留）
+ * @param Flags 附加的传输标志（SPI_TXN_NOTIFY、SPI_TXN_WIDE、SPI_TXN_FILL）
+ * @note SPI_TXN_FILL时Immediate为本机字节序的2字节颜色，Length为总字节数
+ * @note 片选在传输之间保持有效，直到ST7789_Release
+ * @note 8080并口时按同样的标志直接写出，返回时已全部送出
+ */
+static void ST7789_Queue(uint8_t DC, const uint8_t * Data, uint32_t Length, const uint8_t * Immediate, uint8_t Flags)
+{
+	if (ST7789_SPI == NULL)
+	{
+		if (Flags & SPI_TXN_FILL)
+		{
+			uint16_t Color;
+			memcpy(&Color, Immediate, 2);
+			Parallel_8080_Fill(Color, Length / 2);
+		}
+		else if (Flags & SPI_TXN_WIDE)
+		{
+			Parallel_8080_Write_Pixels((const uint16_t *)Data, Length / 2);
+		}
+		else
+		{
+			Parallel_8080_Write(DC, (Data != NULL) ? Data : Immediate, Length);
+		}
+		return;
+	}
+	SPI_Transaction Transaction = { 0 };
+	Transaction.cs_port = ST7789_CS_PORT;
+	Transaction.cs_pin = ST7789_CS_PIN;
+	Transaction.dc_port = ST7789_DC_PORT;
+	Transaction.dc_pin = ST7789_DC_PIN;
+	Transaction.dc = DC;
+	Transaction.flags = SPI_TXN_KEEP_CS | Flags;
+	Transaction.bytes = Data;
+	Transaction.len = Length;
+	if (Immediate != NULL)
+	{
+		memcpy(Transaction.immediate, Immediate, (Flags & SPI_TXN_FILL) ? 2 : Length);
+	}
+	SPI_Submit(ST7789_SPI, &Transaction, portMAX_DELAY);
+}
+
+/**
+ * @brief 配置控制引脚为推挽输出（内部函数）
+ */
+static void ST7789_GPIO_Init(GPIO_TypeDef * const Port, const uint16_t Pin)
+{
+	GPIO_InitTypeDef GPIO_InitStruct;
+	GPIO_InitStruct.GPIO_Pin = Pin;
+	GPIO_InitStruct.GPIO_Mode = GPIO_Mode_OUT_PP;
+	GPIO_InitStruct.GPIO_DriveLevel = 0;
+	GPIO_Init(Port, &GPIO_InitStruct);
+	GPIO_SetBits(Port, Pin);
+}
+
+/**
+ * @brief 初始化屏幕实现
+ * @param SPI SPI0的传输管理，NULL表示8080并口
+ */
+void ST7789_Initialize(SPI_Chunk_Buffer * const SPI)
+{
+	if (SPI != NULL && SPI->using_s == NULL)
+	{
+		while(1); // 需先调用SPI_ChunkBuffer_Init
+	}
+	ST7789_SPI = SPI;
+	if (SPI == NULL)
+	{
+		Parallel_8080_Initialize();
+	}
+	else
+	{
+		ST7789_GPIO_Init(ST7789_DC_PORT, ST7789_DC_PIN);
+		ST7789_GPIO_Init(ST7789_CS_PORT, ST7789_CS_PIN);
+		SPI_ChunkBuffer_SetMode(SPI, 3); // ST7789在SCL上升沿采样，SC_SPI0_Init的模式2会在同一边沿改变MOSI
+	}
+	// 硬件复位：低电平至少10us，释放后等待120ms
+#ifndef ST7789_NO_RST
+	ST7789_GPIO_Init(ST7789_RST_PORT, ST7789_RST_PIN);
+	GPIO_ResetBits(ST7789_RST_PORT, ST7789_RST_PIN);
+	vTaskDelay(pdMS_TO_TICKS(10));
+	GPIO_SetBits(ST7789_RST_PORT, ST7789_RST_PIN);
+	vTaskDelay(pdMS_TO_TICKS(120));
+#endif
+	for (uint32_t i = 0; i < sizeof(ST7789_Init_Sequence) / sizeof(ST7789_Init_Sequence[0]); i++)
+	{
+		const ST7789_Init_Step * Step = &ST7789_Init_Sequence[i];
+		ST7789_Write_Command(Step->Command, Step->Parameter, Step->Length);
+		if (Step->Delay_Ms != 0)
+		{
+			ST7789_Release();
+			vTaskDelay(pdMS_TO_TICKS(Step->Delay_Ms));
+		}
+	}
+	ST7789_Release();
+}
+
+/**
+ * @brief 发送命令实现
+ * @param Command 命令
+ * @param Parameter 参数
+ * @param Length 参数长度
+ */
+void ST7789_Write_Command(uint8_t Command, const uint8_t * Parameter, uint8_t Length)
+{
+	if (Length > 4)
+	{
+		Length = 4;
+	}
+	// 命令与参数按顺序排队，D/C由队列在前一次传输全部移出后切换
+	ST7789_Queue(0, NULL, 1, &Command, 0);
+	if (Length != 0)
+	{
+		ST7789_Queue(1, NULL, Length, Parameter, 0);
+	}
+}
+
+/**
+ * @brief 设置显存写入窗口实现
+ * @param X0 起始列
+ * @param Y0 起始行
+ * @param X1 结束列
+ * @param Y1 结束行
+ */
+void ST7789_SetWindow(uint16_t X0, uint16_t Y0, uint16_t X1, uint16_t Y1)
+{
+	uint8_t Parameter[4];
+	X0 += ST7789_X_OFFSET;
+	X1 += ST7789_X_OFFSET;
+	Y0 += ST7789_Y_OFFSET;
+	Y1 += ST7789_Y_OFFSET;
+	Parameter[0] = (uint8_t)(X0 >> 8);
+	Parameter[1] = (uint8_t)X0;
+	Parameter[2] = (uint8_t)(X1 >> 8);
+	Parameter[3] = (uint8_t)X1;
+	ST7789_Write_Command(ST7789_CASET, Parameter, 4);
+	Parameter[0] = (uint8_t)(Y0 >> 8);
+	Parameter[1] = (uint8_t)Y0;
+	Parameter[2] = (uint8_t)(Y1 >> 8);
+	Parameter[3] = (uint8_t)Y1;
+	ST7789_Write_Command(ST7789_RASET, Parameter, 4);
+	ST7789_Write_Command(ST7789_RAMWR, NULL, 0);
+}
+
+/**
+ * @brief 填充矩形实现
+ * @param X 左上角列
+ * @param Y 左上角行
+ * @param Width 宽度
+ * @param Height 高度
+ * @param Color RGB565颜色
+ */
+void ST7789_FillRect(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height, uint16_t Color)
+{
+	// 裁剪到屏幕范围内
+	if (X >= ST7789_WIDTH || Y >= ST7789_HEIGHT || Width == 0 || Height == 0)
+	{
+		return;
+	}
+	if (Width > ST7789_WIDTH - X)
+	{
+		Width = ST7789_WIDTH - X;
+	}
+	if (Height > ST7789_HEIGHT - Y)
+	{
+		Height = ST7789_HEIGHT - Y;
+	}
+	ST7789_SetWindow(X, Y, X + Width - 1, Y + Height - 1);
+	// DMA1以固定源地址反复读取描述符中的颜色，SPI0切换为16位帧，不占用行缓冲区
+	ST7789_Queue(1, NULL, (uint32_t)Width * Height * 2, (const uint8_t *)&Color, SPI_TXN_FILL);
+}
+
+/**
+ * @brief 填充整个屏幕实现
+ * @param Color RGB565颜色
+ */
+void ST7789_FillScreen(uint16_t Color)
+{
+	ST7789_FillRect(0, 0, ST7789_WIDTH, ST7789_HEIGHT, Color);
+}
+
+/**
+ * @brief 写入像素实现
+ * @param X 左上角列
+ * @param Y 左上角行
+ * @param Width 宽度
+ * @param Height 高度
+ * @param Pixels 像素数据
+ */
+void ST7789_Blit(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height, const uint16_t * Pixels)
+{
+	if (Width == 0 || Height == 0)
+	{
+		return;
+	}
+	ST7789_SetWindow(X, Y, X + Width - 1, Y + Height - 1);
+	// 整块像素作为一次16位帧传输，由DMA1中断逐段续传
+	ST7789_Queue(1, (const uint8_t *)Pixels, (uint32_t)Width * Height * 2, NULL, SPI_TXN_WIDE);
+}
+
+/**
+ * @brief 继续写入显存实现
+ * @param Pixels 像素数据
+ * @param Count 像素个数
+ * @param Notify 非0时传输结束后通知调用任务
+ */
+void ST7789_Write_Pixels(const uint16_t * Pixels, uint32_t Count, uint8_t Notify)
+{
+	ST7789_Queue(1, (const uint8_t *)Pixels, Count * 2, NULL, SPI_TXN_WIDE | (Notify ? SPI_TXN_NOTIFY : 0));
+	// 并口写入是同步的，返回时已经读完，不需要通知
+	if (Notify && ST7789_SPI != NULL)
+	{
+		ST7789_Pending++;
+	}
+}
+
+/**
+ * @brief 等待像素写入完成实现
+ * @param Keep 允许仍在发送的次数
+ */
+void ST7789_Wait_Pixels(uint8_t Keep)
+{
+	while (ST7789_Pending > Keep)
+	{
+		SPI_Wait_Complete(portMAX_DELAY);
+		ST7789_Pending--;
+	}
+}
+
+/**
+ * @brief 定义垂直滚动区域实现
+ * @param Top 滚动区域的第一行
+ * @param Height 滚动区域的行数
+ */
+void ST7789_Scroll_Area(uint16_t Top, uint16_t Height)
+{
+	// 参数为顶部固定区、滚动区、底部固定区的行数，三者之和必须等于显存行数
+	uint16_t Fixed_Top = Top + ST7789_Y_OFFSET;
+	uint16_t Fixed_Bottom = ST7789_MEMORY_HEIGHT - Fixed_Top - Height;
+	uint8_t Parameter[6];
+	Parameter[0] = (uint8_t)(Fixed_Top >> 8);
+	Parameter[1] = (uint8_t)Fixed_Top;
+	Parameter[2] = (uint8_t)(Height >> 8);
+	Parameter[3] = (uint8_t)Height;
+	Parameter[4] = (uint8_t)(Fixed_Bottom >> 8);
+	Parameter[5] = (uint8_t)Fixed_Bottom;
+	// 描述符中的短数据最多4字节，6字节参数分两次排队，D/C保持为数据
+	ST7789_Write_Command(ST7789_VSCRDEF, Parameter, 4);
+	ST7789_Queue(1, NULL, 2, &Parameter[4], 0);
+}
+
+/**
+ * @brief 设置滚动起始行实现
+ * @param Line 显示在滚动区域最上方的行
+ */
+void ST7789_Scroll(uint16_t Line)
+{
+	uint8_t Parameter[2];
+	Line += ST7789_Y_OFFSET;
+	Parameter[0] = (uint8_t)(Line >> 8);
+	Parameter[1] = (uint8_t)Line;
+	ST7789_Write_Command(ST7789_VSCRSADD, Parameter, 2);
+}
+
+/**
+ * @brief 释放片选实现
+ */
+void ST7789_Release(void)
+{
+	// 同时取走未取的完成通知，之后换由其他任务使用屏幕时计数从0开始
+	ST7789_Wait_Pixels(0);
+	if (ST7789_SPI == NULL)
+	{
+		Parallel_8080_Release();
+	}
+	else
+	{
+		SPI_Release(ST7789_SPI);
+	}
+}
+
+/**
+ * @brief 查询总线实现
+ */
+uint8_t ST7789_Parallel(void)
+{
+	return ST7789_SPI == NULL;
+}
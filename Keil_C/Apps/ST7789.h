@@ -0,0 +1,179 @@
+#ifndef ST7789_H
+#define ST7789_H
+
+#include "SC_Init.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "SPI_Dynamic_Buffer.h"
+#include "Parallel_8080.h"
+
+/**
+ * 屏幕分辨率与显存偏移（240x240模块的显存为240x320，默认方向下偏移为0）
+ */
+#ifndef ST7789_WIDTH
+#define ST7789_WIDTH       240
+#endif
+#ifndef ST7789_HEIGHT
+#define ST7789_HEIGHT      240
+#endif
+#ifndef ST7789_X_OFFSET
+#define ST7789_X_OFFSET    0
+#endif
+#ifndef ST7789_Y_OFFSET
+#define ST7789_Y_OFFSET    0
+#endif
+#define ST7789_MEMORY_HEIGHT 320               // 显存行数，垂直滚动区域按显存行定义
+
+/**
+ * MADCTL寄存器值（扫描方向与RGB/BGR顺序），旋转屏幕时同时修改分辨率与偏移
+ */
+#ifndef ST7789_MADCTL
+#define ST7789_MADCTL      0x00
+#endif
+
+/**
+ * SPI接口的控制引脚（推挽输出），需按实际接线修改，8080并口的引脚见Parallel_8080.h；
+ * SCK/MOSI由SC_SPI0_Init配置，RST可接到MCU复位脚，此时定义ST7789_NO_RST
+ */
+#ifndef ST7789_DC_PORT
+#define ST7789_DC_PORT     GPIOB
+#define ST7789_DC_PIN      GPIO_Pin_2
+#endif
+#ifndef ST7789_CS_PORT
+#define ST7789_CS_PORT     GPIOB
+#define ST7789_CS_PIN      GPIO_Pin_3
+#endif
+#if !defined(ST7789_RST_PORT) && !defined(ST7789_NO_RST)
+#define ST7789_RST_PORT    GPIOB
+#define ST7789_RST_PIN     GPIO_Pin_4
+#endif
+
+/**
+ * 由8位RGB分量合成RGB565颜色
+ */
+#define ST7789_RGB565(R, G, B) ((uint16_t)((((R) & 0xF8) << 8) | (((G) & 0xFC) << 3) | ((B) >> 3)))
+
+/**
+ * 常用命令
+ */
+#define ST7789_SWRESET     0x01
+#define ST7789_SLPOUT      0x11
+#define ST7789_NORON       0x13
+#define ST7789_INVON       0x21
+#define ST7789_DISPON      0x29
+#define ST7789_CASET       0x2A
+#define ST7789_RASET       0x2B
+#define ST7789_RAMWR       0x2C
+#define ST7789_VSCRDEF     0x33
+#define ST7789_MADCTL_CMD  0x36
+#define ST7789_VSCRSADD    0x37
+#define ST7789_COLMOD      0x3A
+#define ST7789_RAMWRC      0x3C
+
+/**
+ * @brief 初始化屏幕
+ * @param SPI SPI0的传输管理（需已调用SPI_ChunkBuffer_Init，DMA1按SC_DMA1_Init配置），
+ *            NULL表示屏幕接在8080并口上
+ * @note 两种总线之后的接口完全相同：SPI0上的写入排队后立即返回，由DMA发送；
+ *       并口上的写入由CPU同步完成，ST7789_Wait_Pixels不需要等待。
+ *       配置控制引脚并把SPI0切换为模式3，硬件复位后发送初始化序列（RGB565、反色显示、开显示），
+ *       序列中的延时使用vTaskDelay，必须在任务中调用，耗时约300ms
+ */
+void ST7789_Initialize(SPI_Chunk_Buffer * const SPI);
+
+/**
+ * @brief 发送命令及其参数
+ * @param Command 命令
+ * @param Parameter 参数，无参数时可为NULL
+ * @param Length 参数长度（不超过4字节）
+ * @note 命令与参数随描述符复制进SPI0队列后立即返回，D/C由队列在前一次传输移出后切换
+ */
+void ST7789_Write_Command(uint8_t Command, const uint8_t * Parameter, uint8_t Length);
+
+/**
+ * @brief 设置显存写入窗口并开始写显存（CASET/RASET/RAMWR）
+ * @param X0 起始列
+ * @param Y0 起始行
+ * @param X1 结束列（包含）
+ * @param Y1 结束行（包含）
+ * @note 之后通过DMA发送的数据按行依次写入窗口
+ */
+void ST7789_SetWindow(uint16_t X0, uint16_t Y0, uint16_t X1, uint16_t Y1);
+
+/**
+ * @brief 用单一颜色填充矩形
+ * @param X 左上角列
+ * @param Y 左上角行
+ * @param Width 宽度
+ * @param Height 高度
+ * @param Color RGB565颜色
+ * @note 超出屏幕的部分被裁剪；排入队列后即返回，不等待传输结束；
+ *       颜色随描述符保存，DMA1以固定源地址发送，不需要像素缓冲区
+ */
+void ST7789_FillRect(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height, uint16_t Color);
+
+/**
+ * @brief 用单一颜色填充整个屏幕
+ * @param Color RGB565颜色
+ */
+void ST7789_FillScreen(uint16_t Color);
+
+/**
+ * @brief 把像素数据写入矩形区域
+ * @param X 左上角列
+ * @param Y 左上角行
+ * @param Width 宽度
+ * @param Height 高度
+ * @param Pixels 按行排列的RGB565像素（本机字节序）
+ * @note 像素由DMA按半字直接从Pixels读取、以16位帧高字节在前发出，不做拷贝、
+ *       字节交换或裁剪（矩形必须位于屏幕内），Pixels在ST7789_Release返回前必须保持有效
+ */
+void ST7789_Blit(uint16_t X, uint16_t Y, uint16_t Width, uint16_t Height, const uint16_t * Pixels);
+
+/**
+ * @brief 在ST7789_SetWindow设置的窗口中继续写入像素
+ * @param Pixels RGB565像素（本机字节序）
+ * @param Count 像素个数
+ * @param Notify 非0时该段数据被DMA读完后给调用任务一次通知，由ST7789_Wait_Pixels取走
+ * @note 排入队列后立即返回，Pixels在ST7789_Wait_Pixels确认读完或ST7789_Release返回前
+ *       必须保持有效，用于边绘制边发送的双缓冲渲染
+ */
+void ST7789_Write_Pixels(const uint16_t * Pixels, uint32_t Count, uint8_t Notify);
+
+/**
+ * @brief 等待带通知的像素写入完成，直到未完成的不超过Keep次
+ * @param Keep 允许仍在发送的次数（双缓冲复用缓冲区前为1）
+ * @note 完成通知按提交顺序到达，未完成的总是最近提交的几次；计数在本模块中统一保存，
+ *       渲染器与文字绘制在同一个任务中交替使用时不会取走对方的通知
+ */
+void ST7789_Wait_Pixels(uint8_t Keep);
+
+/**
+ * @brief 定义垂直滚动区域（VSCRDEF）
+ * @param Top 滚动区域的第一行（屏幕坐标）
+ * @param Height 滚动区域的行数
+ * @note 滚动区域以上与以下的显存行固定显示；默认方向（MADCTL的ML位为0）下有效
+ */
+void ST7789_Scroll_Area(uint16_t Top, uint16_t Height);
+
+/**
+ * @brief 设置滚动区域显示的起始行（VSCRSADD）
+ * @param Line 显示在滚动区域最上方的行（屏幕坐标，位于滚动区域内）
+ * @note 滚动区域内的显存按环形显示，只改变显示的起点，不重写显存；
+ *       CASET/RASET仍按显存行寻址，不受滚动影响
+ */
+void ST7789_Scroll(uint16_t Line);
+
+/**
+ * @brief 查询屏幕是否接在8080并口上
+ * @return 并口返回1，SPI0返回0
+ */
+uint8_t ST7789_Parallel(void);
+
+/**
+ * @brief 等待传输全部结束并释放片选
+ * @note 需要复用像素缓冲区前调用，SPI0上的其他设备由队列按各自的片选切换
+ */
+void ST7789_Release(void);
+
+#endif // ST7789_H
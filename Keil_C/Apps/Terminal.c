@@ -1,109 +1,517 @@
 #include "Terminal.h"
-#include "DMA-Buffer-Manager.h"
 
-#define BUFFER_SIZE 256
+static DMA_Buffer_Manager *terminal_manager = NULL; // 终端输出使用的DMA缓冲区管理器
+static Terminal_Mirror terminal_mirror = NULL;      // 文本记录的镜像回调
 
 /**
- * 格式化字符串缓冲区，支持%s和%u格式化
- * @param buf 目标缓冲区
- * @param size 缓冲区大小
- * @param format 格式字符串
- * @param ... 可变参数列表
- * @return 实际需要写入的字符数（不包括终止符）
+ * 两位十进制数字查找表，"00"~"99"
+ * Cortex-M0+没有硬件除法器，数字转换每次取两位，避免逐位调用软件除法
  */
-int Terminal_Output(const char *format, ...) {
-    va_list ap;
-    va_start(ap, format);
+static const char terminal_digit_pairs[200] = {
+    '0','0','0','1','0','2','0','3','0','4','0','5','0','6','0','7','0','8','0','9',
+    '1','0','1','1','1','2','1','3','1','4','1','5','1','6','1','7','1','8','1','9',
+    '2','0','2','1','2','2','2','3','2','4','2','5','2','6','2','7','2','8','2','9',
+    '3','0','3','1','3','2','3','3','3','4','3','5','3','6','3','7','3','8','3','9',
+    '4','0','4','1','4','2','4','3','4','4','4','5','4','6','4','7','4','8','4','9',
+    '5','0','5','1','5','2','5','3','5','4','5','5','5','6','5','7','5','8','5','9',
+    '6','0','6','1','6','2','6','3','6','4','6','5','6','6','6','7','6','8','6','9',
+    '7','0','7','1','7','2','7','3','7','4','7','5','7','6','7','7','7','8','7','9',
+    '8','0','8','1','8','2','8','3','8','4','8','5','8','6','8','7','8','8','8','9',
+    '9','0','9','1','9','2','9','3','9','4','9','5','9','6','9','7','9','8','9','9',
+};
+
+static const char terminal_hex_lower[16] = "0123456789abcdef";
+static const char terminal_hex_upper[16] = "0123456789ABCDEF";
+
+/**
+ * 格式化输出目标
+ * limit为0时只统计长度，不写入任何数据
+ */
+typedef struct {
+    DMA_Buffer_Span *span;  // 预留得到的环形缓冲区可写区域
+    int count;              // 已输出的字符数（包括超出可写区域被丢弃的部分）
+    int limit;              // 可写入的字符总数
+} Terminal_Sink;
+
+/**
+ * 格式说明符，%[-0][width][.precision][l]conversion
+ */
+typedef struct {
+    uint8_t left;           // '-'：左对齐
+    uint8_t zero;           // '0'：用0填充宽度
+    int width;              // 最小宽度
+    int precision;          // 精度，-1表示未指定
+} Terminal_Spec;
+
+/**
+ * 向输出目标写入一个字符，超出可写区域的字符只计数不写入
+ * @param sink 输出目标
+ * @param c 字符
+ */
+static void Terminal_Put(Terminal_Sink *sink, char c) {
+    if (sink->count < sink->limit) {
+        int i = sink->count;
+        // 第一段写满后转入环绕后的第二段
+        if (i < sink->span->Length[0]) {
+            sink->span->Pointer[0][i] = (uint8_t)c;
+        } else {
+            sink->span->Pointer[1][i - sink->span->Length[0]] = (uint8_t)c;
+        }
+    }
+    sink->count++;
+}
+
+/**
+ * 重复输出同一字符
+ * @param sink 输出目标
+ * @param c 字符
+ * @param n 次数，小于等于0时不输出
+ */
+static void Terminal_Fill(Terminal_Sink *sink, char c, int n) {
+    while (n-- > 0) {
+        Terminal_Put(sink, c);
+    }
+}
+
+/**
+ * 把0~9999转换为4位数字（含前导0）
+ * (x * 5243) >> 19 对 x < 43699 精确等于 x / 100，只需一次32位乘法
+ * @param x 0~9999
+ * @param out 输出4个字符
+ */
+static void Terminal_Four_Digits(uint32_t x, char *out) {
+    uint32_t hi = (x * 5243u) >> 19;
+    uint32_t lo = x - hi * 100u;
+    out[0] = terminal_digit_pairs[hi * 2];
+    out[1] = terminal_digit_pairs[hi * 2 + 1];
+    out[2] = terminal_digit_pairs[lo * 2];
+    out[3] = terminal_digit_pairs[lo * 2 + 1];
+}
+
+/**
+ * 无除法的十进制转换
+ * 先用按权减法把数值拆成 hi*10^8 + mid*10^4 + lo，再按两位查表输出
+ * @param value 数值
+ * @param out 输出缓冲区，至少10字节，不添加终止符
+ * @return 数字个数（value为0时为1）
+ */
+static int Terminal_Decimal(uint32_t value, char *out) {
+    char temp[12];
+    uint32_t hi = 0, mid = 0;
+    uint32_t k;
+
+    // hi = value / 10^8，取值0~42
+    for (k = 32; k != 0; k >>= 1) {
+        if (value >= k * 100000000u) {
+            value -= k * 100000000u;
+            hi += k;
+        }
+    }
+    // mid = value / 10^4，取值0~9999
+    for (k = 8192; k != 0; k >>= 1) {
+        if (value >= k * 10000u) {
+            value -= k * 10000u;
+            mid += k;
+        }
+    }
+    Terminal_Four_Digits(hi, &temp[0]);
+    Terminal_Four_Digits(mid, &temp[4]);
+    Terminal_Four_Digits(value, &temp[8]);
+
+    // 去掉前导0，至少保留一位
+    int start = 0;
+    while (start < 11 && temp[start] == '0') {
+        start++;
+    }
+    int len = 12 - start;
+    for (int i = 0; i < len; i++) {
+        out[i] = temp[start + i];
+    }
+    return len;
+}
+
+/**
+ * 十六进制转换
+ * @param value 数值
+ * @param out 输出缓冲区，至少8字节，不添加终止符
+ * @param digits 数字字符表
+ * @return 数字个数（value为0时为1）
+ */
+static int Terminal_Hex(uint32_t value, char *out, const char *digits) {
+    int len = 8;
+    while (len > 1 && (value >> ((len - 1) * 4)) == 0) {
+        len--;
+    }
+    for (int i = 0; i < len; i++) {
+        out[i] = digits[(value >> ((len - 1 - i) * 4)) & 0xF];
+    }
+    return len;
+}
 
-    int index = 0;          // 当前写入位置
-    int total_length = 0;   // 总字符数
+/**
+ * 按宽度、精度和填充方式输出已转换的数字
+ * @param sink 输出目标
+ * @param spec 格式说明
+ * @param prefix 符号或前缀（"-"、"0x"等），可为空字符串
+ * @param digits 数字字符
+ * @param len 数字个数
+ */
+static void Terminal_Number(Terminal_Sink *sink, const Terminal_Spec *spec,
+                            const char *prefix, const char *digits, int len) {
+    int prefix_len = 0;
+    while (prefix[prefix_len] != '\0') prefix_len++;
 
+    // 精度为0且数值为0时不输出数字
+    if (spec->precision == 0 && len == 1 && digits[0] == '0') {
+        len = 0;
+    }
+    int zeros = (spec->precision > len) ? spec->precision - len : 0;
+    // 指定精度时忽略'0'标志
+    if (spec->zero && !spec->left && spec->precision < 0) {
+        int room = spec->width - prefix_len - len;
+        if (room > zeros) zeros = room;
+    }
+    int spaces = spec->width - prefix_len - zeros - len;
+
+    if (!spec->left) Terminal_Fill(sink, ' ', spaces);
+    for (int i = 0; i < prefix_len; i++) Terminal_Put(sink, prefix[i]);
+    Terminal_Fill(sink, '0', zeros);
+    for (int i = 0; i < len; i++) Terminal_Put(sink, digits[i]);
+    if (spec->left) Terminal_Fill(sink, ' ', spaces);
+}
+
+/**
+ * 按格式字符串输出到目标
+ * 支持%s %c %d %u %x %X %p %ld %lu %%，以及'-'、'0'标志、宽度和精度
+ * @param sink 输出目标
+ * @param format 格式字符串
+ * @param ap 可变参数列表
+ * @return 格式化后的总字符数
+ */
+static int Terminal_Format(Terminal_Sink *sink, const char *format, va_list ap) {
     // 临时缓冲区用于数字转换
-    char num_str[16];
-	char buf[BUFFER_SIZE] = "";
+    char num_str[12];
 
     // 遍历格式字符串
     for (int i = 0; format[i] != '\0'; i++) {
-        if (format[i] == '%') {
-            i++; // 移动到格式符
-            if (format[i] == '\0') break; // 格式字符串意外结束
+        if (format[i] != '%') {
+            // 普通字符直接复制
+            Terminal_Put(sink, format[i]);
+            continue;
+        }
+        int begin = i++; // 记录%位置并移动到格式说明
+
+        // 解析标志、宽度、精度和长度修饰
+        Terminal_Spec spec = { 0, 0, 0, -1 };
+        for (;; i++) {
+            if (format[i] == '-') spec.left = 1;
+            else if (format[i] == '0') spec.zero = 1;
+            else break;
+        }
+        while (format[i] >= '0' && format[i] <= '9') {
+            spec.width = spec.width * 10 + (format[i++] - '0');
+        }
+        if (format[i] == '.') {
+            i++;
+            spec.precision = 0;
+            while (format[i] >= '0' && format[i] <= '9') {
+                spec.precision = spec.precision * 10 + (format[i++] - '0');
+            }
+        }
+        if (format[i] == 'l') i++; // long与int同为32位
+        if (format[i] == '\0') break; // 格式字符串意外结束
 
-            if (format[i] == 's') {
-                // 处理字符串格式符
+        switch (format[i]) {
+            case 's': {
+                // 处理字符串格式符，精度限制最大输出长度
                 const char *s = va_arg(ap, const char *);
                 if (!s) s = "(null)"; // 处理空指针
-                
-                while (*s != '\0') {
-                    total_length++;
-                    if (index < BUFFER_SIZE - 1) {
-                        buf[index++] = *s;
-                    }
-                    s++;
-                }
-            } 
-            else if (format[i] == 'u') {
-                // 处理无符号整数格式符
-                unsigned int num = va_arg(ap, unsigned int);
-                char *p = num_str;
-                
-                // 数字转换
-                if (num == 0) {
-                    *p++ = '0';
-                } else {
-                    char temp[12];
-                    int j = 0;
-                    // 逆序生成数字字符
-                    while (num > 0) {
-                        temp[j++] = '0' + (num % 10);
-                        num /= 10;
-                    }
-                    // 反转得到正确顺序
-                    while (j > 0) {
-                        *p++ = temp[--j];
-                    }
-                }
-                *p = '\0'; // 字符串终止符
-                
-                // 复制转换后的数字到目标缓冲区
-                int k = 0;
-                while (num_str[k] != '\0') {
-                    total_length++;
-                    if (index < BUFFER_SIZE - 1) {
-                        buf[index++] = num_str[k];
-                    }
-                    k++;
-                }
-            } 
-            else {
-                // 未知格式符，原样输出%和当前字符
-                total_length += 2;
-                if (index < BUFFER_SIZE - 1) {
-                    buf[index++] = '%';
-                }
-                if (index < BUFFER_SIZE - 1) {
-                    buf[index++] = format[i];
-                }
+                int len = 0;
+                while (s[len] != '\0' && (spec.precision < 0 || len < spec.precision)) len++;
+                if (!spec.left) Terminal_Fill(sink, ' ', spec.width - len);
+                for (int k = 0; k < len; k++) Terminal_Put(sink, s[k]);
+                if (spec.left) Terminal_Fill(sink, ' ', spec.width - len);
+                break;
             }
-        } 
-        else {
-            // 普通字符直接复制
-            total_length++;
-            if (index < BUFFER_SIZE - 1) {
-                buf[index++] = format[i];
+            case 'c': {
+                if (!spec.left) Terminal_Fill(sink, ' ', spec.width - 1);
+                Terminal_Put(sink, (char)va_arg(ap, int));
+                if (spec.left) Terminal_Fill(sink, ' ', spec.width - 1);
+                break;
+            }
+            case 'd':
+            case 'i': {
+                int value = va_arg(ap, int);
+                // 取绝对值时避免INT_MIN溢出
+                uint32_t magnitude = (value < 0) ? (0u - (uint32_t)value) : (uint32_t)value;
+                int len = Terminal_Decimal(magnitude, num_str);
+                Terminal_Number(sink, &spec, (value < 0) ? "-" : "", num_str, len);
+                break;
+            }
+            case 'u': {
+                int len = Terminal_Decimal(va_arg(ap, unsigned int), num_str);
+                Terminal_Number(sink, &spec, "", num_str, len);
+                break;
+            }
+            case 'x':
+            case 'X': {
+                int len = Terminal_Hex(va_arg(ap, unsigned int), num_str,
+                                       (format[i] == 'x') ? terminal_hex_lower : terminal_hex_upper);
+                Terminal_Number(sink, &spec, "", num_str, len);
+                break;
             }
+            case 'p': {
+                // 指针固定输出8位十六进制
+                int len = Terminal_Hex((uint32_t)va_arg(ap, void *), num_str, terminal_hex_lower);
+                if (spec.precision < 8) spec.precision = 8;
+                Terminal_Number(sink, &spec, "0x", num_str, len);
+                break;
+            }
+            case '%':
+                Terminal_Put(sink, '%');
+                break;
+            default:
+                // 未知格式符，原样输出整个格式说明
+                for (int k = begin; k <= i; k++) Terminal_Put(sink, format[k]);
+                break;
         }
     }
 
-    // 确保字符串终止
-    if (index >= BUFFER_SIZE) {
-        index = BUFFER_SIZE - 1; // 截断处理
+    return sink->count;
+}
+
+#if TERMINAL_DEFERRED
+/**
+ * 按小端输出32位数值
+ * @param sink 输出目标
+ * @param value 数值
+ */
+static void Terminal_Put_Word(Terminal_Sink *sink, uint32_t value) {
+    Terminal_Put(sink, (char)value);
+    Terminal_Put(sink, (char)(value >> 8));
+    Terminal_Put(sink, (char)(value >> 16));
+    Terminal_Put(sink, (char)(value >> 24));
+}
+
+/**
+ * 按格式说明输出参数的原始值，不做任何格式化
+ * 只扫描格式说明以确定参数类型，标志、宽度和精度留给上位机处理
+ * @param sink 输出目标
+ * @param format 格式字符串
+ * @param ap 可变参数列表
+ */
+static void Terminal_Encode_Payload(Terminal_Sink *sink, const char *format, va_list ap) {
+    for (int i = 0; format[i] != '\0'; i++) {
+        if (format[i] != '%') continue;
+        i++;
+        // 跳过标志、宽度、精度和长度修饰
+        while (format[i] == '-' || format[i] == '.' || format[i] == 'l'
+               || (format[i] >= '0' && format[i] <= '9')) {
+            i++;
+        }
+        if (format[i] == '\0') break; // 格式字符串意外结束
+
+        switch (format[i]) {
+            case 's': {
+                const char *s = va_arg(ap, const char *);
+                if (!s) s = "(null)"; // 处理空指针
+                for (int k = 0; k < TERMINAL_RECORD_STRING_MAX && s[k] != '\0'; k++) {
+                    Terminal_Put(sink, s[k]);
+                }
+                Terminal_Put(sink, '\0');
+                break;
+            }
+            case 'c':
+                Terminal_Put(sink, (char)va_arg(ap, int));
+                break;
+            case 'd':
+            case 'i':
+            case 'u':
+            case 'x':
+            case 'X':
+                Terminal_Put_Word(sink, va_arg(ap, uint32_t));
+                break;
+            case 'p':
+                Terminal_Put_Word(sink, (uint32_t)va_arg(ap, void *));
+                break;
+            default:
+                // %%和未知格式符不带参数
+                break;
+        }
+    }
+}
+
+/**
+ * 把一次输出编码为二进制记录，格式见TERMINAL_DEFERRED
+ * @param sink 输出目标
+ * @param format 格式字符串（Flash中的常量）
+ * @param ap 可变参数列表
+ * @return 输出目标累计长度，参数部分超过255字节时不输出
+ */
+static int Terminal_Encode(Terminal_Sink *sink, const char *format, va_list ap) {
+    uint32_t address = (uint32_t)format;
+    va_list ap_measure;
+
+    // 先统计参数部分长度，用于填写记录头
+    Terminal_Sink measure = { NULL, 0, 0 };
+    va_copy(ap_measure, ap);
+    Terminal_Encode_Payload(&measure, format, ap_measure);
+    va_end(ap_measure);
+    if (measure.count > 0xFF) {
+        return sink->count;
     }
-    buf[index] = '\0';
 
+    Terminal_Put(sink, (char)TERMINAL_RECORD_MAGIC);
+    Terminal_Put(sink, (char)address);
+    Terminal_Put(sink, (char)(address >> 8));
+    Terminal_Put(sink, (char)(address >> 16));
+    Terminal_Put(sink, (char)measure.count);
+    Terminal_Encode_Payload(sink, format, ap);
+
+    return sink->count;
+}
+#endif
+
+/**
+ * 按当前模式输出一次格式化内容：文本模式格式化，二进制模式编码为记录
+ * @param sink 输出目标
+ * @param format 格式字符串
+ * @param ap 可变参数列表
+ * @return 输出目标累计长度
+ */
+static int Terminal_Emit(Terminal_Sink *sink, const char *format, va_list ap) {
+#if TERMINAL_DEFERRED
+    return Terminal_Encode(sink, format, ap);
+#else
+    return Terminal_Format(sink, format, ap);
+#endif
+}
+
+#if TERMINAL_PREFIX
+static const char terminal_prefix_format[] = "[%u %s] "; // 系统节拍数与任务名
+
+/**
+ * 输出消息前缀，与消息本体写入同一条记录
+ * @param sink 输出目标
+ * @param ... 前缀参数
+ */
+static void Terminal_Emit_Prefix(Terminal_Sink *sink, ...) {
+    va_list ap;
+    va_start(ap, sink);
+    Terminal_Emit(sink, terminal_prefix_format, ap);
     va_end(ap);
-	
-	extern DMA_Buffer_Manager Manager;
-    DMA_Buffer_Manager_Input(&Manager, (uint8_t *)buf, total_length);
-    
+}
+#endif
+
+/**
+ * 绑定终端输出使用的DMA缓冲区管理器
+ * @param manager 已初始化的管理器实例
+ */
+void Terminal_Initialize(DMA_Buffer_Manager * const manager) {
+    terminal_manager = manager;
+}
+
+/**
+ * 设置镜像回调，每条成功写入的文本记录同时交给回调（如LCD控制台）
+ * TERMINAL_DEFERRED为1时记录是二进制的，不调用回调
+ * @param mirror 回调，NULL取消镜像
+ */
+void Terminal_SetMirror(Terminal_Mirror mirror) {
+    terminal_mirror = mirror;
+}
+
+/**
+ * 格式化字符串到普通缓冲区，格式与Terminal_Output相同
+ * @param buf 目标缓冲区
+ * @param size 缓冲区大小（包括终止符）
+ * @param format 格式字符串
+ * @param ... 可变参数列表
+ * @return 格式化后的总字符数（不包括终止符，可能大于size - 1）
+ */
+int Terminal_Snprintf(char *buf, int size, const char *format, ...) {
+    va_list ap;
+    va_start(ap, format);
+
+    DMA_Buffer_Span span = { { (uint8_t *)buf, NULL }, { 0, 0 } };
+    Terminal_Sink sink = { &span, 0, 0 };
+    if (size > 0) {
+        span.Length[0] = (uint16_t)(size - 1);
+        sink.limit = size - 1;
+    }
+    int total_length = Terminal_Format(&sink, format, ap);
+    if (size > 0) {
+        buf[(total_length < size - 1) ? total_length : size - 1] = '\0'; // 确保字符串终止
+    }
+
+    va_end(ap);
+    return total_length;
+}
+
+/**
+ * 格式化字符串并作为一条完整记录写入DMA环形缓冲区，格式见Terminal_Format
+ * 第一遍只统计长度，按长度整体预留环形缓冲区后第二遍直接格式化到预留区域，
+ * 因此不需要中间缓冲区，也没有额外的拷贝
+ * 每次调用要么完整写入，要么整条丢弃（计入Dropped_Records），多个任务同时输出时互不穿插；
+ * 超过TERMINAL_RECORD_MAX的文本记录截断后写入
+ * TERMINAL_DEFERRED为1时输出二进制记录而不是文本，见Terminal_Encode
+ * TERMINAL_PREFIX为1时在消息前添加系统节拍数与任务名
+ * 设置了镜像回调时，写入的记录在提交前交给回调，丢弃的记录不镜像
+ * @param format 格式字符串
+ * @param ... 可变参数列表
+ * @return 写入的记录长度（截断时为截断后的长度），丢弃时为0
+ */
+int Terminal_Output(const char *format, ...) {
+    va_list ap;
+    va_list ap_write;
+    va_start(ap, format);
+    va_copy(ap_write, ap);
+
+    DMA_Buffer_Span span;
+    Terminal_Sink sink = { &span, 0, 0 };
+    int total_length = 0;
+
+#if TERMINAL_PREFIX
+    TickType_t tick = xTaskGetTickCount();
+    const char *name = (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED) ? "-" : pcTaskGetName(NULL);
+    Terminal_Emit_Prefix(&sink, tick, name);
+#endif
+    // 第一遍：统计长度
+    int record_length = Terminal_Emit(&sink, format, ap);
+
+    // 第二遍：整体预留空间后直接写入环形缓冲区，空间不足时整条放弃
+    if (terminal_manager != NULL && record_length > 0 && record_length <= 0xFFFF) {
+        int reserve_length = record_length;
+#if !TERMINAL_DEFERRED
+        // 超过环形缓冲区容量的记录永远预留不到，截断到容量（二进制记录截断后无法解码，仍整条丢弃）
+        if (reserve_length > TERMINAL_RECORD_MAX(terminal_manager)) {
+            reserve_length = TERMINAL_RECORD_MAX(terminal_manager);
+        }
+#endif
+        sink.count = 0;
+        sink.limit = DMA_Buffer_Manager_ReserveRecord(terminal_manager, (uint16_t)reserve_length, &span);
+        if (sink.limit != 0) {
+#if TERMINAL_PREFIX
+            Terminal_Emit_Prefix(&sink, tick, name);
+#endif
+            Terminal_Emit(&sink, format, ap_write);
+#if !TERMINAL_DEFERRED
+            // 截断的记录以换行结尾，不与下一条记录连在一起
+            if (reserve_length < record_length) {
+                sink.count = reserve_length - 1;
+                Terminal_Put(&sink, '\n');
+            }
+            // 提交后DMA读完的区域可能被其他任务重新预留，必须在提交前复制
+            if (terminal_mirror != NULL) {
+                terminal_mirror(&span, reserve_length);
+            }
+#endif
+            DMA_Buffer_Manager_Commit(terminal_manager);
+            total_length = reserve_length;
+        }
+    }
+
+    va_end(ap_write);
+    va_end(ap);
+
     return total_length;
 }
@@ -2,6 +2,48 @@
 #define Terminal_H
 
 #include <stdarg.h>
+#include "DMA-Buffer-Manager.h"
+
+/**
+ * 置1时Terminal_Output不在MCU上格式化，而是输出二进制记录：
+ *   0xA5 | 格式字符串地址(3字节,小端) | 参数长度(1字节) | 参数
+ * 数值参数按4字节小端原样输出，%c输出1字节，%s内联输出以0结尾的字符串，
+ * 由上位机工具Tools/terminal_decode.py结合固件的axf文件还原文本
+ * 该模式下format必须是存放在Flash中的字符串常量
+ */
+#ifndef TERMINAL_DEFERRED
+#define TERMINAL_DEFERRED 0
+#endif
+
+/**
+ * 置1时每条输出前添加"[系统节拍数 任务名] "前缀，与消息写入同一条记录
+ */
+#ifndef TERMINAL_PREFIX
+#define TERMINAL_PREFIX 0
+#endif
+
+#define TERMINAL_RECORD_MAGIC       0xA5    // 二进制记录起始字节，不会出现在ASCII文本中
+#define TERMINAL_RECORD_HEADER      5       // 记录头长度
+#define TERMINAL_RECORD_STRING_MAX  32      // %s内联字符串的最大长度（不包括终止符）
+
+/**
+ * 一条记录（包括前缀与换行）的最大长度为环形缓冲区长度减1：
+ * 更长的文本记录截断到该长度，最后一个字符替换为换行；二进制记录整条丢弃
+ */
+#define TERMINAL_RECORD_MAX(manager) ((manager)->_Buffer_Length - 1)
+
+/**
+ * 镜像回调：每条写入环形缓冲区的文本记录在提交前再交给回调一份
+ * span为记录所在的区域（环绕时分两段），length为记录长度
+ * 回调在输出任务中执行，必须很快返回且不能阻塞（如复制到流缓冲区后由低优先级任务处理）
+ */
+typedef void (*Terminal_Mirror)(const DMA_Buffer_Span *span, int length);
+
+void Terminal_Initialize(DMA_Buffer_Manager * const manager);
+
+void Terminal_SetMirror(Terminal_Mirror mirror);
+
+int Terminal_Snprintf(char *buf, int size, const char *format, ...);
 
 int Terminal_Output(const char *format, ...);
 
@@ -43,6 +43,12 @@
 #ifndef FREERTOS_CONFIG_H
 #define FREERTOS_CONFIG_H
 
+/* The host simulation build (Simulation/Makefile) runs the same kernel sources
+ * on the FreeRTOS POSIX port and supplies its own configuration. */
+#if defined( NBK2002_SIMULATION )
+#include "FreeRTOSConfig_Simulation.h"
+#else
+
 /******************************************************************************/
 /* Hardware description related definitions. **********************************/
 /******************************************************************************/
@@ -145,7 +151,7 @@
  * configTASK_NOTIFICATION_ARRAY_ENTRIES sets the number of indexes in the
  * array. See https://www.freertos.org/RTOS-task-notifications.html  Defaults to
  * 1 if left undefined. */
-#define configTASK_NOTIFICATION_ARRAY_ENTRIES      1
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES      4
 
 /* configQUEUE_REGISTRY_SIZE sets the maximum number of queues and semaphores
  * that can be referenced from the queue registry.  Only required when using a
@@ -662,4 +668,6 @@
 #define xPortPendSVHandler PendSV_Handler
 #define xPortSysTickHandler SysTick_IRQHandler
 
+#endif /* NBK2002_SIMULATION */
+
 #endif /* FREERTOS_CONFIG_H */
@@ -20,6 +20,8 @@
 #include "HeadFiles\SC_itExtern.h"
 #include "SCDriver_List.h"
 #include "DMA-Buffer-Manager.h"
+#include "DMA-Receive-Manager.h"
+#include "SPI_Dynamic_Buffer.h"
 
 /**************************************Generated by EasyCodeCube*************************************/
 //Forbid editing areas between the labels !!!
@@ -107,28 +109,42 @@ void BTM_IRQHandler(void)
 
 void DMA0_IRQHandler(void)
 {
-	extern DMA_Buffer_Manager Manager;
 	DMA_ClearFlag(DMA0, DMA_FLAG_GIF|DMA_FLAG_TCIF|DMA_FLAG_HTIF|DMA_FLAG_TEIF);//Generated by EasyCodeCube, forbid editing!!!
-    DMA_Buffer_Manager_IRQHandler(&Manager);
+    DMA_Buffer_Manager_Dispatch(DMA0);
+    DMA_Receive_Manager_Dispatch(DMA0);
+    SPI_ChunkBuffer_RxDispatch(&spi0, DMA0);
 }
 
-/*
 void DMA1_IRQHandler(void)
 {
 	DMA_ClearFlag(DMA1, DMA_FLAG_GIF|DMA_FLAG_TCIF|DMA_FLAG_HTIF|DMA_FLAG_TEIF);//Generated by EasyCodeCube, forbid editing!!!
+    DMA_Buffer_Manager_Dispatch(DMA1);
+    DMA_Receive_Manager_Dispatch(DMA1);
+    SPI_ChunkBuffer_IRQHandler(&spi0);
 }
-*/
 
 void DMA2_IRQHandler(void)
 {
     /*<Generated by EasyCodeCube begin>*/
     /*<Generated by EasyCodeCube end>*/
+#if defined (SC32f10xx)
+	DMA_ClearFlag(DMA2, DMA_FLAG_GIF|DMA_FLAG_TCIF|DMA_FLAG_HTIF|DMA_FLAG_TEIF);
+    DMA_Buffer_Manager_Dispatch(DMA2);
+    DMA_Receive_Manager_Dispatch(DMA2);
+    SPI_ChunkBuffer_RxDispatch(&spi0, DMA2);
+#endif
 }
 
 void DMA3_IRQHandler(void)
 {
     /*<Generated by EasyCodeCube begin>*/
     /*<Generated by EasyCodeCube end>*/
+#if defined (SC32f10xx)
+	DMA_ClearFlag(DMA3, DMA_FLAG_GIF|DMA_FLAG_TCIF|DMA_FLAG_HTIF|DMA_FLAG_TEIF);
+    DMA_Buffer_Manager_Dispatch(DMA3);
+    DMA_Receive_Manager_Dispatch(DMA3);
+    SPI_ChunkBuffer_RxDispatch(&spi0, DMA3);
+#endif
 }
 
 
@@ -136,6 +152,8 @@ void TIMER0_IRQHandler(void)
 {
     /*<Generated by EasyCodeCube begin>*/
     /*<Generated by EasyCodeCube end>*/
+    TIM_ClearFlag(TIM0, TIM_Flag_TI);
+    DMA_Receive_Manager_Poll();
 }
 
 void TIMER1_IRQHandler(void)
@@ -262,12 +280,10 @@ void CMP_IRQHandler(void)
     /*<Generated by EasyCodeCube end>*/
 }
 
-/*
 void SPI0_IRQHandler(void)
 {
 	SPI_ClearFlag(SPI0, SPI_Flag_SPIF|SPI_Flag_RINEIF|SPI_Flag_TXEIF|SPI_Flag_RXFIF|SPI_Flag_RXHIF|SPI_Flag_TXHIF|SPI_Flag_WCOL);//Generated by EasyCodeCube, forbid editing!!!
 }
-*/
 
 void SPI1_IRQHandler(void)
 {
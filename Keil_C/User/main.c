@@ -21,21 +21,86 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "DMA-Buffer-Manager.h"
+#include "Terminal.h"
+#include "Benchmark.h"
+#include "DMA-Receive-Manager.h"
+#include "ST7789.h"
+#include "SPI_Flash.h"
+#include "Font.h"
+#include "Console.h"
 
 /**************************************Generated by EasyCodeCube*************************************/
 //Forbid editing areas between the labels !!!
 
 /*************************************.Generated by EasyCodeCube.************************************/
 
+/* UART1 receive demo: DMA1 is shared with SPI0 TX, enable only when SPI is unused */
+#ifndef UART_RECEIVE_ENABLE
+#define UART_RECEIVE_ENABLE 0
+#endif
+
+/* ST7789 display on SPI0 (DMA1), exclusive with the UART receive demo */
+#ifndef ST7789_ENABLE
+#define ST7789_ENABLE 0
+#endif
+
+/* Mirror the terminal onto the ST7789 as a scrolling console, the console task owns the display */
+#ifndef CONSOLE_ENABLE
+#define CONSOLE_ENABLE 0
+#endif
+/* Drive the ST7789 over the 8080 parallel bus (pins in Parallel_8080.h) instead of SPI0 */
+#ifndef ST7789_BUS_8080
+#define ST7789_BUS_8080 0
+#endif
+#if ST7789_BUS_8080
+#define ST7789_BUS NULL
+#else
+#define ST7789_BUS (&spi0)
+#endif
+
+#if CONSOLE_ENABLE && !ST7789_ENABLE
+#error "CONSOLE_ENABLE needs ST7789_ENABLE"
+#endif
+
+/* SPI NOR flash on SPI0, sharing the bus with ST7789 by chip select */
+#ifndef SPI_FLASH_ENABLE
+#define SPI_FLASH_ENABLE 0
+#endif
+
+/* Reads are full duplex and need a DMA channel on SPI0 RX besides DMA1 (TX).
+ * SC32F12xx only has DMA0/DMA1 and DMA0 always drives the terminal, so there is no channel left */
+#if SPI_FLASH_ENABLE && !defined(SC32f10xx)
+#error "SPI_FLASH_ENABLE needs a free DMA channel for SPI0 RX: DMA0 carries the terminal and DMA1 carries SPI0 TX"
+#endif
+#if SPI_FLASH_ENABLE && !defined(SPI_FLASH_RX_DMA)
+#define SPI_FLASH_RX_DMA DMA2
+#endif
+
+#if UART_RECEIVE_ENABLE && ((ST7789_ENABLE && !ST7789_BUS_8080) || SPI_FLASH_ENABLE)
+#error "UART_RECEIVE_ENABLE takes DMA1, which carries SPI0 TX for the ST7789 and the SPI flash"
+#endif
+
 static TaskHandle_t tasks;
 DMA_Buffer_Manager Manager;
+/* terminal ring and the I/O stack mutexes are placed at link time, not taken from the FreeRTOS heap */
+static uint8_t Manager_Buffer[256]; /* longest terminal record is 255 bytes, see TERMINAL_RECORD_MAX */
+static StaticSemaphore_t Manager_Mutex;
+#if (ST7789_ENABLE && !ST7789_BUS_8080) || SPI_FLASH_ENABLE
+static StaticSemaphore_t spi0_mutex;
+#endif
+#if UART_RECEIVE_ENABLE
+DMA_Receive_Manager Receiver;
+#endif
 
 void vTask_Monitor(void *pvParameters)
 {
 	for (;;)
 	{
 		GPIO_TogglePins(GPIOB, GPIO_Pin_15);
+#if !BENCHMARK_ENABLE
+		/* unterminated, it would glue onto the benchmark lines checked by Tools/terminal_stress_check.py */
 		DMA_Buffer_Manager_Input(&Manager, (uint8_t *)"0123456789", 10);
+#endif
 		//DMA_Buffer_Manager_Input(&Manager, (uint8_t *)"0123456789", 10);
 		//DMA_Buffer_Manager_Input(&Manager, (uint8_t *)"0123456789", 10);
 		//DMA_Buffer_Manager_Input(&Manager, (uint8_t *)"0123456789", 10);
@@ -54,6 +119,55 @@ void vTask_Monitor1(void *pvParameters)
 	}
 }
 
+#if ST7789_ENABLE && !CONSOLE_ENABLE
+void vTask_Display(void *pvParameters)
+{
+	ST7789_Initialize(ST7789_BUS);
+	ST7789_FillScreen(ST7789_RGB565(0, 0, 0));
+	Font_Draw_String(&Font_Mono16, 8, 8, "NBK2002 SC32F12xx", ST7789_RGB565(255, 255, 255), ST7789_RGB565(0, 0, 0));
+#if BENCHMARK_ENABLE
+	Benchmark_ST7789_Fill();
+	Benchmark_ST7789_Pixels();
+	Benchmark_Renderer();
+	Benchmark_Image();
+	Benchmark_Chart();
+#endif
+	ST7789_Release();
+	vTaskDelete(NULL);
+}
+#endif
+
+#if SPI_FLASH_ENABLE
+void vTask_Flash(void *pvParameters)
+{
+	if (!SPI_Flash_Initialize(&spi0))
+	{
+		Terminal_Output("$ [Flash] not found\n");
+		vTaskDelete(NULL);
+	}
+	const SPI_Flash_Info *info = SPI_Flash_GetInfo();
+	Terminal_Output("$ [Flash] JEDEC %02X %02X %02X, %u KB\n", info->Manufacturer, info->Memory_Type,
+	                info->Capacity, info->Size / 1024);
+#if BENCHMARK_ENABLE
+	Benchmark_SPI_Flash();
+#endif
+	vTaskDelete(NULL);
+}
+#endif
+
+#if UART_RECEIVE_ENABLE
+void vTask_Receive(void *pvParameters)
+{
+	static char frame[65];
+	for (;;)
+	{
+		size_t length = DMA_Receive_Manager_Receive(&Receiver, frame, sizeof(frame) - 1, portMAX_DELAY);
+		frame[length] = '\0';
+		Terminal_Output("$ [RX] %u: %s\n", (unsigned int)length, frame);
+	}
+}
+#endif
+
 /**
   * @brief This function implements main function.
   * @note 
@@ -62,10 +176,41 @@ void vTask_Monitor1(void *pvParameters)
 int main(void)
 {	
     IcResourceInit();
-	DMA_Buffer_Manager_Initialize(&Manager, 64, DMA0, UART0, DMA_UART);
+	DMA_Buffer_Manager_InitializeStatic(&Manager, Manager_Buffer, sizeof(Manager_Buffer), &Manager_Mutex,
+	                                    DMA0, UART1, DMA_UART);
+	Terminal_Initialize(&Manager);
+#if CONSOLE_ENABLE
+	Console_Initialize();
+#endif
+#if UART_RECEIVE_ENABLE
+	/* 64-byte ring, frame ends after 4 x 250us (~11 characters at 115200) of silence */
+	DMA_Receive_Manager_Initialize(&Receiver, 64, 256, 4, DMA1, UART1, DMA_UART);
+	DMA_Receive_Manager_StartTimer(TIM0, 250);
+#endif
+#if (ST7789_ENABLE && !ST7789_BUS_8080) || SPI_FLASH_ENABLE
+	SPI_ChunkBuffer_InitStatic(&spi0, &spi0_mutex);
+#endif
+#if SPI_FLASH_ENABLE
+	SPI_ChunkBuffer_AttachRx(&spi0, SPI_FLASH_RX_DMA);
+#endif
 
     xTaskCreate(vTask_Monitor, "Monitor", 128, NULL, 1, &tasks);
     //xTaskCreate(vTask_Monitor1, "Monitor", 72, NULL, 1, &tasks);
+#if UART_RECEIVE_ENABLE
+    xTaskCreate(vTask_Receive, "Receive", 128, NULL, 2, NULL);
+#endif
+#if CONSOLE_ENABLE
+    /* below every logging task, so output never waits for the display */
+    xTaskCreate(Console_Task, "Console", 192, ST7789_BUS, tskIDLE_PRIORITY, NULL);
+#elif ST7789_ENABLE
+    xTaskCreate(vTask_Display, "Display", 192, NULL, 1, NULL);
+#endif
+#if SPI_FLASH_ENABLE
+    xTaskCreate(vTask_Flash, "Flash", 160, NULL, 1, NULL);
+#endif
+#if BENCHMARK_ENABLE
+    xTaskCreate(Benchmark_Task, "Bench", 160, &Manager, 1, NULL);
+#endif
     vTaskStartScheduler();
     
     while (1) {}
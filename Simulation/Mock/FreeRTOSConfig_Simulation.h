@@ -0,0 +1,91 @@
+/**
+ * @file FreeRTOSConfig_Simulation.h
+ * @brief 主机仿真构建（FreeRTOS POSIX移植层）使用的内核配置
+ * @note 由Keil_C/FreeRTOS/include/FreeRTOSConfig.h在定义NBK2002_SIMULATION时包含。
+ *       内核功能与目标板配置保持一致（通知数组、流缓冲区、互斥锁等），
+ *       只放大堆与任务栈（POSIX移植层把任务栈用作线程栈），
+ *       并把断言改为打印位置后退出
+ */
+
+#ifndef FREERTOS_CONFIG_SIMULATION_H
+#define FREERTOS_CONFIG_SIMULATION_H
+
+/* 与目标板一致的时钟参数，Benchmark等按周期换算的代码保持同样的结果 */
+#define configCPU_CLOCK_HZ                         ( ( unsigned long ) 64000000 )
+#define configSYSTICK_CLOCK_HZ                     8000000
+#define configTICK_RATE_HZ                         1000
+
+#define configUSE_PREEMPTION                       1
+#define configUSE_TIME_SLICING                     1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
+#define configUSE_TICKLESS_IDLE                    0
+#define configMAX_PRIORITIES                       8
+#define configMINIMAL_STACK_SIZE                   ( 65536 / sizeof( StackType_t ) ) // 不小于各平台的PTHREAD_STACK_MIN
+#define configMAX_TASK_NAME_LEN                    32
+#define configTICK_TYPE_WIDTH_IN_BITS              TICK_TYPE_WIDTH_32_BITS
+#define configIDLE_SHOULD_YIELD                    1
+#define configTASK_NOTIFICATION_ARRAY_ENTRIES      4
+#define configQUEUE_REGISTRY_SIZE                  8
+#define configENABLE_BACKWARD_COMPATIBILITY        0
+#define configNUM_THREAD_LOCAL_STORAGE_POINTERS    0
+#define configUSE_MINI_LIST_ITEM                   1
+#define configSTACK_DEPTH_TYPE                     size_t
+#define configMESSAGE_BUFFER_LENGTH_TYPE           size_t
+#define configHEAP_CLEAR_MEMORY_ON_FREE            1
+#define configUSE_NEWLIB_REENTRANT                 0
+
+/* 定时器任务低于仿真时钟任务（configMAX_PRIORITIES - 1），保证“中断”优先于所有任务 */
+#define configUSE_TIMERS                           1
+#define configTIMER_TASK_PRIORITY                  ( configMAX_PRIORITIES - 2 )
+#define configTIMER_TASK_STACK_DEPTH               configMINIMAL_STACK_SIZE
+#define configTIMER_QUEUE_LENGTH                   10
+
+#define configUSE_EVENT_GROUPS                     1
+#define configUSE_STREAM_BUFFERS                   1
+
+#define configSUPPORT_STATIC_ALLOCATION            1
+#define configSUPPORT_DYNAMIC_ALLOCATION           1
+#define configKERNEL_PROVIDED_STATIC_MEMORY        1
+#define configTOTAL_HEAP_SIZE                      ( 4 * 1024 * 1024 )
+#define configAPPLICATION_ALLOCATED_HEAP           0
+
+#define configUSE_IDLE_HOOK                        0
+#define configUSE_TICK_HOOK                        0
+#define configUSE_MALLOC_FAILED_HOOK               0
+#define configUSE_DAEMON_TASK_STARTUP_HOOK         0
+#define configUSE_SB_COMPLETED_CALLBACK            0
+#define configCHECK_FOR_STACK_OVERFLOW             0
+#define configGENERATE_RUN_TIME_STATS              0
+#define configUSE_TRACE_FACILITY                   0
+#define configUSE_STATS_FORMATTING_FUNCTIONS       0
+#define configUSE_CO_ROUTINES                      0
+
+#define configUSE_TASK_NOTIFICATIONS               1
+#define configUSE_MUTEXES                          1
+#define configUSE_RECURSIVE_MUTEXES                1
+#define configUSE_COUNTING_SEMAPHORES              1
+#define configUSE_QUEUE_SETS                       0
+#define configUSE_APPLICATION_TASK_TAG             0
+#define configUSE_POSIX_ERRNO                      0
+
+#define INCLUDE_vTaskPrioritySet                   1
+#define INCLUDE_uxTaskPriorityGet                  1
+#define INCLUDE_vTaskDelete                        1
+#define INCLUDE_vTaskSuspend                       1
+#define INCLUDE_vTaskDelayUntil                    1
+#define INCLUDE_vTaskDelay                         1
+#define INCLUDE_xTaskGetSchedulerState             1
+#define INCLUDE_xTaskGetCurrentTaskHandle          1
+#define INCLUDE_uxTaskGetStackHighWaterMark        1
+#define INCLUDE_xTaskGetIdleTaskHandle             0
+#define INCLUDE_eTaskGetState                      0
+#define INCLUDE_xTimerPendFunctionCall             0
+#define INCLUDE_xTaskAbortDelay                    0
+#define INCLUDE_xTaskGetHandle                     0
+#define INCLUDE_xTaskResumeFromISR                 1
+
+/* 断言失败时打印位置并以非0状态退出，便于脚本判断 */
+void vAssertCalled( const char * pcFile, unsigned long ulLine );
+#define configASSERT( x )    if( ( x ) == 0 ) vAssertCalled( __FILE__, __LINE__ )
+
+#endif /* FREERTOS_CONFIG_SIMULATION_H */
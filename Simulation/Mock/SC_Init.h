@@ -0,0 +1,571 @@
+/**
+ * @file SC_Init.h
+ * @brief 主机仿真用的SC32F12xx外设模型头文件
+ * @note 替代User/SC_Init.h与固件库头文件，只提供Apps层用到的部分：
+ *       寄存器结构体与位定义与sc32f12xx.h保持一致，外设实例指向仿真寄存器，
+ *       固件库函数在SC_Simulation.c中按原库的寄存器操作实现，
+ *       外设的数据节拍、DMA搬运与中断由仿真时钟Sim_Advance驱动
+ */
+
+#ifndef _SC_INIT_H_
+#define _SC_INIT_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SC32f12xx
+
+#define __IO volatile
+
+typedef enum {RESET = 0, SET = !RESET} FlagStatus, ITStatus;
+typedef enum {DISABLE = 0, ENABLE = !DISABLE} FunctionalState;
+
+typedef enum
+{
+	SysTick_IRQn    = -1,
+	SPI0_IRQn       = 9,
+	SPI1_2_IRQn     = 10,
+	DMA0_IRQn       = 11,
+	DMA1_IRQn       = 12,
+	TIMER0_IRQn     = 15,
+	TIMER1_IRQn     = 16,
+	TIMER2_IRQn     = 17,
+	TIMER3_IRQn     = 18,
+	TWI0_IRQn       = 23,
+} IRQn_Type;
+
+/* 寄存器结构体 --------------------------------------------------------------*/
+
+typedef struct
+{
+	__IO uint32_t DMA_SADR;
+	__IO uint32_t DMA_DADR;
+	__IO uint32_t DMA_CFG;
+	__IO uint32_t DMA_CNT;
+	__IO uint32_t DMA_STS;
+} DMA_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t UART_CON;
+	__IO uint32_t UART_STS;
+	__IO uint32_t UART_BAUD;
+	__IO uint32_t UART_DATA;
+	__IO uint32_t UART_IDE;
+} UART_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t SPI_CON;
+	__IO uint32_t SPI_STS;
+	__IO uint32_t RESERVED;
+	__IO uint32_t SPI_DATA;
+	__IO uint32_t SPI_IDE;
+	__IO uint32_t RESERVED2;
+	__IO uint32_t RESERVED3;
+	__IO uint32_t SPI_REV;
+} SPI_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t PIN;
+	__IO uint32_t RESERVED0[7];
+	__IO uint32_t PXCON;
+	__IO uint32_t RESERVED1[7];
+	__IO uint32_t PXPH;
+	__IO uint32_t RESERVED2[7];
+	__IO uint32_t PXLEV;
+} GPIO_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t TWI_CON;
+	__IO uint32_t TWI_STS;
+	__IO uint32_t TWI_ADD;
+	__IO uint32_t TWI_DATA;
+	__IO uint32_t TWI_IDE;
+} TWI_TypeDef;
+
+typedef struct
+{
+	__IO uint32_t TIM_CON;
+	__IO uint32_t TIM_CNT;
+	__IO uint32_t TIM_RLD;
+	__IO uint32_t TIM_STS;
+	__IO uint32_t TIM_PDTA_RCAP;
+	__IO uint32_t TIM_PDTB_FCAP;
+	__IO uint32_t TIM_IDE;
+} TIM_TypeDef;
+
+/* 仿真寄存器实例 ------------------------------------------------------------*/
+
+extern DMA_TypeDef  Sim_DMA[2];
+extern UART_TypeDef Sim_UART[2];
+extern SPI_TypeDef  Sim_SPI[2];
+extern TWI_TypeDef  Sim_TWI[1];
+extern TIM_TypeDef  Sim_TIM[4];
+extern GPIO_TypeDef Sim_GPIO[3];
+
+#define DMA0  (&Sim_DMA[0])
+#define DMA1  (&Sim_DMA[1])
+#define UART0 (&Sim_UART[0])
+#define UART1 (&Sim_UART[1])
+#define SPI0  (&Sim_SPI[0])
+#define SPI1  (&Sim_SPI[1])
+#define TWI0  (&Sim_TWI[0])
+#define TIM0  (&Sim_TIM[0])
+#define TIM1  (&Sim_TIM[1])
+#define TIM2  (&Sim_TIM[2])
+#define TIM3  (&Sim_TIM[3])
+#define GPIOA (&Sim_GPIO[0])
+#define GPIOB (&Sim_GPIO[1])
+#define GPIOC (&Sim_GPIO[2])
+
+/* 寄存器位定义（与sc32f12xx.h一致） -----------------------------------------*/
+
+#define DMA_CFG_PL          (0x3UL << 0)
+#define DMA_CFG_TXWIDTH_Pos (2U)
+#define DMA_CFG_TXWIDTH     (0x3UL << DMA_CFG_TXWIDTH_Pos)
+#define DMA_CFG_CIRC        (0x1UL << 4)
+#define DMA_CFG_PAUSE       (0x1UL << 5)
+#define DMA_CFG_CHRST       (0x1UL << 6)
+#define DMA_CFG_CHEN        (0x1UL << 7)
+#define DMA_CFG_DAINC_Pos   (8U)
+#define DMA_CFG_DAINC       (0x3UL << DMA_CFG_DAINC_Pos)
+#define DMA_CFG_SAINC_Pos   (10U)
+#define DMA_CFG_SAINC       (0x3UL << DMA_CFG_SAINC_Pos)
+#define DMA_CFG_BURSIZE     (0x7UL << 12)
+#define DMA_CFG_TPTYPE      (0x1UL << 15)
+#define DMA_CFG_INTEN       (0x1UL << 16)
+#define DMA_CFG_TCIE        (0x1UL << 17)
+#define DMA_CFG_HTIE        (0x1UL << 18)
+#define DMA_CFG_TEIE        (0x1UL << 19)
+#define DMA_CFG_CHRQ        (0x1UL << 23)
+#define DMA_CFG_REQSRC_Pos  (24U)
+#define DMA_CFG_REQSRC      (0x3FUL << DMA_CFG_REQSRC_Pos)
+
+#define DMA_STS_GIF         (0x1UL << 0)
+#define DMA_STS_TCIF        (0x1UL << 1)
+#define DMA_STS_HTIF        (0x1UL << 2)
+#define DMA_STS_TEIF        (0x1UL << 3)
+#define DMA_STS_STATUS      (0xFUL << 4)
+#define DMA_STS_SWREQ       (0x1UL << 8)
+
+#define UART_CON_RXEN       (0x1UL << 6)
+#define UART_CON_TXEN       (0x1UL << 7)
+#define UART_IDE_RXDMAEN    (0x1UL << 6)
+#define UART_IDE_TXDMAEN    (0x1UL << 7)
+
+#define SPI_CON_SPMD_Pos    (1U)
+#define SPI_CON_SPMD        (0x1UL << SPI_CON_SPMD_Pos)
+#define SPI_CON_CPHA_Pos    (3U)
+#define SPI_CON_CPHA        (0x1UL << SPI_CON_CPHA_Pos)
+#define SPI_CON_CPOL_Pos    (4U)
+#define SPI_CON_CPOL        (0x1UL << SPI_CON_CPOL_Pos)
+#define SPI_CON_SPEN        (0x1UL << 7)
+#define SPI_CON_SPR_Pos     (8U)
+#define SPI_CON_SPR_Msk     (0x0FUL << SPI_CON_SPR_Pos)
+#define SPI_STS_SPIF        (0x1UL << 0)
+#define SPI_STS_RINEIF      (0x1UL << 1)
+#define SPI_STS_TXEIF       (0x1UL << 2)
+#define SPI_STS_RXFIF       (0x1UL << 3)
+#define SPI_STS_RXHIF       (0x1UL << 4)
+#define SPI_STS_TXHIF       (0x1UL << 5)
+#define SPI_STS_WCOL        (0x1UL << 7)
+#define SPI_IDE_RXDMAEN     (0x1UL << 6)
+#define SPI_IDE_TXDMAEN     (0x1UL << 7)
+
+#define TWI_IDE_RXDMAEN     (0x1UL << 6)
+#define TWI_IDE_TXDMAEN     (0x1UL << 7)
+
+#define TIM_CON_CTSEL       (0x1UL << 1)
+#define TIM_CON_DEC         (0x1UL << 6)
+#define TIM_CON_TR          (0x1UL << 7)
+#define TIM_CON_TIMCLK_Pos  (8U)
+#define TIM_CON_TIMCLK      (0x7UL << TIM_CON_TIMCLK_Pos)
+#define TIM_IDE_INTEN       (0x1UL << 0)
+#define TIM_IDE_TIE         (0x1UL << 1)
+
+/* DMA固件库 ----------------------------------------------------------------*/
+
+typedef enum
+{
+	DMA_Priority_LOW       = (0x00UL << 0),
+	DMA_Priority_MEDIUM    = (0x01UL << 0),
+	DMA_Priority_HIGH      = (0x02UL << 0),
+	DMA_Priority_VERY_HIGH = (0x03UL << 0),
+} DMA_Priority_TypeDef;
+
+typedef enum
+{
+	DMA_CircularMode_Disable = (0x00UL << 4),
+	DMA_CircularMode_Enable  = (0x01UL << 4),
+} DMA_CircularMode_TypeDef;
+
+typedef enum
+{
+	DMA_DataSize_Byte     = (0x00UL << DMA_CFG_TXWIDTH_Pos),
+	DMA_DataSize_HakfWord = (0x01UL << DMA_CFG_TXWIDTH_Pos),
+	DMA_DataSize_Word     = (0x02UL << DMA_CFG_TXWIDTH_Pos),
+} DMA_DataSize_TypeDef;
+
+typedef enum
+{
+	DMA_TargetMode_FIXED    = (0x00UL << DMA_CFG_DAINC_Pos),
+	DMA_TargetMode_INC      = (0x01UL << DMA_CFG_DAINC_Pos),
+	DMA_TargetMode_DEC      = (0x02UL << DMA_CFG_DAINC_Pos),
+	DMA_TargetMode_INC_CIRC = (0x03UL << DMA_CFG_DAINC_Pos),
+} DMA_TargetMode_TypeDef;
+
+typedef enum
+{
+	DMA_SourceMode_FIXED    = (0x00UL << DMA_CFG_SAINC_Pos),
+	DMA_SourceMode_INC      = (0x01UL << DMA_CFG_SAINC_Pos),
+	DMA_SourceMode_DEC      = (0x02UL << DMA_CFG_SAINC_Pos),
+	DMA_SourceMode_INC_CIRC = (0x03UL << DMA_CFG_SAINC_Pos),
+} DMA_SourceMode_TypeDef;
+
+typedef enum
+{
+	DMA_Burst_Disable = 0x0000,
+} DMA_Burst_TypeDef;
+
+typedef enum
+{
+	DMA_Request_Null     = (0x0000UL << DMA_CFG_REQSRC_Pos),
+	DMA_Request_UART0_TX = (0x0002UL << DMA_CFG_REQSRC_Pos),
+	DMA_Request_UART0_RX = (0x0003UL << DMA_CFG_REQSRC_Pos),
+	DMA_Request_UART1_TX = (0x0004UL << DMA_CFG_REQSRC_Pos),
+	DMA_Request_UART1_RX = (0x0005UL << DMA_CFG_REQSRC_Pos),
+	DMA_Request_SPI0_TX  = (0x000CUL << DMA_CFG_REQSRC_Pos),
+	DMA_Request_SPI0_RX  = (0x000DUL << DMA_CFG_REQSRC_Pos),
+	DMA_Request_SPI1_TX  = (0x000EUL << DMA_CFG_REQSRC_Pos),
+	DMA_Request_SPI1_RX  = (0x000FUL << DMA_CFG_REQSRC_Pos),
+	DMA_Request_TWI0_TX  = (0x0014UL << DMA_CFG_REQSRC_Pos),
+	DMA_Request_TWI0_RX  = (0x0015UL << DMA_CFG_REQSRC_Pos),
+} DMA_Request_TypeDef;
+
+typedef enum
+{
+	DMA_IT_INTEN = DMA_CFG_INTEN,
+	DMA_IT_TCIE  = DMA_CFG_TCIE,
+	DMA_IT_HTIE  = DMA_CFG_HTIE,
+	DMA_IT_TEIE  = DMA_CFG_TEIE,
+} DMA_IT_TypeDef;
+
+typedef enum
+{
+	DMA_FLAG_GIF  = DMA_STS_GIF,
+	DMA_FLAG_TCIF = DMA_STS_TCIF,
+	DMA_FLAG_HTIF = DMA_STS_HTIF,
+	DMA_FLAG_TEIF = DMA_STS_TEIF,
+} DMA_Flag_TypeDef;
+
+typedef enum
+{
+	DMA_DMAReq_CHRQ = DMA_CFG_CHRQ,
+} DMA_DMAReq_TypeDef;
+
+typedef struct
+{
+	uint16_t DMA_Priority;
+	uint16_t DMA_CircularMode;
+	uint16_t DMA_DataSize;
+	uint16_t DMA_TargetMode;
+	uint16_t DMA_SourceMode;
+	uint16_t DMA_Burst;
+	uint32_t DMA_BufferSize;
+	uint32_t DMA_Request;
+	uint32_t DMA_SrcAddress;
+	uint32_t DMA_DstAddress;
+} DMA_InitTypeDef;
+
+void DMA_Init(DMA_TypeDef* DMAx, DMA_InitTypeDef* DMA_InitStruct);
+void DMA_StructInit(DMA_InitTypeDef* DMA_InitStruct);
+void DMA_Cmd(DMA_TypeDef* DMAx, FunctionalState NewState);
+void DMA_PauseCmd(DMA_TypeDef* DMAx, FunctionalState NewState);
+void DMA_ChannelReset(DMA_TypeDef* DMAx);
+void DMA_SetSrcAddress(DMA_TypeDef* DMAx, uint32_t SrcAddress);
+void DMA_SetDstAddress(DMA_TypeDef* DMAx, uint32_t DstAddress);
+void DMA_SetCurrDataCounter(DMA_TypeDef* DMAx, uint32_t Counter);
+uint32_t DMA_GetCurrDataCounter(DMA_TypeDef* DMAx);
+void DMA_SoftwareTrigger(DMA_TypeDef* DMAx);
+void DMA_ITConfig(DMA_TypeDef* DMAx, uint32_t DMA_IT, FunctionalState NewState);
+FlagStatus DMA_GetFlagStatus(DMA_TypeDef* DMAx, DMA_Flag_TypeDef DMA_FLAG);
+void DMA_ClearFlag(DMA_TypeDef* DMAx, uint32_t DMA_FLAG);
+void DMA_DMACmd(DMA_TypeDef* DMAx, uint32_t DMA_DMARequest, FunctionalState NewState);
+
+/* UART/SPI/TWI固件库 -------------------------------------------------------*/
+
+typedef enum
+{
+	UART_DMAReq_RX = UART_IDE_RXDMAEN,
+	UART_DMAReq_TX = UART_IDE_TXDMAEN,
+} UART_DMAReq_TypeDef;
+
+typedef enum
+{
+	SPI_Flag_SPIF   = SPI_STS_SPIF,
+	SPI_Flag_RINEIF = SPI_STS_RINEIF,
+	SPI_Flag_TXEIF  = SPI_STS_TXEIF,
+	SPI_Flag_RXFIF  = SPI_STS_RXFIF,
+	SPI_Flag_RXHIF  = SPI_STS_RXHIF,
+	SPI_Flag_TXHIF  = SPI_STS_TXHIF,
+	SPI_Flag_WCOL   = SPI_STS_WCOL,
+} SPI_FLAG_TypeDef;
+
+typedef enum
+{
+	SPI_DataSize_8B  = (0x00U << SPI_CON_SPMD_Pos),
+	SPI_DataSize_16B = (0x01U << SPI_CON_SPMD_Pos),
+} SPI_DataSize_TypeDef;
+
+typedef enum
+{
+	SPI_DMAReq_RX = SPI_IDE_RXDMAEN,
+	SPI_DMAReq_TX = SPI_IDE_TXDMAEN,
+} SPI_DMAReq_TypeDef;
+
+typedef enum
+{
+	TWI_DMAReq_RX = TWI_IDE_RXDMAEN,
+	TWI_DMAReq_TX = TWI_IDE_TXDMAEN,
+} TWI_DMAReq_TypeDef;
+
+void UART_RXCmd(UART_TypeDef* UARTx, FunctionalState NewState);
+void UART_SendData(UART_TypeDef* UARTx, uint16_t Data);
+void UART_DMACmd(UART_TypeDef* UARTx, uint16_t UART_DMAReq, FunctionalState NewState);
+void SPI_Cmd(SPI_TypeDef* SPIx, FunctionalState NewState);
+void SPI_DataSizeConfig(SPI_TypeDef* SPIx, SPI_DataSize_TypeDef SPI_DataSize);
+void SPI_SendData(SPI_TypeDef* SPIx, uint16_t Data);
+uint16_t SPI_ReceiveData(SPI_TypeDef* SPIx);
+FlagStatus SPI_GetFlagStatus(SPI_TypeDef* SPIx, SPI_FLAG_TypeDef SPI_FLAG);
+void SPI_ClearFlag(SPI_TypeDef* SPIx, uint32_t SPI_FLAG);
+void SPI_DMACmd(SPI_TypeDef* SPIx, uint16_t SPI_DMAReq, FunctionalState NewState);
+void TWI_DMACmd(TWI_TypeDef* TWIx, TWI_DMAReq_TypeDef TWI_DMAReq, FunctionalState NewState);
+
+/* GPIO固件库 ---------------------------------------------------------------*/
+
+typedef enum
+{
+	GPIO_Mode_IN_HI  = 0x00,
+	GPIO_Mode_IN_PU  = 0x01,
+	GPIO_Mode_OUT_PP = 0x02,
+} GPIO_Mode_TypeDef;
+
+typedef enum
+{
+	Bit_RESET = 0,
+	Bit_SET
+} BitAction;
+
+typedef enum
+{
+	GPIO_Pin_0  = ((uint16_t)0x0001),
+	GPIO_Pin_1  = ((uint16_t)0x0002),
+	GPIO_Pin_2  = ((uint16_t)0x0004),
+	GPIO_Pin_3  = ((uint16_t)0x0008),
+	GPIO_Pin_4  = ((uint16_t)0x0010),
+	GPIO_Pin_5  = ((uint16_t)0x0020),
+	GPIO_Pin_6  = ((uint16_t)0x0040),
+	GPIO_Pin_7  = ((uint16_t)0x0080),
+	GPIO_Pin_8  = ((uint16_t)0x0100),
+	GPIO_Pin_9  = ((uint16_t)0x0200),
+	GPIO_Pin_10 = ((uint16_t)0x0400),
+	GPIO_Pin_11 = ((uint16_t)0x0800),
+	GPIO_Pin_12 = ((uint16_t)0x1000),
+	GPIO_Pin_13 = ((uint16_t)0x2000),
+	GPIO_Pin_14 = ((uint16_t)0x4000),
+	GPIO_Pin_15 = ((uint16_t)0x8000),
+	GPIO_PIN_LNIB = ((uint16_t)0x00FF),
+	GPIO_PIN_HNIB = ((uint16_t)0xFF00),
+	GPIO_PIN_All  = ((uint16_t)0xFFFF),
+} GPIO_Pin_TypeDef;
+
+typedef struct
+{
+	uint16_t GPIO_Pin;
+	uint16_t GPIO_Mode;
+	uint16_t GPIO_DriveLevel;
+} GPIO_InitTypeDef;
+
+void GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_InitStruct);
+uint16_t GPIO_ReadData(GPIO_TypeDef* GPIOx);
+BitAction GPIO_ReadDataBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+void GPIO_SetBits(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+void GPIO_ResetBits(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+void GPIO_Write(GPIO_TypeDef* GPIOx, uint16_t PortVal);
+void GPIO_WriteBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, BitAction BitVal);
+void GPIO_TogglePins(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+
+/* TIM固件库 ----------------------------------------------------------------*/
+
+typedef enum
+{
+	TIM_PRESCALER_1   = (0x00U << TIM_CON_TIMCLK_Pos),
+	TIM_PRESCALER_2   = (0x01U << TIM_CON_TIMCLK_Pos),
+	TIM_PRESCALER_4   = (0x02U << TIM_CON_TIMCLK_Pos),
+	TIM_PRESCALER_8   = (0x03U << TIM_CON_TIMCLK_Pos),
+	TIM_PRESCALER_16  = (0x04U << TIM_CON_TIMCLK_Pos),
+	TIM_PRESCALER_32  = (0x05U << TIM_CON_TIMCLK_Pos),
+	TIM_PRESCALER_64  = (0x06U << TIM_CON_TIMCLK_Pos),
+	TIM_PRESCALER_128 = (0x07U << TIM_CON_TIMCLK_Pos),
+} TIM_Prescaler_TypeDef;
+
+typedef enum
+{
+	TIM_WorkMode_Timer   = 0,
+	TIM_WorkMode_Counter = TIM_CON_CTSEL,
+} TIM_WorkMode_Typedef;
+
+typedef enum
+{
+	TIM_CounterMode_Up      = 0,
+	TIM_CounterMode_Down_UP = TIM_CON_DEC,
+} TIM_CounterMode_Typedef;
+
+typedef enum
+{
+	TIM_IT_INTEN = TIM_IDE_INTEN,
+	TIM_IT_TI    = TIM_IDE_TIE,
+} TIM_IT_TypeDef;
+
+typedef enum
+{
+	TIM_Flag_TI  = 0x01,
+	TIM_Flag_EXR = 0x02,
+	TIM_Flag_EXF = 0x04,
+} TIM_Flag_TypeDef;
+
+typedef struct
+{
+	uint16_t TIM_Prescaler;
+	uint16_t TIM_WorkMode;
+	uint16_t TIM_CounterMode;
+	uint16_t TIM_EXENX;
+	uint16_t TIM_Preload;
+} TIM_TimeBaseInitTypeDef;
+
+void TIM_TIMBaseInit(TIM_TypeDef* TIMx, TIM_TimeBaseInitTypeDef* TIM_TimeBaseInitStruct);
+void TIM_TimeBaseStructInit(TIM_TimeBaseInitTypeDef* TIM_TimeBaseInitStruct);
+void TIM_Cmd(TIM_TypeDef* TIMx, FunctionalState NewState);
+void TIM_ITConfig(TIM_TypeDef* TIMx, uint16_t TIM_IT, FunctionalState NewState);
+void TIM_ClearFlag(TIM_TypeDef* TIMx, uint16_t TIM_FLAG);
+
+/* RCC/NVIC（仿真中只模拟DMA中断的挂起位） ------------------------------------*/
+
+typedef enum
+{
+	RCC_AHBPeriph_DMA = 0x01,
+} RCC_AHBPeriph_TypeDef;
+
+typedef enum
+{
+	RCC_APB0Periph_TIM0 = 0x01,
+	RCC_APB0Periph_TIM1 = 0x02,
+	RCC_APB0Periph_TIM2 = 0x04,
+	RCC_APB0Periph_TIM3 = 0x08,
+} RCC_APB0Periph_TypeDef;
+
+void RCC_AHBPeriphClockCmd(uint32_t RCC_AHBPeriph, FunctionalState NewState);
+void RCC_APB0PeriphClockCmd(uint32_t RCC_APB0Periph, FunctionalState NewState);
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority);
+void NVIC_EnableIRQ(IRQn_Type IRQn);
+void NVIC_DisableIRQ(IRQn_Type IRQn);
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn);
+
+/* 中断服务函数（Mock/SC_it.c，与User/SC_it.c对应） -------------------------*/
+
+void DMA0_IRQHandler(void);
+void DMA1_IRQHandler(void);
+void TIMER0_IRQHandler(void);
+void TIMER1_IRQHandler(void);
+void TIMER2_IRQHandler(void);
+void TIMER3_IRQHandler(void);
+
+/* 仿真接口 -----------------------------------------------------------------*/
+
+/**
+ * @brief 外设发送回调，外设每发出一个数据单元调用一次（16位帧模式的SPI按高字节在前分两次调用）
+ * @param Peripheral 外设实例（UART0/UART1、SPI0/SPI1、TWI0）
+ * @param Data 发出的数据
+ */
+typedef void (*Sim_Transmit_Callback)(void * Peripheral, uint32_t Data);
+
+/**
+ * @brief 复位所有仿真外设与仿真时钟
+ */
+void Sim_Reset(void);
+
+/**
+ * @brief 设置外设的数据节拍
+ * @param Peripheral 外设实例
+ * @param Unit_Ns 每个数据单元占用的时间（纳秒），例如115200波特率UART为86806
+ * @note 复位后UART为115200波特率（10位/字节），SPI为16MHz，TWI为400kHz
+ */
+void Sim_SetUnitTime(void * Peripheral, uint32_t Unit_Ns);
+
+/**
+ * @brief 设置外设发送回调
+ * @param Callback 回调函数，NULL表示丢弃发出的数据
+ */
+void Sim_SetTransmitCallback(Sim_Transmit_Callback Callback);
+
+/**
+ * @brief GPIO输出电平变化回调，GPIO固件库写PIN寄存器后调用
+ * @param Port GPIO端口
+ * @param Previous 写入前的PIN值
+ * @param Current 写入后的PIN值
+ */
+typedef void (*Sim_Pin_Callback)(GPIO_TypeDef * Port, uint32_t Previous, uint32_t Current);
+
+/**
+ * @brief 设置GPIO输出电平变化回调（用于模拟按片选响应的SPI从机）
+ * @param Callback 回调函数，NULL表示不通知
+ */
+void Sim_SetPinCallback(Sim_Pin_Callback Callback);
+
+/**
+ * @brief 向外设接收队列注入数据
+ * @param Peripheral 外设实例
+ * @param Data 数据
+ * @param Length 数据长度
+ * @param Gap_Us 注入的数据在当前接收队列排空后再等待多少微秒才开始到达，用于制造线路空闲
+ * @return 实际注入的长度（接收队列满时截断）
+ * @note 数据按外设节拍逐个到达，只有在外设打开DMA接收且DMA通道运行时才会被取走；
+ *       SPI主机的接收数据可在发送回调中逐字节注入（模拟从机在MISO上的应答），
+ *       SPI_ReceiveData与RINEIF直接读取队列，不等待到达时刻
+ */
+uint32_t Sim_Inject(void * Peripheral, const uint8_t * Data, uint32_t Length, uint32_t Gap_Us);
+
+/**
+ * @brief 推进仿真时钟
+ * @param Microseconds 推进的时间（微秒）
+ * @note 按1微秒步进依次处理定时器溢出、外设节拍与DMA搬运，
+ *       DMA/定时器中断条件满足时立即在调用者上下文中执行对应的中断服务函数，
+ *       因此调用者必须处于与中断等价的上下文（见main.c中的仿真时钟任务）
+ */
+void Sim_Advance(uint32_t Microseconds);
+
+/**
+ * @brief 读取仿真时钟
+ * @return 自复位以来的仿真时间（纳秒）
+ */
+uint64_t Sim_Now(void);
+
+/**
+ * @brief 读取DMA通道进入中断服务函数的次数
+ * @param DMAx DMA通道
+ * @return 自复位以来的中断次数
+ */
+uint32_t Sim_GetInterruptCount(DMA_TypeDef * DMAx);
+
+/**
+ * @brief 模拟CPU屏蔽中断（处于临界区）
+ * @param Masked 非0时屏蔽，此后DMA中断只置挂起位；0时解除屏蔽并执行挂起的中断
+ * @note 用于在临界区内推进仿真时钟，复现“中断在暂停DMA之前已挂起”的时序；
+ *       挂起位可由NVIC_ClearPendingIRQ清除
+ */
+void Sim_SetInterruptMask(uint8_t Masked);
+
+#endif // _SC_INIT_H_
@@ -0,0 +1,741 @@
+/**
+ * @file SC_Simulation.c
+ * @brief 主机仿真用的SC32F12xx外设模型
+ * @note 固件库函数与原库一样只读写寄存器，DMA_SoftwareTrigger与DMA_ClearFlag
+ *       额外模拟了STS寄存器的触发与写1清零行为。Sim_Advance按外设节拍推动DMA：
+ *       通道在CHEN置位、PAUSE清零、CNT非0且被软件触发后，每当请求源外设
+ *       能收发一个数据单元时搬运一次，CNT递减到一半/0时置HTIF/TCIF，
+ *       循环模式下CNT与地址自动重装，中断使能时立即执行DMAx_IRQHandler
+ */
+
+#include "SC_Init.h"
+#include <string.h>
+
+DMA_TypeDef  Sim_DMA[2];
+UART_TypeDef Sim_UART[2];
+SPI_TypeDef  Sim_SPI[2];
+TWI_TypeDef  Sim_TWI[1];
+TIM_TypeDef  Sim_TIM[4];
+GPIO_TypeDef Sim_GPIO[3];
+
+#define SIM_DMA_CHANNELS   2
+#define SIM_TIMERS         4
+#define SIM_PERIPHERALS    5     // UART0、UART1、SPI0、SPI1、TWI0
+#define SIM_RX_QUEUE       4096  // 每个外设接收队列长度
+#define SIM_APB0_HZ        64000000UL
+
+/**
+ * @struct Sim_Channel
+ * @brief DMA通道内部状态（寄存器之外的硬件锁存值）
+ */
+typedef struct
+{
+	uint8_t              Armed;                // 已被软件触发，等待外设请求
+	uint32_t             Reload;               // 触发时锁存的CNT，循环模式重装使用
+	uint32_t             Start_Source;         // 触发时锁存的源地址
+	uint32_t             Start_Target;         // 触发时锁存的目标地址
+	uint32_t             Source;               // 当前源地址
+	uint32_t             Target;               // 当前目标地址
+} Sim_Channel;
+
+/**
+ * @struct Sim_Peripheral
+ * @brief 外设节拍与接收队列
+ */
+typedef struct
+{
+	void *               Instance;             // 外设实例
+	__IO uint32_t *      Data;                 // 数据寄存器
+	__IO uint32_t *      IDE;                  // DMA使能所在寄存器
+	uint32_t             Unit_Ns;              // 每个数据单元的时间
+	uint64_t             TX_Ready;             // 最后一个发送数据单元发完的时刻
+	uint64_t             RX_Ready;             // 最后一个接收数据单元到达的时刻
+	uint8_t              RX_Queue[SIM_RX_QUEUE];
+	uint32_t             RX_Head;
+	uint32_t             RX_Tail;
+	uint32_t             RX_Gap[SIM_RX_QUEUE]; // 对应字节到达前额外等待的时间（微秒）
+} Sim_Peripheral;
+
+static Sim_Channel Sim_Channels[SIM_DMA_CHANNELS];
+static Sim_Peripheral Sim_Peripherals[SIM_PERIPHERALS];
+static uint64_t Sim_Timer_Next[SIM_TIMERS];       // 定时器下一次溢出的时刻（0表示未运行）
+static uint64_t Sim_Time;                         // 仿真时间（纳秒）
+static Sim_Transmit_Callback Sim_Transmit;
+static Sim_Pin_Callback Sim_Pin;
+static uint32_t Sim_Interrupts[SIM_DMA_CHANNELS];        // 各DMA通道进入中断的次数
+static uint8_t Sim_Masked;                                // 模拟CPU屏蔽中断（临界区）
+static uint8_t Sim_Pending[SIM_DMA_CHANNELS];             // 屏蔽期间挂起的DMA中断（NVIC挂起位）
+
+static void (* const Sim_DMA_IRQ[SIM_DMA_CHANNELS])(void) = {
+	DMA0_IRQHandler,
+	DMA1_IRQHandler,
+};
+
+static void (* const Sim_TIM_IRQ[SIM_TIMERS])(void) = {
+	TIMER0_IRQHandler,
+	TIMER1_IRQHandler,
+	TIMER2_IRQHandler,
+	TIMER3_IRQHandler,
+};
+
+/**
+ * @brief 由请求源查找外设（内部函数）
+ * @param Request DMA_CFG中的REQSRC字段
+ * @param Receive 输出是否为接收请求
+ * @return 外设，无对应外设返回NULL
+ */
+static Sim_Peripheral * Sim_Request_Peripheral(uint32_t Request, uint8_t * Receive)
+{
+	switch (Request)
+	{
+		case DMA_Request_UART0_TX: *Receive = 0; return &Sim_Peripherals[0];
+		case DMA_Request_UART0_RX: *Receive = 1; return &Sim_Peripherals[0];
+		case DMA_Request_UART1_TX: *Receive = 0; return &Sim_Peripherals[1];
+		case DMA_Request_UART1_RX: *Receive = 1; return &Sim_Peripherals[1];
+		case DMA_Request_SPI0_TX:  *Receive = 0; return &Sim_Peripherals[2];
+		case DMA_Request_SPI0_RX:  *Receive = 1; return &Sim_Peripherals[2];
+		case DMA_Request_SPI1_TX:  *Receive = 0; return &Sim_Peripherals[3];
+		case DMA_Request_SPI1_RX:  *Receive = 1; return &Sim_Peripherals[3];
+		case DMA_Request_TWI0_TX:  *Receive = 0; return &Sim_Peripherals[4];
+		case DMA_Request_TWI0_RX:  *Receive = 1; return &Sim_Peripherals[4];
+		default: return NULL;
+	}
+}
+
+/**
+ * @brief 由外设实例查找外设（内部函数）
+ */
+static Sim_Peripheral * Sim_Find_Peripheral(void * Instance)
+{
+	for (int i = 0; i < SIM_PERIPHERALS; i++)
+	{
+		if (Sim_Peripherals[i].Instance == Instance)
+		{
+			return &Sim_Peripherals[i];
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @brief 按32位总线地址访问主机内存（内部函数）
+ * @note 仿真程序以-no-pie链接，全局变量与FreeRTOS堆都位于低4GB地址
+ */
+static void * Sim_Address(uint32_t Address)
+{
+	return (void *)(uintptr_t)Address;
+}
+
+static uint32_t Sim_Read(uint32_t Address, uint32_t Width)
+{
+	uint32_t Value = 0;
+	memcpy(&Value, Sim_Address(Address), Width); // 小端主机，与Cortex-M0+一致
+	return Value;
+}
+
+static void Sim_Write(uint32_t Address, uint32_t Value, uint32_t Width)
+{
+	memcpy(Sim_Address(Address), &Value, Width);
+}
+
+/**
+ * @brief 按地址模式推进地址（内部函数）
+ */
+static uint32_t Sim_Step_Address(uint32_t Address, uint32_t Mode, uint32_t Width)
+{
+	if (Mode == 1 || Mode == 3) return Address + Width;
+	if (Mode == 2) return Address - Width;
+	return Address;
+}
+
+/**
+ * @brief 判断通道是否会响应外设请求（内部函数）
+ */
+static int Sim_Channel_Active(int Channel)
+{
+	DMA_TypeDef * DMAx = &Sim_DMA[Channel];
+	return Sim_Channels[Channel].Armed &&
+		(DMAx->DMA_CFG & DMA_CFG_CHEN) &&
+		!(DMAx->DMA_CFG & DMA_CFG_PAUSE) &&
+		(DMAx->DMA_CNT != 0);
+}
+
+/**
+ * @brief 把外设发出的数据交给发送回调（内部函数）
+ * @note 16位帧模式的SPI先发高字节
+ */
+static void Sim_Emit(void * Instance, uint32_t Data)
+{
+	if (Sim_Transmit == NULL)
+	{
+		return;
+	}
+	if ((Instance == SPI0 || Instance == SPI1) && (((SPI_TypeDef *)Instance)->SPI_CON & SPI_CON_SPMD))
+	{
+		Sim_Transmit(Instance, (Data >> 8) & 0xFF);
+		Sim_Transmit(Instance, Data & 0xFF);
+		return;
+	}
+	Sim_Transmit(Instance, Data);
+}
+
+/**
+ * @brief 一个数据单元的时间（内部函数）
+ * @note 16位帧模式的SPI占用两倍时间
+ */
+static uint32_t Sim_Unit_Ns(const Sim_Peripheral * Peripheral)
+{
+	void * Instance = Peripheral->Instance;
+	if ((Instance == SPI0 || Instance == SPI1) && (((SPI_TypeDef *)Instance)->SPI_CON & SPI_CON_SPMD))
+	{
+		return Peripheral->Unit_Ns * 2;
+	}
+	return Peripheral->Unit_Ns;
+}
+
+/**
+ * @brief 搬运一个数据单元，更新计数与标志，必要时进入中断（内部函数）
+ * @param Channel 通道号
+ * @param Peripheral 请求源外设
+ * @param Receive 是否为接收请求
+ */
+static void Sim_Channel_Transfer(int Channel, Sim_Peripheral * Peripheral, uint8_t Receive)
+{
+	DMA_TypeDef * DMAx = &Sim_DMA[Channel];
+	Sim_Channel * State = &Sim_Channels[Channel];
+	uint32_t CFG = DMAx->DMA_CFG;
+	uint32_t Width = 1U << ((CFG & DMA_CFG_TXWIDTH) >> DMA_CFG_TXWIDTH_Pos);
+	uint32_t Flags = 0;
+	// 接收：外设先把数据放入数据寄存器
+	if (Receive)
+	{
+		*Peripheral->Data = Peripheral->RX_Queue[Peripheral->RX_Tail];
+		Peripheral->RX_Tail = (Peripheral->RX_Tail + 1) % SIM_RX_QUEUE;
+	}
+	Sim_Write(State->Target, Sim_Read(State->Source, Width), Width);
+	// 发送：外设从数据寄存器取走数据
+	if (!Receive)
+	{
+		Sim_Emit(Peripheral->Instance, *Peripheral->Data);
+	}
+	State->Source = Sim_Step_Address(State->Source, (CFG & DMA_CFG_SAINC) >> DMA_CFG_SAINC_Pos, Width);
+	State->Target = Sim_Step_Address(State->Target, (CFG & DMA_CFG_DAINC) >> DMA_CFG_DAINC_Pos, Width);
+	DMAx->DMA_CNT--;
+	if (DMAx->DMA_CNT == (State->Reload >> 1))
+	{
+		Flags |= DMA_STS_HTIF;
+	}
+	if (DMAx->DMA_CNT == 0)
+	{
+		Flags |= DMA_STS_TCIF;
+		if (CFG & DMA_CFG_CIRC)
+		{
+			DMAx->DMA_CNT = State->Reload;
+			State->Source = State->Start_Source;
+			State->Target = State->Start_Target;
+		}
+		else
+		{
+			State->Armed = 0;
+		}
+	}
+	if (Flags == 0)
+	{
+		return;
+	}
+	DMAx->DMA_STS |= Flags;
+	// 中断：总使能且对应的中断源使能时置GIF并进入中断服务函数
+	if ((CFG & DMA_CFG_INTEN) &&
+		(((Flags & DMA_STS_TCIF) && (CFG & DMA_CFG_TCIE)) ||
+		 ((Flags & DMA_STS_HTIF) && (CFG & DMA_CFG_HTIE))))
+	{
+		DMAx->DMA_STS |= DMA_STS_GIF;
+		if (Sim_Masked)
+		{
+			Sim_Pending[Channel] = 1; // 与NVIC相同，清除外设标志不会撤销挂起位
+			return;
+		}
+		Sim_Interrupts[Channel]++;
+		Sim_DMA_IRQ[Channel]();
+	}
+}
+
+/**
+ * @brief 处理当前时刻所有通道的外设请求（内部函数）
+ */
+static void Sim_Service_Channels(void)
+{
+	for (int Channel = 0; Channel < SIM_DMA_CHANNELS; Channel++)
+	{
+		uint8_t Receive;
+		Sim_Peripheral * Peripheral = Sim_Request_Peripheral(Sim_DMA[Channel].DMA_CFG & DMA_CFG_REQSRC, &Receive);
+		if (Peripheral == NULL)
+		{
+			continue;
+		}
+		// 外设节拍允许时连续搬运（SPI等高速外设一微秒内可能有多个数据单元）
+		while (Sim_Channel_Active(Channel))
+		{
+			if (Receive)
+			{
+				// 队列中的下一个字节在上一个字节之后一个数据单元（加上注入时指定的间隔）到达
+				if (!(*Peripheral->IDE & UART_IDE_RXDMAEN) ||
+					(Peripheral->RX_Tail == Peripheral->RX_Head))
+				{
+					break;
+				}
+				uint64_t Arrive = Peripheral->RX_Ready +
+					(uint64_t)Peripheral->RX_Gap[Peripheral->RX_Tail] * 1000 + Peripheral->Unit_Ns;
+				if (Arrive > Sim_Time)
+				{
+					break;
+				}
+				Peripheral->RX_Gap[Peripheral->RX_Tail] = 0;
+				Peripheral->RX_Ready = Arrive;
+			}
+			else
+			{
+				// 上一个数据单元发完之前数据寄存器不接收新数据，线路空闲时从本步起点开始发送
+				if (!(*Peripheral->IDE & UART_IDE_TXDMAEN) || (Peripheral->TX_Ready >= Sim_Time))
+				{
+					break;
+				}
+				uint64_t Start = Sim_Time - 1000;
+				Peripheral->TX_Ready = ((Peripheral->TX_Ready > Start) ? Peripheral->TX_Ready : Start) + Sim_Unit_Ns(Peripheral);
+			}
+			Sim_Channel_Transfer(Channel, Peripheral, Receive);
+		}
+	}
+}
+
+/**
+ * @brief 处理当前时刻的定时器溢出（内部函数）
+ * @note 定时器从RLD向上计数到0xFFFF后溢出并重装
+ */
+static void Sim_Service_Timers(void)
+{
+	for (int i = 0; i < SIM_TIMERS; i++)
+	{
+		TIM_TypeDef * TIMx = &Sim_TIM[i];
+		if (!(TIMx->TIM_CON & TIM_CON_TR))
+		{
+			Sim_Timer_Next[i] = 0;
+			continue;
+		}
+		uint64_t Count_Ns = (1000000000ULL << ((TIMx->TIM_CON & TIM_CON_TIMCLK) >> TIM_CON_TIMCLK_Pos)) / SIM_APB0_HZ;
+		uint64_t Period_Ns = (0x10000UL - (TIMx->TIM_RLD & 0xFFFF)) * Count_Ns;
+		if (Sim_Timer_Next[i] == 0)
+		{
+			Sim_Timer_Next[i] = Sim_Time + Period_Ns;
+		}
+		while (Sim_Timer_Next[i] <= Sim_Time)
+		{
+			Sim_Timer_Next[i] += Period_Ns;
+			TIMx->TIM_STS |= TIM_Flag_TI;
+			if ((TIMx->TIM_IDE & TIM_IDE_INTEN) && (TIMx->TIM_IDE & TIM_IDE_TIE))
+			{
+				Sim_TIM_IRQ[i]();
+			}
+		}
+	}
+}
+
+void Sim_Reset(void)
+{
+	memset(Sim_DMA, 0, sizeof(Sim_DMA));
+	memset(Sim_UART, 0, sizeof(Sim_UART));
+	memset(Sim_SPI, 0, sizeof(Sim_SPI));
+	memset(Sim_GPIO, 0, sizeof(Sim_GPIO));
+	memset(Sim_TWI, 0, sizeof(Sim_TWI));
+	memset(Sim_TIM, 0, sizeof(Sim_TIM));
+	memset(Sim_Channels, 0, sizeof(Sim_Channels));
+	memset(Sim_Peripherals, 0, sizeof(Sim_Peripherals));
+	memset(Sim_Timer_Next, 0, sizeof(Sim_Timer_Next));
+	memset(Sim_Interrupts, 0, sizeof(Sim_Interrupts));
+	memset(Sim_Pending, 0, sizeof(Sim_Pending));
+	Sim_Masked = 0;
+	Sim_Time = 0;
+	Sim_Transmit = NULL;
+	Sim_Pin = NULL;
+	Sim_Peripherals[0] = (Sim_Peripheral){ .Instance = UART0, .Data = &UART0->UART_DATA, .IDE = &UART0->UART_IDE, .Unit_Ns = 86806 };
+	Sim_Peripherals[1] = (Sim_Peripheral){ .Instance = UART1, .Data = &UART1->UART_DATA, .IDE = &UART1->UART_IDE, .Unit_Ns = 86806 };
+	Sim_Peripherals[2] = (Sim_Peripheral){ .Instance = SPI0, .Data = &SPI0->SPI_DATA, .IDE = &SPI0->SPI_IDE, .Unit_Ns = 500 };
+	Sim_Peripherals[3] = (Sim_Peripheral){ .Instance = SPI1, .Data = &SPI1->SPI_DATA, .IDE = &SPI1->SPI_IDE, .Unit_Ns = 500 };
+	Sim_Peripherals[4] = (Sim_Peripheral){ .Instance = TWI0, .Data = &TWI0->TWI_DATA, .IDE = &TWI0->TWI_IDE, .Unit_Ns = 22500 };
+}
+
+void Sim_SetUnitTime(void * Peripheral, uint32_t Unit_Ns)
+{
+	Sim_Peripheral * Target = Sim_Find_Peripheral(Peripheral);
+	if (Target != NULL && Unit_Ns != 0)
+	{
+		Target->Unit_Ns = Unit_Ns;
+	}
+}
+
+void Sim_SetTransmitCallback(Sim_Transmit_Callback Callback)
+{
+	Sim_Transmit = Callback;
+}
+
+void Sim_SetPinCallback(Sim_Pin_Callback Callback)
+{
+	Sim_Pin = Callback;
+}
+
+uint32_t Sim_Inject(void * Peripheral, const uint8_t * Data, uint32_t Length, uint32_t Gap_Us)
+{
+	Sim_Peripheral * Target = Sim_Find_Peripheral(Peripheral);
+	uint32_t Count = 0;
+	if (Target == NULL)
+	{
+		return 0;
+	}
+	if ((Target->RX_Tail == Target->RX_Head) && (Target->RX_Ready < Sim_Time))
+	{
+		Target->RX_Ready = Sim_Time; // 队列为空时从当前时刻开始计时
+	}
+	while (Count < Length && ((Target->RX_Head + 1) % SIM_RX_QUEUE) != Target->RX_Tail)
+	{
+		Target->RX_Queue[Target->RX_Head] = Data[Count];
+		Target->RX_Gap[Target->RX_Head] = (Count == 0) ? Gap_Us : 0;
+		Target->RX_Head = (Target->RX_Head + 1) % SIM_RX_QUEUE;
+		Count++;
+	}
+	return Count;
+}
+
+void Sim_Advance(uint32_t Microseconds)
+{
+	while (Microseconds--)
+	{
+		Sim_Time += 1000;
+		Sim_Service_Timers();
+		Sim_Service_Channels();
+	}
+}
+
+uint64_t Sim_Now(void)
+{
+	return Sim_Time;
+}
+
+uint32_t Sim_GetInterruptCount(DMA_TypeDef * DMAx)
+{
+	return Sim_Interrupts[DMAx - Sim_DMA];
+}
+
+void Sim_SetInterruptMask(uint8_t Masked)
+{
+	Sim_Masked = Masked;
+	for (int i = 0; !Masked && i < SIM_DMA_CHANNELS; i++)
+	{
+		if (Sim_Pending[i])
+		{
+			Sim_Pending[i] = 0;
+			Sim_Interrupts[i]++;
+			Sim_DMA_IRQ[i]();
+		}
+	}
+}
+
+/* DMA固件库 ----------------------------------------------------------------*/
+
+void DMA_Init(DMA_TypeDef* DMAx, DMA_InitTypeDef* DMA_InitStruct)
+{
+	uint32_t tmpreg = DMAx->DMA_CFG;
+	tmpreg &= ~(DMA_CFG_PL | DMA_CFG_TXWIDTH | DMA_CFG_CIRC | DMA_CFG_CHRST | DMA_CFG_CHEN |
+		DMA_CFG_DAINC | DMA_CFG_SAINC | DMA_CFG_BURSIZE | DMA_CFG_TPTYPE | DMA_CFG_REQSRC);
+	tmpreg |= (uint32_t)(DMA_InitStruct->DMA_Priority | DMA_InitStruct->DMA_CircularMode |
+		DMA_InitStruct->DMA_DataSize | DMA_InitStruct->DMA_TargetMode |
+		DMA_InitStruct->DMA_SourceMode | DMA_InitStruct->DMA_Burst | DMA_InitStruct->DMA_Request);
+	DMAx->DMA_CFG = tmpreg;
+	DMAx->DMA_SADR = DMA_InitStruct->DMA_SrcAddress;
+	DMAx->DMA_DADR = DMA_InitStruct->DMA_DstAddress;
+	DMAx->DMA_CNT = DMA_InitStruct->DMA_BufferSize;
+	Sim_Channels[DMAx - Sim_DMA].Armed = 0;
+}
+
+void DMA_StructInit(DMA_InitTypeDef* DMA_InitStruct)
+{
+	DMA_InitStruct->DMA_Priority = DMA_Priority_LOW;
+	DMA_InitStruct->DMA_CircularMode = DMA_CircularMode_Disable;
+	DMA_InitStruct->DMA_DataSize = DMA_DataSize_Byte;
+	DMA_InitStruct->DMA_TargetMode = DMA_TargetMode_FIXED;
+	DMA_InitStruct->DMA_SourceMode = DMA_SourceMode_FIXED;
+	DMA_InitStruct->DMA_Burst = DMA_Burst_Disable;
+	DMA_InitStruct->DMA_Request = DMA_Request_Null;
+}
+
+void DMA_Cmd(DMA_TypeDef* DMAx, FunctionalState NewState)
+{
+	if (NewState != DISABLE) DMAx->DMA_CFG |= DMA_CFG_CHEN;
+	else DMAx->DMA_CFG &= ~DMA_CFG_CHEN;
+}
+
+void DMA_PauseCmd(DMA_TypeDef* DMAx, FunctionalState NewState)
+{
+	if (NewState != DISABLE) DMAx->DMA_CFG |= DMA_CFG_PAUSE;
+	else DMAx->DMA_CFG = (DMAx->DMA_CFG | DMA_CFG_CHEN) & ~DMA_CFG_PAUSE;
+}
+
+void DMA_ChannelReset(DMA_TypeDef* DMAx)
+{
+	Sim_Channels[DMAx - Sim_DMA].Armed = 0;
+	DMAx->DMA_CNT = 0;
+	DMAx->DMA_STS = 0;
+}
+
+void DMA_SetSrcAddress(DMA_TypeDef* DMAx, uint32_t SrcAddress)
+{
+	DMAx->DMA_SADR = SrcAddress;
+}
+
+void DMA_SetDstAddress(DMA_TypeDef* DMAx, uint32_t DstAddress)
+{
+	DMAx->DMA_DADR = DstAddress;
+}
+
+void DMA_SetCurrDataCounter(DMA_TypeDef* DMAx, uint32_t Counter)
+{
+	DMAx->DMA_CNT = Counter;
+}
+
+uint32_t DMA_GetCurrDataCounter(DMA_TypeDef* DMAx)
+{
+	return DMAx->DMA_CNT;
+}
+
+void DMA_SoftwareTrigger(DMA_TypeDef* DMAx)
+{
+	Sim_Channel * State = &Sim_Channels[DMAx - Sim_DMA];
+	// 触发时锁存地址与计数，之后的搬运只改变内部地址与CNT
+	State->Armed = 1;
+	State->Reload = DMAx->DMA_CNT;
+	State->Start_Source = State->Source = DMAx->DMA_SADR;
+	State->Start_Target = State->Target = DMAx->DMA_DADR;
+}
+
+void DMA_ITConfig(DMA_TypeDef* DMAx, uint32_t DMA_IT, FunctionalState NewState)
+{
+	if (NewState != DISABLE) DMAx->DMA_CFG |= DMA_IT;
+	else DMAx->DMA_CFG &= ~DMA_IT;
+}
+
+FlagStatus DMA_GetFlagStatus(DMA_TypeDef* DMAx, DMA_Flag_TypeDef DMA_FLAG)
+{
+	return (DMAx->DMA_STS & DMA_FLAG) ? SET : RESET;
+}
+
+void DMA_ClearFlag(DMA_TypeDef* DMAx, uint32_t DMA_FLAG)
+{
+	DMAx->DMA_STS &= ~DMA_FLAG; // 写1清零
+}
+
+void DMA_DMACmd(DMA_TypeDef* DMAx, uint32_t DMA_DMARequest, FunctionalState NewState)
+{
+	if (NewState != DISABLE) DMAx->DMA_CFG |= DMA_DMARequest;
+	else DMAx->DMA_CFG &= ~DMA_DMARequest;
+}
+
+/* UART/SPI/TWI固件库 -------------------------------------------------------*/
+
+void UART_RXCmd(UART_TypeDef* UARTx, FunctionalState NewState)
+{
+	if (NewState != DISABLE) UARTx->UART_CON |= UART_CON_RXEN;
+	else UARTx->UART_CON &= ~UART_CON_RXEN;
+}
+
+void UART_SendData(UART_TypeDef* UARTx, uint16_t Data)
+{
+	UARTx->UART_DATA = Data;
+	if (Sim_Transmit != NULL)
+	{
+		Sim_Transmit(UARTx, Data);
+	}
+}
+
+void UART_DMACmd(UART_TypeDef* UARTx, uint16_t UART_DMAReq, FunctionalState NewState)
+{
+	if (NewState != DISABLE) UARTx->UART_IDE |= UART_DMAReq;
+	else UARTx->UART_IDE &= ~(uint32_t)UART_DMAReq;
+}
+
+void SPI_Cmd(SPI_TypeDef* SPIx, FunctionalState NewState)
+{
+	if (NewState != DISABLE) SPIx->SPI_CON |= SPI_CON_SPEN;
+	else SPIx->SPI_CON &= ~SPI_CON_SPEN;
+}
+
+void SPI_SendData(SPI_TypeDef* SPIx, uint16_t Data)
+{
+	Sim_Peripheral * Peripheral = Sim_Find_Peripheral(SPIx);
+	SPIx->SPI_DATA = Data;
+	SPIx->SPI_STS |= SPI_STS_SPIF;
+	// 数据单元排在线路上正在发送的数据之后
+	Peripheral->TX_Ready = ((Peripheral->TX_Ready > Sim_Time) ? Peripheral->TX_Ready : Sim_Time) + Sim_Unit_Ns(Peripheral);
+	Sim_Emit(SPIx, Data);
+}
+
+void SPI_DataSizeConfig(SPI_TypeDef* SPIx, SPI_DataSize_TypeDef SPI_DataSize)
+{
+	SPIx->SPI_CON &= (uint16_t)~SPI_CON_SPMD;
+	SPIx->SPI_CON |= SPI_DataSize;
+}
+
+FlagStatus SPI_GetFlagStatus(SPI_TypeDef* SPIx, SPI_FLAG_TypeDef SPI_FLAG)
+{
+	// 发送缓冲区只有一级：线路上最多剩一个数据单元（在移位寄存器中）时TXEIF置位
+	if (SPI_FLAG == SPI_Flag_TXEIF)
+	{
+		Sim_Peripheral * Peripheral = Sim_Find_Peripheral(SPIx);
+		return (Peripheral->TX_Ready <= Sim_Time + Sim_Unit_Ns(Peripheral)) ? SET : RESET;
+	}
+	// 接收：注入队列中还有未取走的数据
+	if (SPI_FLAG == SPI_Flag_RINEIF)
+	{
+		Sim_Peripheral * Peripheral = Sim_Find_Peripheral(SPIx);
+		return (Peripheral->RX_Tail != Peripheral->RX_Head) ? SET : RESET;
+	}
+	return (SPIx->SPI_STS & SPI_FLAG) ? SET : RESET;
+}
+
+uint16_t SPI_ReceiveData(SPI_TypeDef* SPIx)
+{
+	Sim_Peripheral * Peripheral = Sim_Find_Peripheral(SPIx);
+	if (Peripheral->RX_Tail != Peripheral->RX_Head)
+	{
+		SPIx->SPI_DATA = Peripheral->RX_Queue[Peripheral->RX_Tail];
+		Peripheral->RX_Gap[Peripheral->RX_Tail] = 0;
+		Peripheral->RX_Tail = (Peripheral->RX_Tail + 1) % SIM_RX_QUEUE;
+	}
+	return (uint16_t)SPIx->SPI_DATA;
+}
+
+void SPI_ClearFlag(SPI_TypeDef* SPIx, uint32_t SPI_FLAG)
+{
+	SPIx->SPI_STS &= ~SPI_FLAG;
+}
+
+void SPI_DMACmd(SPI_TypeDef* SPIx, uint16_t SPI_DMAReq, FunctionalState NewState)
+{
+	if (NewState != DISABLE) SPIx->SPI_IDE |= SPI_DMAReq;
+	else SPIx->SPI_IDE &= ~(uint32_t)SPI_DMAReq;
+}
+
+void TWI_DMACmd(TWI_TypeDef* TWIx, TWI_DMAReq_TypeDef TWI_DMAReq, FunctionalState NewState)
+{
+	if (NewState != DISABLE) TWIx->TWI_IDE |= TWI_DMAReq;
+	else TWIx->TWI_IDE &= ~(uint32_t)TWI_DMAReq;
+}
+
+/* GPIO固件库（PIN寄存器保存输出电平） ----------------------------------------*/
+
+void GPIO_Init(GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_InitStruct)
+{
+	if (GPIO_InitStruct->GPIO_Mode == GPIO_Mode_OUT_PP) GPIOx->PXCON |= GPIO_InitStruct->GPIO_Pin;
+	else GPIOx->PXCON &= ~(uint32_t)GPIO_InitStruct->GPIO_Pin;
+	if (GPIO_InitStruct->GPIO_Mode == GPIO_Mode_IN_PU) GPIOx->PXPH |= GPIO_InitStruct->GPIO_Pin;
+	else GPIOx->PXPH &= ~(uint32_t)GPIO_InitStruct->GPIO_Pin;
+}
+
+uint16_t GPIO_ReadData(GPIO_TypeDef* GPIOx)
+{
+	return (uint16_t)GPIOx->PIN;
+}
+
+BitAction GPIO_ReadDataBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+	return (GPIOx->PIN & GPIO_Pin) ? Bit_SET : Bit_RESET;
+}
+
+/**
+ * @brief 写PIN寄存器并通知电平变化（内部函数）
+ */
+static void Sim_Write_Pins(GPIO_TypeDef* GPIOx, uint32_t Value)
+{
+	uint32_t Previous = GPIOx->PIN;
+	GPIOx->PIN = Value;
+	if (Sim_Pin != NULL && Previous != Value)
+	{
+		Sim_Pin(GPIOx, Previous, Value);
+	}
+}
+
+void GPIO_SetBits(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+	Sim_Write_Pins(GPIOx, GPIOx->PIN | GPIO_Pin);
+}
+
+void GPIO_ResetBits(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+	Sim_Write_Pins(GPIOx, GPIOx->PIN & ~(uint32_t)GPIO_Pin);
+}
+
+void GPIO_Write(GPIO_TypeDef* GPIOx, uint16_t PortVal)
+{
+	Sim_Write_Pins(GPIOx, PortVal);
+}
+
+void GPIO_WriteBit(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, BitAction BitVal)
+{
+	Sim_Write_Pins(GPIOx, (BitVal != Bit_RESET) ? (GPIOx->PIN | GPIO_Pin) : (GPIOx->PIN & ~(uint32_t)GPIO_Pin));
+}
+
+void GPIO_TogglePins(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin)
+{
+	Sim_Write_Pins(GPIOx, GPIOx->PIN ^ GPIO_Pin);
+}
+
+/* TIM固件库 ----------------------------------------------------------------*/
+
+void TIM_TIMBaseInit(TIM_TypeDef* TIMx, TIM_TimeBaseInitTypeDef* TIM_TimeBaseInitStruct)
+{
+	TIMx->TIM_CON = (TIMx->TIM_CON & ~(TIM_CON_TIMCLK | TIM_CON_CTSEL | TIM_CON_DEC)) |
+		TIM_TimeBaseInitStruct->TIM_Prescaler | TIM_TimeBaseInitStruct->TIM_WorkMode |
+		TIM_TimeBaseInitStruct->TIM_CounterMode;
+	TIMx->TIM_RLD = TIM_TimeBaseInitStruct->TIM_Preload;
+	TIMx->TIM_CNT = TIM_TimeBaseInitStruct->TIM_Preload;
+}
+
+void TIM_TimeBaseStructInit(TIM_TimeBaseInitTypeDef* TIM_TimeBaseInitStruct)
+{
+	TIM_TimeBaseInitStruct->TIM_Prescaler = TIM_PRESCALER_1;
+	TIM_TimeBaseInitStruct->TIM_WorkMode = TIM_WorkMode_Timer;
+	TIM_TimeBaseInitStruct->TIM_CounterMode = TIM_CounterMode_Up;
+	TIM_TimeBaseInitStruct->TIM_EXENX = 0;
+	TIM_TimeBaseInitStruct->TIM_Preload = 0;
+}
+
+void TIM_Cmd(TIM_TypeDef* TIMx, FunctionalState NewState)
+{
+	if (NewState != DISABLE) TIMx->TIM_CON |= TIM_CON_TR;
+	else TIMx->TIM_CON &= ~TIM_CON_TR;
+}
+
+void TIM_ITConfig(TIM_TypeDef* TIMx, uint16_t TIM_IT, FunctionalState NewState)
+{
+	if (NewState != DISABLE) TIMx->TIM_IDE |= TIM_IT;
+	else TIMx->TIM_IDE &= ~(uint32_t)TIM_IT;
+}
+
+void TIM_ClearFlag(TIM_TypeDef* TIMx, uint16_t TIM_FLAG)
+{
+	TIMx->TIM_STS &= ~(uint32_t)TIM_FLAG;
+}
+
+/* RCC/NVIC -----------------------------------------------------------------*/
+
+void RCC_AHBPeriphClockCmd(uint32_t RCC_AHBPeriph, FunctionalState NewState) {}
+void RCC_APB0PeriphClockCmd(uint32_t RCC_APB0Periph, FunctionalState NewState) {}
+void NVIC_SetPriority(IRQn_Type IRQn, uint32_t priority) {}
+void NVIC_EnableIRQ(IRQn_Type IRQn) {}
+void NVIC_DisableIRQ(IRQn_Type IRQn) {}
+
+void NVIC_ClearPendingIRQ(IRQn_Type IRQn)
+{
+	if (IRQn == DMA0_IRQn || IRQn == DMA1_IRQn)
+	{
+		Sim_Pending[IRQn - DMA0_IRQn] = 0;
+	}
+}
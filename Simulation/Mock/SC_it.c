@@ -0,0 +1,46 @@
+/**
+ * @file SC_it.c
+ * @brief 主机仿真用的中断服务函数，内容与User/SC_it.c保持一致
+ */
+
+#include "SC_Init.h"
+#include "DMA-Buffer-Manager.h"
+#include "DMA-Receive-Manager.h"
+#include "SPI_Dynamic_Buffer.h"
+
+void DMA0_IRQHandler(void)
+{
+	DMA_ClearFlag(DMA0, DMA_FLAG_GIF|DMA_FLAG_TCIF|DMA_FLAG_HTIF|DMA_FLAG_TEIF);
+	DMA_Buffer_Manager_Dispatch(DMA0);
+	DMA_Receive_Manager_Dispatch(DMA0);
+	SPI_ChunkBuffer_RxDispatch(&spi0, DMA0);
+}
+
+void DMA1_IRQHandler(void)
+{
+	DMA_ClearFlag(DMA1, DMA_FLAG_GIF|DMA_FLAG_TCIF|DMA_FLAG_HTIF|DMA_FLAG_TEIF);
+	DMA_Buffer_Manager_Dispatch(DMA1);
+	DMA_Receive_Manager_Dispatch(DMA1);
+	SPI_ChunkBuffer_IRQHandler(&spi0);
+}
+
+void TIMER0_IRQHandler(void)
+{
+	TIM_ClearFlag(TIM0, TIM_Flag_TI);
+	DMA_Receive_Manager_Poll();
+}
+
+void TIMER1_IRQHandler(void)
+{
+	TIM_ClearFlag(TIM1, TIM_Flag_TI);
+}
+
+void TIMER2_IRQHandler(void)
+{
+	TIM_ClearFlag(TIM2, TIM_Flag_TI);
+}
+
+void TIMER3_IRQHandler(void)
+{
+	TIM_ClearFlag(TIM3, TIM_Flag_TI);
+}
@@ -0,0 +1,11 @@
+/**
+ * @file sc32f1xxx_dma.h
+ * @brief 主机仿真：DMA固件库声明统一由仿真用的SC_Init.h提供
+ */
+
+#ifndef __sc32f1xxx_DMA_H
+#define __sc32f1xxx_DMA_H
+
+#include "SC_Init.h"
+
+#endif // __sc32f1xxx_DMA_H
@@ -0,0 +1,2237 @@
+/**
+ * @file main.c
+ * @brief 主机仿真测试程序
+ * @note 用法：nbk2002_sim <场景> [随机种子]
+ *         buffer    DMA_Buffer_Manager环绕/策略/流式模式随机测试
+ *         terminal  Terminal_Output格式化结果与主机snprintf对比，并发输出整行不穿插
+ *         receive   DMA_Receive_Manager按空闲切帧
+ *         spi       SPI_Dynamic_Buffer多字节DMA发送、大块分段续传与描述符队列
+ *         st7789    ST7789驱动、双缓冲渲染器、文字绘制、图块合成与曲线图：屏幕模型解析命令与显存写入，与参考画面对比
+ *         flash     SPI NOR Flash驱动：Flash模型按片选解析命令，检查读写擦除、忙状态与页缓存
+ *         bench     主机侧调用开销与仿真UART链路利用率
+ *       每个场景在独立进程中运行（make check依次运行全部场景），
+ *       因为DMA通道与管理器的绑定在进程内不可撤销。通过返回0，失败返回1
+ *
+ *       仿真时钟任务以最高优先级运行，每个系统节拍推进1ms仿真时间，
+ *       DMA/定时器中断服务函数在该任务中执行：它不会打断其他任务的临界区，
+ *       其他任务也不会打断它，与目标板上中断的互斥关系一致
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "DMA-Buffer-Manager.h"
+#include "DMA-Receive-Manager.h"
+#include "SPI_Dynamic_Buffer.h"
+#include "Terminal.h"
+#include "ST7789.h"
+#include "Renderer.h"
+#include "SPI_Flash.h"
+#include "Font.h"
+#include "Console.h"
+#include "Image.h"
+#include "Blit.h"
+#include "Chart.h"
+
+#define SIM_CLOCK_PRIORITY    (configMAX_PRIORITIES - 1)
+#define SIM_TEST_PRIORITY     (configMAX_PRIORITIES - 3)
+#define SIM_CAPTURE_LENGTH    (1u << 20)
+#define SIM_UART_FAST_NS      10851   // 921600波特率，10位/字节
+
+typedef int (*Sim_Scenario)(void);
+
+static DMA_Buffer_Manager Manager;
+static uint32_t Seed = 1;
+
+/**
+ * 外设发出的数据（在仿真时钟任务中写入，测试任务在停止发送后读取）
+ */
+static uint8_t Capture[SIM_CAPTURE_LENGTH];
+static volatile uint32_t Capture_Length;
+static void * Capture_Peripheral;
+
+/* 通用工具 -----------------------------------------------------------------*/
+
+void vAssertCalled(const char * pcFile, unsigned long ulLine) {
+    taskDISABLE_INTERRUPTS();
+    fprintf(stderr, "ASSERT %s:%lu (seed %u)\n", pcFile, ulLine, Seed);
+    exit(1);
+}
+
+/**
+ * 打印时屏蔽调度，避免多个任务的输出在stdio缓冲区中交错
+ */
+static void Sim_Print(const char *format, ...) {
+    va_list ap;
+    va_start(ap, format);
+    taskENTER_CRITICAL();
+    vprintf(format, ap);
+    fflush(stdout);
+    taskEXIT_CRITICAL();
+    va_end(ap);
+}
+
+/**
+ * 线性同余随机数，每个任务使用自己的状态，结果可由种子复现
+ */
+static uint32_t Sim_Random(uint32_t *state, uint32_t range) {
+    *state = *state * 1664525u + 1013904223u;
+    return (range == 0) ? 0 : ((*state >> 8) % range);
+}
+
+static void Sim_Capture(void * Peripheral, uint32_t Data) {
+    if (Peripheral == Capture_Peripheral && Capture_Length < SIM_CAPTURE_LENGTH) {
+        Capture[Capture_Length++] = (uint8_t)Data;
+    }
+}
+
+static void Sim_Capture_Reset(void * Peripheral) {
+    taskENTER_CRITICAL();
+    Capture_Peripheral = Peripheral;
+    Capture_Length = 0;
+    taskEXIT_CRITICAL();
+}
+
+static uint64_t Sim_Host_Ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+}
+
+/**
+ * 等待管理器把已提交的数据全部发出
+ * @param timeout 最长等待时间（tick）
+ * @return 发送完毕返回1，超时返回0
+ */
+static int Sim_Drain(DMA_Buffer_Manager * const manager, TickType_t timeout) {
+    while (timeout--) {
+        taskENTER_CRITICAL();
+        int idle = (manager->_Writers == 0) && (manager->_Commit == manager->_Tail) &&
+                   (manager->_Transmitting_Length == 0);
+        taskEXIT_CRITICAL();
+        if (idle) {
+            return 1;
+        }
+        vTaskDelay(1);
+    }
+    return 0;
+}
+
+/**
+ * 仿真时钟任务：推进外设模型并在本任务中执行中断服务函数
+ */
+static void vTask_Simulation_Clock(void *pvParameters) {
+    TickType_t last = xTaskGetTickCount();
+    for (;;) {
+        vTaskDelayUntil(&last, 1);
+        Sim_Advance(1000000 / configTICK_RATE_HZ);
+    }
+}
+
+/* buffer场景 ---------------------------------------------------------------*/
+
+#define BUFFER_PRODUCERS   3
+#define BUFFER_RECORDS     150
+#define BUFFER_RECORD_MAX  80
+
+/**
+ * 记录格式：0x00 | 生产者号+1 | 序号低7位+1 | 序号高7位+1 | 长度+1 | 载荷
+ * 除起始的0x00外所有字节非0，截断或被丢弃的记录不影响后续记录的解析
+ */
+static uint8_t Buffer_Payload(uint32_t id, uint32_t seq, uint32_t k) {
+    return (uint8_t)(((id * 37u + seq * 11u + k * 3u) % 255u) + 1u);
+}
+
+static uint32_t Buffer_Record(uint8_t *out, uint32_t id, uint32_t seq, uint32_t payload) {
+    out[0] = 0x00;
+    out[1] = (uint8_t)(id + 1);
+    out[2] = (uint8_t)((seq & 0x7F) + 1);
+    out[3] = (uint8_t)(((seq >> 7) & 0x7F) + 1);
+    out[4] = (uint8_t)(payload + 1);
+    for (uint32_t k = 0; k < payload; k++) {
+        out[5 + k] = Buffer_Payload(id, seq, k);
+    }
+    return payload + 5;
+}
+
+typedef struct {
+    uint32_t id;
+    uint32_t requested;                 // 请求写入的字节数
+    uint32_t accepted;                  // 实际写入的字节数
+    uint32_t atomic_only;               // 只使用整体预留（不会产生截断的记录）
+    uint32_t payload_max;               // 载荷最大长度（阻塞策略下记录不超过缓冲区容量）
+    TaskHandle_t parent;
+} Buffer_Producer;
+
+static void vTask_Buffer_Producer(void *pvParameters) {
+    Buffer_Producer *producer = (Buffer_Producer *)pvParameters;
+    uint32_t state = Seed * 2654435761u + producer->id;
+    uint8_t record[BUFFER_RECORD_MAX + 5];
+
+    for (uint32_t seq = 0; seq < BUFFER_RECORDS; seq++) {
+        uint32_t length = Buffer_Record(record, producer->id, seq, Sim_Random(&state, producer->payload_max + 1));
+        uint32_t mode = producer->atomic_only ? 2 : Sim_Random(&state, 3);
+        DMA_Buffer_Span span;
+        uint16_t got;
+
+        if (mode == 0) {
+            got = DMA_Buffer_Manager_Input(&Manager, record, (uint16_t)length);
+        } else {
+            // 预留后分两次拷贝，中间让出CPU，扩大其他生产者与DMA穿插的窗口
+            got = (mode == 1) ? DMA_Buffer_Manager_Reserve(&Manager, (uint16_t)length, &span)
+                              : DMA_Buffer_Manager_ReserveRecord(&Manager, (uint16_t)length, &span);
+            if (got != 0) {
+                memcpy(span.Pointer[0], record, span.Length[0]);
+                if (Sim_Random(&state, 4) == 0) {
+                    vTaskDelay(Sim_Random(&state, 3));
+                }
+                memcpy(span.Pointer[1], &record[span.Length[0]], span.Length[1]);
+                DMA_Buffer_Manager_Commit(&Manager);
+            }
+        }
+        producer->requested += length;
+        producer->accepted += got;
+
+        switch (Sim_Random(&state, 8)) {
+            case 0: vTaskDelay(Sim_Random(&state, 4)); break;
+            case 1: taskYIELD(); break;
+            default: break; // 连续写入，制造缓冲区满
+        }
+    }
+    xTaskNotifyGive(producer->parent);
+    vTaskSuspend(NULL);
+}
+
+/**
+ * 校验捕获的数据流
+ * @param complete 非0时要求所有记录完整且无丢失
+ * @return 错误数
+ */
+static int Buffer_Verify(int complete, uint32_t *records) {
+    int32_t last_seq[BUFFER_PRODUCERS];
+    int errors = 0;
+    uint32_t i = 0;
+
+    for (int p = 0; p < BUFFER_PRODUCERS; p++) last_seq[p] = -1;
+    *records = 0;
+    while (i < Capture_Length) {
+        if (Capture[i] != 0x00) {
+            errors++; // 起始位置不是记录头
+            while (i < Capture_Length && Capture[i] != 0x00) i++;
+            continue;
+        }
+        uint32_t end = i + 1;
+        while (end < Capture_Length && Capture[end] != 0x00) end++;
+        uint32_t chunk = end - i;
+        if (chunk < 5) {
+            if (complete) errors++; // 截断在记录头中
+            i = end;
+            continue;
+        }
+        uint32_t id = Capture[i + 1] - 1u;
+        uint32_t seq = (Capture[i + 2] - 1u) | ((Capture[i + 3] - 1u) << 7);
+        uint32_t payload = Capture[i + 4] - 1u;
+        if (id >= BUFFER_PRODUCERS || seq >= BUFFER_RECORDS || chunk > payload + 5 ||
+            (complete && chunk != payload + 5) || (int32_t)seq <= last_seq[id]) {
+            errors++;
+        } else {
+            for (uint32_t k = 0; k + 5 < chunk; k++) {
+                if (Capture[i + 5 + k] != Buffer_Payload(id, seq, k)) {
+                    errors++;
+                    break;
+                }
+            }
+            if (complete && (int32_t)seq != last_seq[id] + 1) {
+                errors++; // 阻塞策略下不应丢失记录
+            }
+            last_seq[id] = (int32_t)seq;
+        }
+        (*records)++;
+        i = end;
+    }
+    if (complete) {
+        for (int p = 0; p < BUFFER_PRODUCERS; p++) {
+            if (last_seq[p] != BUFFER_RECORDS - 1) errors++;
+        }
+    }
+    return errors;
+}
+
+/**
+ * 临界区内DMA先到达段尾（或循环模式的半区边界），中断挂起未执行，随后在同一临界区内
+ * 由Reclaim（streaming为0）或关闭流式发送（streaming为1）暂停DMA并启动新的一段；
+ * 挂起的中断不能再按新一段的长度推进尾指针（新一段的数据必须完整发出）
+ */
+static int Buffer_Pending_Check(int streaming) {
+    static uint8_t data[140];
+    uint32_t first = streaming ? 63 : 20, second = streaming ? 0 : 60;
+    int circular = 0;
+    for (uint32_t k = 0; k < sizeof(data); k++) {
+        data[k] = (uint8_t)(k * 7 + 1);
+    }
+
+    DMA_Buffer_Manager_Initialize(&Manager, 64, DMA0, UART1, DMA_UART);
+    DMA_Buffer_Manager_SetPolicy(&Manager, streaming ? DMA_DROP_NEWEST : DMA_OVERWRITE_OLDEST, 0);
+    DMA_Buffer_Manager_SetStreaming(&Manager, streaming ? ENABLE : DISABLE);
+    Sim_Capture_Reset(UART1);
+    vTaskSuspendAll(); // 仿真时钟任务不能在此期间运行
+    DMA_Buffer_Manager_Input(&Manager, data, (uint16_t)first);
+    Sim_SetInterruptMask(1);
+    if (streaming) {
+        // 除保留字节外缓冲区已写满，以循环模式启动；停在半区边界，HT挂起
+        circular = Manager._Circular;
+        while (DMA_GetCurrDataCounter(DMA0) != 32) {
+            Sim_Advance(1);
+        }
+        DMA_Buffer_Manager_SetStreaming(&Manager, DISABLE);
+    } else {
+        while (DMA_GetCurrDataCounter(DMA0) != 0) {
+            Sim_Advance(1);
+        }
+        // 缓冲区看起来仍有20字节未发送，60字节需要Reclaim
+        DMA_Buffer_Manager_Input(&Manager, &data[first], (uint16_t)second);
+    }
+    Sim_SetInterruptMask(0);
+    xTaskResumeAll();
+    // 尾指针被多推进时这里立即返回，下一次写入会覆盖DMA仍在读取的区域
+    int drained = Sim_Drain(&Manager, 5000);
+    for (uint32_t at = first + second; at < sizeof(data); at += 60) {
+        uint32_t length = (sizeof(data) - at < 60) ? sizeof(data) - at : 60;
+        DMA_Buffer_Manager_Input(&Manager, &data[at], (uint16_t)length);
+        drained &= Sim_Drain(&Manager, 5000);
+    }
+
+    DMA_Buffer_Statistics statistics;
+    DMA_Buffer_Manager_GetStatistics(&Manager, &statistics, 1);
+    int errors = !drained || (Capture_Length != sizeof(data)) || memcmp(Capture, data, sizeof(data)) != 0 ||
+                 (statistics.Overwritten_Bytes != 0) || (statistics.Dropped_Bytes != 0) || (streaming && !circular);
+    Sim_Print("buffer pending interrupt across %s sent %u of %u %s\n", streaming ? "streaming off" : "reclaim",
+              Capture_Length, (uint32_t)sizeof(data), errors ? "FAIL" : "ok");
+    return errors;
+}
+
+/**
+ * 流式发送时半区边界中断被推迟（同优先级的DMA1中断、临界区），推迟期间DMA已发出48字节：
+ * 只提交了first字节时DMA不能越过提交指针，缓冲区写满（63字节）时以循环模式启动，
+ * 两种情况下都不能有未提交的字节到达UART
+ */
+static int Buffer_Delay_Check(uint32_t first) {
+    static uint8_t data[140];
+    for (uint32_t k = 0; k < sizeof(data); k++) {
+        data[k] = (uint8_t)(k * 5 + 3);
+    }
+
+    DMA_Buffer_Manager_Initialize(&Manager, 64, DMA0, UART1, DMA_UART);
+    DMA_Buffer_Manager_SetPolicy(&Manager, DMA_DROP_NEWEST, 0);
+    DMA_Buffer_Manager_SetStreaming(&Manager, ENABLE);
+    Sim_Capture_Reset(UART1);
+    vTaskSuspendAll(); // 仿真时钟任务不能在此期间运行
+    Sim_SetInterruptMask(1);
+    DMA_Buffer_Manager_Input(&Manager, data, (uint16_t)first);
+    int circular = Manager._Circular;
+    uint64_t until = Sim_Now() + 48ull * SIM_UART_FAST_NS;
+    while (Sim_Now() < until) {
+        Sim_Advance(1);
+    }
+    uint32_t delayed = Capture_Length;
+    Sim_SetInterruptMask(0);
+    xTaskResumeAll();
+    int drained = Sim_Drain(&Manager, 5000);
+    for (uint32_t at = first; at < sizeof(data); at += 60) {
+        uint32_t length = (sizeof(data) - at < 60) ? sizeof(data) - at : 60;
+        DMA_Buffer_Manager_Input(&Manager, &data[at], (uint16_t)length);
+        drained &= Sim_Drain(&Manager, 5000);
+    }
+
+    int errors = !drained || (Capture_Length != sizeof(data)) || memcmp(Capture, data, sizeof(data)) != 0 ||
+                 (circular != (first == 63)) || (delayed > first);
+    Sim_Print("buffer streaming interrupt delayed %u bytes, %u committed%s, sent %u of %u %s\n", delayed, first,
+              circular ? " circular" : "", Capture_Length, (uint32_t)sizeof(data), errors ? "FAIL" : "ok");
+    return errors;
+}
+
+static int Scenario_Buffer(void) {
+    static const uint16_t lengths[] = { 64, 128, 256 };
+    static const DMA_Policy_Enum policies[] = { DMA_DROP_NEWEST, DMA_BLOCK, DMA_OVERWRITE_OLDEST };
+    static const char * const policy_names[] = { "drop", "block", "overwrite" };
+    int failures = 0;
+
+    Sim_SetUnitTime(UART1, SIM_UART_FAST_NS);
+    for (uint32_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+        for (uint32_t p = 0; p < sizeof(policies) / sizeof(policies[0]); p++) {
+            for (uint32_t streaming = 0; streaming < 2; streaming++) {
+                Buffer_Producer producers[BUFFER_PRODUCERS];
+                DMA_Buffer_Statistics statistics;
+                uint32_t records;
+
+                DMA_Buffer_Manager_Initialize(&Manager, lengths[l], DMA0, UART1, DMA_UART);
+                DMA_Buffer_Manager_SetPolicy(&Manager, policies[p], (policies[p] == DMA_BLOCK) ? portMAX_DELAY : 0);
+                DMA_Buffer_Manager_SetStreaming(&Manager, streaming ? ENABLE : DISABLE);
+                Sim_Capture_Reset(UART1);
+
+                TaskHandle_t handles[BUFFER_PRODUCERS];
+                for (uint32_t id = 0; id < BUFFER_PRODUCERS; id++) {
+                    uint32_t payload_max = (lengths[l] - 6u < BUFFER_RECORD_MAX) ? (lengths[l] - 6u) : BUFFER_RECORD_MAX;
+                    producers[id] = (Buffer_Producer){ id, 0, 0, (policies[p] == DMA_BLOCK),
+                                                       (policies[p] == DMA_BLOCK) ? payload_max : BUFFER_RECORD_MAX,
+                                                       xTaskGetCurrentTaskHandle() };
+                    xTaskCreate(vTask_Buffer_Producer, "Producer", configMINIMAL_STACK_SIZE, &producers[id],
+                                SIM_TEST_PRIORITY - (UBaseType_t)id, &handles[id]);
+                }
+                for (uint32_t id = 0; id < BUFFER_PRODUCERS; id++) {
+                    ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+                }
+                for (uint32_t id = 0; id < BUFFER_PRODUCERS; id++) {
+                    vTaskDelete(handles[id]);
+                }
+                int drained = Sim_Drain(&Manager, 5000);
+                DMA_Buffer_Manager_GetStatistics(&Manager, &statistics, 1);
+
+                uint32_t requested = 0, accepted = 0;
+                for (uint32_t id = 0; id < BUFFER_PRODUCERS; id++) {
+                    requested += producers[id].requested;
+                    accepted += producers[id].accepted;
+                }
+                // 字节守恒：发出的 = 写入的 - 被覆盖的；丢弃的 = 请求的 - 写入的
+                int errors = !drained;
+                errors += (Capture_Length != accepted - statistics.Overwritten_Bytes);
+                errors += (statistics.Dropped_Bytes != requested - accepted);
+                if (policies[p] != DMA_OVERWRITE_OLDEST) {
+                    errors += Buffer_Verify(policies[p] == DMA_BLOCK, &records);
+                } else {
+                    records = 0;
+                }
+                Sim_Print("buffer %3u %-9s %-9s sent %6u dropped %6u overwritten %6u records %4u %s\n",
+                          lengths[l], policy_names[p], streaming ? "streaming" : "segmented",
+                          Capture_Length, statistics.Dropped_Bytes, statistics.Overwritten_Bytes,
+                          records, errors ? "FAIL" : "ok");
+                failures += (errors != 0);
+            }
+        }
+    }
+    return failures + Buffer_Pending_Check(0) + Buffer_Pending_Check(1) + Buffer_Delay_Check(40) +
+           Buffer_Delay_Check(63);
+}
+
+/* terminal场景 -------------------------------------------------------------*/
+
+#define TERMINAL_LINES   400
+#define TERMINAL_TASKS   3
+
+/**
+ * 按编号选择一种格式并输出到终端和主机snprintf，返回期望文本长度
+ */
+static int Terminal_Case(uint32_t *state, char *expected, int size) {
+    static const char * const words[] = { "", "a", "NBK2002", "ring-buffer", "0123456789abcdefghij" };
+    int v = (int)(Sim_Random(state, 0xFFFFFF) - 0x7FFFFF) * (int)(Sim_Random(state, 300) + 1);
+    unsigned int u = Sim_Random(state, 0xFFFFFF) * (Sim_Random(state, 256) + 1);
+    const char *s = words[Sim_Random(state, 5)];
+    char c = (char)('A' + Sim_Random(state, 26));
+
+    switch (Sim_Random(state, 8)) {
+        case 0:
+            Terminal_Output("%d %u %x %X\n", v, u, u, u);
+            return snprintf(expected, size, "%d %u %x %X\n", v, u, u, u);
+        case 1:
+            Terminal_Output("[%8d|%-8d|%08d]\n", v, v, v);
+            return snprintf(expected, size, "[%8d|%-8d|%08d]\n", v, v, v);
+        case 2:
+            Terminal_Output("%.5u %.0u %.3x %010lu\n", u, 0u, u, (unsigned long)u);
+            return snprintf(expected, size, "%.5u %.0u %.3x %010lu\n", u, 0u, u, (unsigned long)u);
+        case 3:
+            Terminal_Output("<%s> <%12s> <%-12s> <%.3s>\n", s, s, s, s);
+            return snprintf(expected, size, "<%s> <%12s> <%-12s> <%.3s>\n", s, s, s, s);
+        case 4:
+            Terminal_Output("%c%3c%-3c| 100%%\n", c, c, c);
+            return snprintf(expected, size, "%c%3c%-3c| 100%%\n", c, c, c);
+        case 5:
+            Terminal_Output("%i %ld %d %d\n", v, (long)v, -2147483647 - 1, 2147483647);
+            return snprintf(expected, size, "%i %ld %d %d\n", v, (long)v, -2147483647 - 1, 2147483647);
+        case 6:
+            Terminal_Output("%u %u %u %u\n", 0u, 9u, 10000u, 4294967295u);
+            return snprintf(expected, size, "%u %u %u %u\n", 0u, 9u, 10000u, 4294967295u);
+        default:
+            Terminal_Output("no arguments\n");
+            return snprintf(expected, size, "no arguments\n");
+    }
+}
+
+/**
+ * 并发输出任务：每行"T<号> <序号> <填充>\n"，缓冲区满时整行丢弃
+ */
+static const char Terminal_Filler[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+static void vTask_Terminal_Producer(void *pvParameters) {
+    uint32_t id = (uint32_t)(uintptr_t)pvParameters;
+    uint32_t state = Seed + id * 7919u;
+
+    char pad[sizeof(Terminal_Filler)];
+
+    for (uint32_t seq = 0; seq < TERMINAL_LINES; seq++) {
+        uint32_t length = Sim_Random(&state, 40);
+        memcpy(pad, &Terminal_Filler[id], length);
+        pad[length] = '\0';
+        Terminal_Output("T%u %u %s\n", id, seq, pad);
+        if (Sim_Random(&state, 4) == 0) {
+            vTaskDelay(Sim_Random(&state, 2));
+        }
+    }
+    vTaskSuspend(NULL);
+}
+
+static int Scenario_Terminal(void) {
+    static char expected[TERMINAL_LINES * 96];
+    static uint8_t ring[256];
+    static StaticSemaphore_t mutex;
+    uint32_t state = Seed;
+    int expected_length = 0;
+    int errors = 0;
+
+    // 单任务：逐字节与snprintf对比，阻塞策略保证不丢行；缓冲区与互斥锁使用静态存储，不占用堆
+    Sim_SetUnitTime(UART1, SIM_UART_FAST_NS);
+    size_t heap = xPortGetFreeHeapSize();
+    DMA_Buffer_Manager_InitializeStatic(&Manager, ring, sizeof(ring), &mutex, DMA0, UART1, DMA_UART);
+    if (xPortGetFreeHeapSize() != heap || Manager._Buffer != ring) {
+        Sim_Print("terminal static initialisation used the heap\n");
+        errors++;
+    }
+    DMA_Buffer_Manager_SetPolicy(&Manager, DMA_BLOCK, portMAX_DELAY);
+    DMA_Buffer_Manager_SetStreaming(&Manager, ENABLE);
+    Terminal_Initialize(&Manager);
+    Sim_Capture_Reset(UART1);
+    for (int line = 0; line < TERMINAL_LINES; line++) {
+        expected_length += Terminal_Case(&state, &expected[expected_length], (int)sizeof(expected) - expected_length);
+    }
+    errors += !Sim_Drain(&Manager, 5000);
+    if ((int)Capture_Length != expected_length || memcmp(Capture, expected, (size_t)expected_length) != 0) {
+        uint32_t at = 0;
+        while (at < Capture_Length && Capture[at] == (uint8_t)expected[at]) at++;
+        Sim_Print("terminal mismatch at byte %u\n", at);
+        errors++;
+    }
+    Sim_Print("terminal format %d lines %d bytes %s\n", TERMINAL_LINES, expected_length, errors ? "FAIL" : "ok");
+
+    // 超过环形缓冲区容量的记录截断到容量，以换行结尾
+    static char wide[201];
+    memset(wide, 'x', sizeof(wide) - 1);
+    Sim_Capture_Reset(UART1);
+    int truncated = Terminal_Output("L%s%s\n", wide, wide);
+    int truncate_errors = !Sim_Drain(&Manager, 5000) || (truncated != (int)sizeof(ring) - 1) ||
+                          (Capture_Length != sizeof(ring) - 1) || (Capture[0] != 'L') ||
+                          (Capture[sizeof(ring) - 2] != '\n') || (Capture[sizeof(ring) - 3] != 'x');
+    Sim_Print("terminal record of %u bytes truncated to %u %s\n", 2u * 200 + 2, Capture_Length,
+              truncate_errors ? "FAIL" : "ok");
+    errors += truncate_errors;
+
+    // 多任务：丢弃策略下每一行要么完整出现要么不出现，且各任务的行保持顺序
+    DMA_Buffer_Statistics statistics;
+    int32_t last_seq[TERMINAL_TASKS] = { -1, -1, -1 };
+    uint32_t lines = 0;
+    int concurrent_errors = 0;
+    DMA_Buffer_Manager_SetPolicy(&Manager, DMA_DROP_NEWEST, 0);
+    DMA_Buffer_Manager_GetStatistics(&Manager, &statistics, 1);
+    Sim_Capture_Reset(UART1);
+    TaskHandle_t handles[TERMINAL_TASKS];
+    for (uint32_t id = 0; id < TERMINAL_TASKS; id++) {
+        xTaskCreate(vTask_Terminal_Producer, "Terminal", configMINIMAL_STACK_SIZE, (void *)(uintptr_t)id,
+                    SIM_TEST_PRIORITY - (UBaseType_t)id, &handles[id]);
+    }
+    vTaskDelay(200);
+    concurrent_errors += !Sim_Drain(&Manager, 5000);
+    for (uint32_t id = 0; id < TERMINAL_TASKS; id++) {
+        vTaskDelete(handles[id]);
+    }
+    DMA_Buffer_Manager_GetStatistics(&Manager, &statistics, 1);
+    for (uint32_t i = 0; i < Capture_Length;) {
+        unsigned int id, seq;
+        int consumed = 0;
+        char *end = memchr(&Capture[i], '\n', Capture_Length - i);
+        if (end == NULL || sscanf((const char *)&Capture[i], "T%u %u%n", &id, &seq, &consumed) != 2 ||
+            id >= TERMINAL_TASKS || (int32_t)seq <= last_seq[id]) {
+            concurrent_errors++;
+            break;
+        }
+        // 填充部分必须是从Terminal_Filler[id]开始的连续字母
+        char *text = (char *)&Capture[i + (uint32_t)consumed + 1];
+        for (char *p = text; p < end; p++) {
+            if (*p != Terminal_Filler[id + (uint32_t)(p - text)]) {
+                concurrent_errors++;
+                break;
+            }
+        }
+        last_seq[id] = (int32_t)seq;
+        lines++;
+        i = (uint32_t)(end - (char *)Capture) + 1;
+    }
+    concurrent_errors += (lines + statistics.Dropped_Records != TERMINAL_TASKS * TERMINAL_LINES);
+    Sim_Print("terminal concurrent lines %u dropped %u %s\n", lines, statistics.Dropped_Records,
+              concurrent_errors ? "FAIL" : "ok");
+    return errors + concurrent_errors;
+}
+
+/* receive场景 --------------------------------------------------------------*/
+
+#define RECEIVE_FRAMES   120
+#define RECEIVE_MAX      150
+
+static uint8_t Receive_Sent[RECEIVE_FRAMES * RECEIVE_MAX];
+static uint8_t Receive_Boundary[RECEIVE_FRAMES * RECEIVE_MAX + 1];  // 发送侧帧结束位置
+static volatile uint32_t Receive_Sent_Length;
+
+/**
+ * 注入任务：逐帧注入随机数据，帧间留出2ms空闲（大于4个250us检测周期）
+ * 注入在临界区内进行，不与仿真时钟任务并发；接收队列满时等待其排空
+ */
+static void vTask_Receive_Injector(void *pvParameters) {
+    uint32_t state = Seed;
+    uint32_t total = 0;
+
+    for (uint32_t f = 0; f < RECEIVE_FRAMES; f++) {
+        uint32_t length = Sim_Random(&state, RECEIVE_MAX) + 1;
+        for (uint32_t k = 0; k < length; k++) {
+            Receive_Sent[total + k] = (uint8_t)Sim_Random(&state, 256);
+        }
+        for (uint32_t done = 0; done < length;) {
+            taskENTER_CRITICAL();
+            done += Sim_Inject(UART1, &Receive_Sent[total + done], length - done, (done == 0) ? 2000 : 0);
+            taskEXIT_CRITICAL();
+            if (done < length) {
+                vTaskDelay(10);
+            }
+        }
+        total += length;
+        Receive_Boundary[total] = 1;
+        Receive_Sent_Length = total;
+    }
+    vTaskSuspend(NULL);
+}
+
+static int Scenario_Receive(void) {
+    static DMA_Receive_Manager Receiver;
+    static uint8_t received[RECEIVE_FRAMES * RECEIVE_MAX];
+    uint32_t received_length = 0, frames = 0;
+    int errors = 0;
+
+    DMA_Receive_Manager_Initialize(&Receiver, 64, 2048, 4, DMA0, UART1, DMA_UART);
+    DMA_Receive_Manager_StartTimer(TIM0, 250);
+    TaskHandle_t injector;
+    xTaskCreate(vTask_Receive_Injector, "Injector", configMINIMAL_STACK_SIZE, NULL, SIM_TEST_PRIORITY - 1, &injector);
+
+    // 接收并拼接，任何一帧都不能跨越发送侧的帧边界
+    for (;;) {
+        size_t length = DMA_Receive_Manager_Receive(&Receiver, &received[received_length],
+                                                     sizeof(received) - received_length, 100);
+        if (length == 0) {
+            break;
+        }
+        for (uint32_t k = 1; k < length; k++) {
+            if (Receive_Boundary[received_length + k]) errors++;
+        }
+        received_length += (uint32_t)length;
+        frames++;
+    }
+    vTaskDelete(injector);
+    DMA_Receive_Statistics statistics;
+    DMA_Receive_Manager_GetStatistics(&Receiver, &statistics, 0);
+    errors += (received_length != Receive_Sent_Length) || memcmp(Receive_Sent, received, received_length) != 0;
+    errors += (statistics.Dropped_Frames != 0) || (frames < RECEIVE_FRAMES);
+    Sim_Print("receive sent %u frames %u bytes, got %u frames %u bytes, dropped %u %s\n",
+              RECEIVE_FRAMES, Receive_Sent_Length, frames, received_length, statistics.Dropped_Frames,
+              errors ? "FAIL" : "ok");
+    return errors;
+}
+
+/* spi场景 ------------------------------------------------------------------*/
+
+#define SPI_TRANSFERS    200
+#define QUEUE_TRANSFERS  100
+#define QUEUE_CS_PINS    (GPIO_Pin_0 | GPIO_Pin_1)   // GPIOA上两个设备的片选
+#define QUEUE_DC_PIN     GPIO_Pin_2
+
+static uint8_t Queue_Pins[SIM_CAPTURE_LENGTH];       // 每个字节发出时GPIOA的片选与D/C电平
+static uint32_t Queue_Callbacks;
+static uint32_t Queue_Order_Errors;
+
+static void Queue_Capture(void * Peripheral, uint32_t Data) {
+    if (Peripheral == SPI0 && Capture_Length < SIM_CAPTURE_LENGTH) {
+        Queue_Pins[Capture_Length] = (uint8_t)(GPIOA->PIN & (QUEUE_CS_PINS | QUEUE_DC_PIN));
+        Capture[Capture_Length++] = (uint8_t)Data;
+    }
+}
+
+static void Queue_Callback(void *context) {
+    Queue_Order_Errors += ((uint32_t)(uintptr_t)context != Queue_Callbacks);
+    Queue_Callbacks++;
+}
+
+/**
+ * 描述符队列：两个设备交替提交（片选/D/C/短数据/保持片选随机），
+ * 队列满时提交者阻塞，检查每个字节发出时的引脚电平、回调顺序与完成通知次数
+ */
+static int Spi_Queue_Check(uint8_t *pool, uint32_t *state) {
+    static uint8_t expected_pins[SIM_CAPTURE_LENGTH];
+    GPIO_InitTypeDef GPIO_InitStruct = { QUEUE_CS_PINS | QUEUE_DC_PIN, GPIO_Mode_OUT_PP, 0 };
+    uint32_t total = 0;
+    uint32_t notify = 0;
+
+    for (uint32_t k = 0; k < QUEUE_TRANSFERS * (SPI_SEGMENT_MAX + 600); k++) {
+        pool[k] = (uint8_t)Sim_Random(state, 256);
+    }
+    GPIO_Init(GPIOA, &GPIO_InitStruct);
+    GPIO_SetBits(GPIOA, QUEUE_CS_PINS);
+    Sim_SetTransmitCallback(Queue_Capture);
+    Sim_Capture_Reset(SPI0);
+    for (uint32_t t = 0; t < QUEUE_TRANSFERS; t++) {
+        SPI_Transaction txn = { 0 };
+        uint16_t cs = (Sim_Random(state, 2) == 0) ? GPIO_Pin_0 : GPIO_Pin_1;
+        txn.cs_port = GPIOA;
+        txn.cs_pin = cs;
+        txn.dc_port = GPIOA;
+        txn.dc_pin = QUEUE_DC_PIN;
+        txn.dc = (uint8_t)Sim_Random(state, 2);
+        txn.flags = (uint8_t)((Sim_Random(state, 2) ? SPI_TXN_KEEP_CS : 0) | ((t % 3 == 0) ? SPI_TXN_NOTIFY : 0));
+        txn.callback = Queue_Callback;
+        txn.context = (void *)(uintptr_t)t;
+        if (Sim_Random(state, 3) == 0) {
+            txn.len = Sim_Random(state, 4) + 1;
+            memcpy(txn.immediate, &pool[total], txn.len);
+        } else {
+            txn.len = Sim_Random(state, SPI_SEGMENT_MAX + 600) + 1;
+            txn.bytes = &pool[total];
+        }
+        for (uint32_t k = 0; k < txn.len; k++) {
+            expected_pins[total + k] = (uint8_t)((QUEUE_CS_PINS & ~cs) | (txn.dc ? QUEUE_DC_PIN : 0));
+        }
+        total += txn.len;
+        notify += (txn.flags & SPI_TXN_NOTIFY) != 0;
+        SPI_Submit(&spi0, &txn, portMAX_DELAY);
+    }
+    uint32_t notified = 0;
+    while (SPI_Wait_Complete(pdMS_TO_TICKS(1000)) == pdTRUE) {
+        if (++notified == notify) {
+            break;
+        }
+    }
+    notified += (SPI_Wait_Complete(0) == pdTRUE);   // 不应有多余的通知
+    SPI_Release(&spi0);
+    int errors = (Capture_Length != total) || memcmp(Capture, pool, total) != 0 ||
+                 memcmp(Queue_Pins, expected_pins, total) != 0 || (Queue_Callbacks != QUEUE_TRANSFERS) ||
+                 (Queue_Order_Errors != 0) || (notified != notify) ||
+                 ((GPIOA->PIN & QUEUE_CS_PINS) != QUEUE_CS_PINS);
+    Sim_Print("spi queue %u transactions %u bytes captured %u callbacks %u notified %u/%u %s\n",
+              QUEUE_TRANSFERS, total, Capture_Length, Queue_Callbacks, notified, notify, errors ? "FAIL" : "ok");
+    Sim_SetTransmitCallback(Sim_Capture);
+    return errors;
+}
+
+/**
+ * 从机在MISO上的应答：由字节序号与MOSI数据决定，接收到的数据可以按发送记录核对
+ */
+static uint8_t Duplex_Reply(uint32_t Index, uint8_t Mosi) {
+    return (uint8_t)((Index * 7u + 3u) ^ Mosi);
+}
+
+static void Duplex_Capture(void * Peripheral, uint32_t Data) {
+    if (Peripheral == SPI0 && Capture_Length < SIM_CAPTURE_LENGTH) {
+        uint8_t reply = Duplex_Reply(Capture_Length, (uint8_t)Data);
+        Capture[Capture_Length++] = (uint8_t)Data;
+        Sim_Inject(SPI0, &reply, 1, 0);
+    }
+}
+
+/**
+ * 全双工：DMA0接收SPI0数据，收发交替（仅发送期间到达的字节须在接收前丢弃），
+ * 检查收到的数据、哑字节、完成通知以及只由接收通道中断推进的分段
+ */
+static int Spi_Duplex_Check(uint8_t *pool, uint32_t *state) {
+    static uint8_t rx_large[SPI_SEGMENT_MAX * 2 + 500];
+    static uint8_t rx_dummy[700];
+    static uint8_t rx_short[3];                         // DMA地址为32位，不能放在宿主线程栈上
+    uint32_t large = SPI_SEGMENT_MAX + Sim_Random(state, SPI_SEGMENT_MAX + 500);
+    uint32_t dummy = Sim_Random(state, sizeof(rx_dummy)) + 1;
+    SPI_Transaction txn = { 0 };
+
+    SPI_ChunkBuffer_AttachRx(&spi0, DMA0);
+    Sim_SetTransmitCallback(Duplex_Capture);
+    Sim_Capture_Reset(SPI0);
+    uint32_t rx_interrupts = Sim_GetInterruptCount(DMA0);
+    uint32_t tx_interrupts = Sim_GetInterruptCount(DMA1);
+    SPI_Send_Large(&spi0, pool, 100);                   // 仅发送，应答留在接收队列中
+    SPI_Transfer(&spi0, pool, rx_large, large);         // 全双工，跨段
+    SPI_Transfer(&spi0, NULL, rx_dummy, dummy);         // 只读：固定源地址发送0xFF
+    txn.len = sizeof(rx_short);                         // 描述符中的短命令，同时接收
+    memcpy(txn.immediate, "\x9F\x00\x00", sizeof(rx_short));
+    txn.rx = rx_short;
+    txn.flags = SPI_TXN_NOTIFY;
+    SPI_Submit(&spi0, &txn, portMAX_DELAY);
+    SPI_Send_Large(&spi0, pool, 100);                   // 再回到仅发送
+    int errors = (SPI_Wait_Complete(pdMS_TO_TICKS(1000)) != pdTRUE);
+    SPI_Wait_Idle(&spi0);
+
+    uint32_t offset = 100;
+    errors += (Capture_Length != 100 + large + dummy + sizeof(rx_short) + 100);
+    for (uint32_t k = 0; k < large && offset + k < Capture_Length; k++) {
+        errors += (rx_large[k] != Duplex_Reply(offset + k, Capture[offset + k])) || (Capture[offset + k] != pool[k]);
+    }
+    offset += large;
+    for (uint32_t k = 0; k < dummy && offset + k < Capture_Length; k++) {
+        errors += (rx_dummy[k] != Duplex_Reply(offset + k, 0xFF)) || (Capture[offset + k] != 0xFF);
+    }
+    offset += dummy;
+    for (uint32_t k = 0; k < sizeof(rx_short) && offset + k < Capture_Length; k++) {
+        errors += (rx_short[k] != Duplex_Reply(offset + k, Capture[offset + k]));
+    }
+    errors += (Capture_Length > offset + 3) && (memcmp(&Capture[offset + 3], pool, 100) != 0);
+    rx_interrupts = Sim_GetInterruptCount(DMA0) - rx_interrupts;
+    tx_interrupts = Sim_GetInterruptCount(DMA1) - tx_interrupts;
+    uint32_t rx_segments = (large + SPI_SEGMENT_MAX - 1) / SPI_SEGMENT_MAX + 1 + 1;
+    errors += (rx_interrupts != rx_segments) || (tx_interrupts != 2);
+    Sim_Print("spi duplex %u+%u+%u bytes received, captured %u, rx/tx interrupts %u/%u %s\n", large, dummy,
+              (unsigned int)sizeof(rx_short), Capture_Length, rx_interrupts, tx_interrupts, errors ? "FAIL" : "ok");
+    Sim_SetTransmitCallback(Sim_Capture);
+    return errors;
+}
+
+/**
+ * 与User/SC_Init.c中SC_DMA1_Init相同的配置：DMA1把内存数据送往SPI0
+ */
+static void Spi_Dma_Init(void) {
+    DMA_InitTypeDef DMA_InitStruct;
+    DMA_StructInit(&DMA_InitStruct);
+    DMA_InitStruct.DMA_SourceMode = DMA_SourceMode_INC_CIRC;
+    DMA_InitStruct.DMA_TargetMode = DMA_TargetMode_FIXED;
+    DMA_InitStruct.DMA_DstAddress = (uint32_t)&SPI0->SPI_DATA;
+    DMA_InitStruct.DMA_Request = DMA_Request_SPI0_TX;
+    DMA_Init(DMA1, &DMA_InitStruct);
+    DMA_ITConfig(DMA1, DMA_IT_INTEN | DMA_IT_TCIE, ENABLE);
+    DMA_DMACmd(DMA1, DMA_DMAReq_CHRQ, DISABLE);
+    DMA_Cmd(DMA1, ENABLE);
+    SPI_DMACmd(SPI0, SPI_DMAReq_TX, ENABLE);
+    SPI0->SPI_CON |= SPI_CON_CPOL;     // 与SC_SPI0_Init一致：CPOL高、第一个边沿采样（模式2）
+}
+
+static int Scenario_Spi(void) {
+    static uint8_t pool[SIM_CAPTURE_LENGTH];
+    uint32_t state = Seed;
+    uint32_t total = 0;
+
+    static StaticSemaphore_t mutex;
+    Spi_Dma_Init();
+    size_t heap = xPortGetFreeHeapSize();
+    SPI_ChunkBuffer_InitStatic(&spi0, &mutex);
+    int heap_errors = (xPortGetFreeHeapSize() != heap);
+    Sim_Capture_Reset(SPI0);
+    for (uint32_t t = 0; t < SPI_TRANSFERS; t++) {
+        uint8_t length = (uint8_t)(Sim_Random(&state, 255) + 1);
+        for (uint32_t k = 0; k < length; k++) {
+            pool[total + k] = (uint8_t)Sim_Random(&state, 256);
+        }
+        SPI_Send_Multi(&spi0, &pool[total], length);
+        total += length;
+    }
+    vTaskDelay(10);
+    int errors = (Capture_Length != total) || memcmp(Capture, pool, total) != 0 || heap_errors;
+    Sim_Print("spi transfers %u bytes %u captured %u static mutex %s %s\n", SPI_TRANSFERS, total, Capture_Length,
+              heap_errors ? "used heap" : "no heap", errors ? "FAIL" : "ok");
+
+    // 超过一段的传输：中断逐段续传，整个传输结束时才释放transmit_s
+    uint32_t large = SPI_SEGMENT_MAX * 3 + Sim_Random(&state, SPI_SEGMENT_MAX);
+    uint32_t interrupts = Sim_GetInterruptCount(DMA1);
+    Sim_Capture_Reset(SPI0);
+    SPI_Send_Large(&spi0, pool, large);
+    uint32_t segments = (large + SPI_SEGMENT_MAX - 1) / SPI_SEGMENT_MAX;
+    SPI_Wait_Idle(&spi0);
+    int large_errors = (Capture_Length != large) || memcmp(Capture, pool, large) != 0 ||
+                       (Sim_GetInterruptCount(DMA1) - interrupts != segments);
+    Sim_Print("spi large %u bytes captured %u in %u segments %s\n", large, Capture_Length,
+              Sim_GetInterruptCount(DMA1) - interrupts, large_errors ? "FAIL" : "ok");
+
+    // 固定源地址填充：16位帧、高字节在前，按帧数分段；紧随其后的字节传输须恢复8位帧与递增源地址
+    uint16_t value = (uint16_t)Sim_Random(&state, 0x10000);
+    uint32_t count = SPI_SEGMENT_MAX * 2 + Sim_Random(&state, SPI_SEGMENT_MAX);
+    interrupts = Sim_GetInterruptCount(DMA1);
+    Sim_Capture_Reset(SPI0);
+    SPI_Send_Fill(&spi0, value, count);
+    SPI_Send_Large(&spi0, pool, 300);
+    SPI_Wait_Idle(&spi0);
+    segments = (count + SPI_SEGMENT_MAX - 1) / SPI_SEGMENT_MAX + 1;
+    int fill_errors = (Capture_Length != count * 2 + 300) || memcmp(&Capture[count * 2], pool, 300) != 0 ||
+                      (Sim_GetInterruptCount(DMA1) - interrupts != segments);
+    for (uint32_t k = 0; k < count * 2 && k < Capture_Length; k += 2) {
+        fill_errors += (Capture[k] != (uint8_t)(value >> 8)) || (Capture[k + 1] != (uint8_t)value);
+    }
+    Sim_Print("spi fill %u pixels of %04X captured %u in %u segments %s\n", count, value, Capture_Length,
+              Sim_GetInterruptCount(DMA1) - interrupts, fill_errors ? "FAIL" : "ok");
+
+    // 16位帧发送本机字节序的半字：DMA次数减半，线上高字节在前，前后的字节传输不受影响
+    static uint16_t wide[SPI_SEGMENT_MAX + 1000];
+    count = SPI_SEGMENT_MAX + Sim_Random(&state, 1000);
+    for (uint32_t k = 0; k < count; k++) {
+        wide[k] = (uint16_t)Sim_Random(&state, 0x10000);
+    }
+    interrupts = Sim_GetInterruptCount(DMA1);
+    Sim_Capture_Reset(SPI0);
+    SPI_Send_Large(&spi0, pool, 3);
+    SPI_Send_Wide(&spi0, wide, count);
+    SPI_Send_Large(&spi0, pool, 3);
+    SPI_Wait_Idle(&spi0);
+    int wide_errors = (Capture_Length != count * 2 + 6) || memcmp(Capture, pool, 3) != 0 ||
+                      memcmp(&Capture[3 + count * 2], pool, 3) != 0 ||
+                      (Sim_GetInterruptCount(DMA1) - interrupts != 2 + 2);
+    for (uint32_t k = 0; k < count && 3 + 2 * k + 1 < Capture_Length; k++) {
+        wide_errors += (Capture[3 + 2 * k] != (uint8_t)(wide[k] >> 8)) || (Capture[3 + 2 * k + 1] != (uint8_t)wide[k]);
+    }
+    Sim_Print("spi wide %u frames captured %u bytes in %u interrupts %s\n", count, Capture_Length,
+              Sim_GetInterruptCount(DMA1) - interrupts, wide_errors ? "FAIL" : "ok");
+    return errors + large_errors + fill_errors + wide_errors + Spi_Queue_Check(pool, &state) +
+           Spi_Duplex_Check(pool, &state);
+}
+
+/* st7789场景 ---------------------------------------------------------------*/
+
+#define PANEL_COMMANDS   64
+#define PANEL_RECTS      40
+
+/**
+ * 屏幕模型：片选有效时按D/C电平区分命令与参数（SPI0不在模式0/3时收到的字节记为错误），解析CASET/RASET/RAMWR写入显存，
+ * VSCRDEF/VSCRSADD只记录滚动参数，显示内容由Panel_Visible按滚动映射得到
+ */
+static struct {
+    uint16_t Frame[ST7789_HEIGHT][ST7789_WIDTH];
+    uint8_t  Command;
+    uint32_t Index;                      // 当前命令已收到的参数字节数
+    uint8_t  Parameter[6];
+    uint16_t X0, X1, Y0, Y1, X, Y;
+    uint8_t  High;                       // RAMWR中已收到的像素高字节
+    uint8_t  Log[PANEL_COMMANDS][2];     // 命令与第一个参数
+    uint32_t Log_Length;
+    uint32_t Windows;                    // RAMWR命令数
+    uint32_t Errors;                     // 窗口外写入等协议错误
+    uint32_t Pixels;                     // 写入显存的像素数
+    uint16_t Scroll_Top, Scroll_Height;  // 滚动区域（VSCRDEF的顶部固定区与滚动区行数）
+    uint16_t Scroll_Start;               // 滚动起始行（VSCRSADD）
+    uint32_t Scrolls;                    // VSCRSADD命令数
+    uint32_t Resumes;                    // RAMWRC命令数
+} Panel;
+
+static uint16_t Panel_Expected[ST7789_HEIGHT][ST7789_WIDTH];
+
+/**
+ * 解析片选有效时收到的一个字节，dc为0是命令
+ */
+static void Panel_Byte(uint8_t dc, uint8_t byte) {
+    if (!dc) {
+        Panel.Command = byte;
+        Panel.Index = 0;
+        if (Panel.Log_Length < PANEL_COMMANDS) {
+            Panel.Log[Panel.Log_Length][0] = byte;
+            Panel.Log[Panel.Log_Length++][1] = 0;
+        }
+        if (byte == ST7789_RAMWR) {
+            Panel.Windows++;
+            Panel.X = Panel.X0;
+            Panel.Y = Panel.Y0;
+        } else if (byte == ST7789_RAMWRC) {
+            // 从上次写入的位置继续
+            Panel.Command = ST7789_RAMWR;
+            Panel.Resumes++;
+        }
+        return;
+    }
+    if (Panel.Index == 0 && Panel.Log_Length != 0) {
+        Panel.Log[Panel.Log_Length - 1][1] = byte;
+    }
+    if (Panel.Command != ST7789_RAMWR) {
+        if (Panel.Index < 6) {
+            Panel.Parameter[Panel.Index] = byte;
+        }
+        if (++Panel.Index == 4 && Panel.Command == ST7789_CASET) {
+            Panel.X0 = (uint16_t)((Panel.Parameter[0] << 8) | Panel.Parameter[1]);
+            Panel.X1 = (uint16_t)((Panel.Parameter[2] << 8) | Panel.Parameter[3]);
+        } else if (Panel.Index == 4 && Panel.Command == ST7789_RASET) {
+            Panel.Y0 = (uint16_t)((Panel.Parameter[0] << 8) | Panel.Parameter[1]);
+            Panel.Y1 = (uint16_t)((Panel.Parameter[2] << 8) | Panel.Parameter[3]);
+        } else if (Panel.Index == 6 && Panel.Command == ST7789_VSCRDEF) {
+            Panel.Scroll_Top = (uint16_t)((Panel.Parameter[0] << 8) | Panel.Parameter[1]);
+            Panel.Scroll_Height = (uint16_t)((Panel.Parameter[2] << 8) | Panel.Parameter[3]);
+            uint16_t bottom = (uint16_t)((Panel.Parameter[4] << 8) | Panel.Parameter[5]);
+            Panel.Errors += (Panel.Scroll_Top + Panel.Scroll_Height + bottom != ST7789_MEMORY_HEIGHT);
+        } else if (Panel.Index == 2 && Panel.Command == ST7789_VSCRSADD) {
+            Panel.Scroll_Start = (uint16_t)((Panel.Parameter[0] << 8) | Panel.Parameter[1]);
+            Panel.Scrolls++;
+        }
+        return;
+    }
+    if ((Panel.Index++ & 1) == 0) {
+        Panel.High = byte;
+        return;
+    }
+    if (Panel.X >= ST7789_WIDTH || Panel.Y >= ST7789_HEIGHT || Panel.Y > Panel.Y1) {
+        Panel.Errors++;
+        return;
+    }
+    Panel.Frame[Panel.Y][Panel.X] = (uint16_t)((Panel.High << 8) | byte);
+    Panel.Pixels++;
+    if (Panel.X++ == Panel.X1) {
+        Panel.X = Panel.X0;
+        Panel.Y++;
+    }
+}
+
+static void Panel_Receive(void * Peripheral, uint32_t Data) {
+    if (Peripheral != SPI0 || GPIO_ReadDataBit(ST7789_CS_PORT, ST7789_CS_PIN) == Bit_SET) {
+        return;
+    }
+    // ST7789在SCL上升沿采样，只接受模式0/3
+    Panel.Errors += ((SPI0->SPI_CON & SPI_CON_CPOL) != 0) != ((SPI0->SPI_CON & SPI_CON_CPHA) != 0);
+    Panel_Byte(GPIO_ReadDataBit(ST7789_DC_PORT, ST7789_DC_PIN) == Bit_SET, (uint8_t)Data);
+}
+
+/**
+ * 片选上升沿结束显存写入，之后的像素数据需先发送RAMWR或RAMWRC
+ */
+static void Panel_Pin(GPIO_TypeDef * Port, uint32_t Previous, uint32_t Current) {
+    if (Port == ST7789_CS_PORT && (Current & ~Previous & ST7789_CS_PIN)) {
+        Panel.Command = 0;
+    }
+}
+
+/**
+ * 8080并口：片选有效时WR上升沿锁存数据线（Pin0~7）与D/C，交给同一个屏幕模型；
+ * 数据线或D/C与WR上升沿在同一次写入中改变算作建立时间不足
+ */
+static struct {
+    uint32_t Writes;                     // 端口写入次数（电平有变化的）
+    uint32_t Strobes;                    // 锁存的字节数
+    uint32_t Errors;
+} Parallel;
+
+static void Parallel_Pin(GPIO_TypeDef * Port, uint32_t Previous, uint32_t Current) {
+    if (Port != PARALLEL_8080_PORT) {
+        return;
+    }
+    Parallel.Writes++;
+    if (Current & ~Previous & PARALLEL_8080_CS_PIN) {
+        Panel.Command = 0;
+    }
+    if ((Current & PARALLEL_8080_CS_PIN) || !(Current & ~Previous & PARALLEL_8080_WR_PIN)) {
+        return;
+    }
+    Parallel.Errors += ((Current ^ Previous) & (0xFF | PARALLEL_8080_DC_PIN | PARALLEL_8080_CS_PIN)) != 0;
+    Parallel.Strobes++;
+    Panel_Byte((Current & PARALLEL_8080_DC_PIN) != 0, (uint8_t)Current);
+}
+
+/**
+ * 屏幕第row行显示的显存行：滚动区域内从滚动起始行开始环形显示，区域外固定显示
+ */
+static uint32_t Panel_Visible(uint32_t row) {
+    uint32_t top = Panel.Scroll_Top, height = Panel.Scroll_Height;
+    if (height == 0 || row < top || row >= top + height) {
+        return row;
+    }
+    return top + (Panel.Scroll_Start - top + row - top) % height;
+}
+
+static void Panel_Fill(uint32_t x, uint32_t y, uint32_t w, uint32_t h, uint16_t color) {
+    for (uint32_t row = y; row < y + h && row < ST7789_HEIGHT; row++) {
+        for (uint32_t col = x; col < x + w && col < ST7789_WIDTH; col++) {
+            Panel_Expected[row][col] = color;
+        }
+    }
+}
+
+#define RENDER_FRAMES    30
+
+static uint8_t Render_Dirty[ST7789_HEIGHT][ST7789_WIDTH];
+
+static uint16_t Render_Pattern(uint32_t x, uint32_t y, uint32_t generation) {
+    return (uint16_t)((x * 7 + y * 131 + generation * 40503u) ^ (generation << 4));
+}
+
+static void Render_Draw(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t *pixels, void *context) {
+    uint32_t generation = *(uint32_t *)context;
+    for (uint32_t row = y; row < y + height; row++) {
+        for (uint32_t col = x; col < x + width; col++) {
+            *pixels++ = Render_Pattern(col, row, generation);
+        }
+    }
+}
+
+/**
+ * 渲染器：每帧画面整体变化，随机标记若干矩形后刷新，
+ * 标记过的像素必须是新画面，其余像素要么保持不变，要么是新画面（合并矩形带来的额外重绘）
+ */
+static int Renderer_Check(uint32_t *state) {
+    static uint32_t generation;
+    uint32_t mismatches = 0;
+    uint32_t sent = 0;
+    uint32_t marked = 0;
+
+    Renderer_Initialize(Render_Draw, &generation);
+    sent += Renderer_Flush();
+    ST7789_Release();
+    for (uint32_t row = 0; row < ST7789_HEIGHT; row++) {
+        for (uint32_t col = 0; col < ST7789_WIDTH; col++) {
+            mismatches += (Panel.Frame[row][col] != Render_Pattern(col, row, 0));
+        }
+    }
+    for (uint32_t frame = 1; frame <= RENDER_FRAMES; frame++) {
+        memcpy(Panel_Expected, Panel.Frame, sizeof(Panel_Expected));
+        memset(Render_Dirty, 0, sizeof(Render_Dirty));
+        generation = frame;
+        for (uint32_t n = Sim_Random(state, 12) + 1; n != 0; n--) {
+            uint16_t x = (uint16_t)Sim_Random(state, ST7789_WIDTH + 10);
+            uint16_t y = (uint16_t)Sim_Random(state, ST7789_HEIGHT + 10);
+            uint16_t w = (uint16_t)Sim_Random(state, 60) + 1;
+            uint16_t h = (uint16_t)Sim_Random(state, 60) + 1;
+            Renderer_Invalidate(x, y, w, h);
+            for (uint32_t row = y; row < (uint32_t)y + h && row < ST7789_HEIGHT; row++) {
+                for (uint32_t col = x; col < (uint32_t)x + w && col < ST7789_WIDTH; col++) {
+                    marked += !Render_Dirty[row][col];
+                    Render_Dirty[row][col] = 1;
+                }
+            }
+        }
+        sent += Renderer_Flush();
+        // 不等待最后一个行带：下一帧的绘制与它的发送重叠，检查前再等待（并口返回时已送出）
+        if (frame % 5 == 0 || frame == RENDER_FRAMES) {
+            ST7789_Release();
+        } else if (!ST7789_Parallel()) {
+            SPI_Wait_Idle(&spi0);
+        }
+        for (uint32_t row = 0; row < ST7789_HEIGHT; row++) {
+            for (uint32_t col = 0; col < ST7789_WIDTH; col++) {
+                uint16_t fresh = Render_Pattern(col, row, frame);
+                uint16_t pixel = Panel.Frame[row][col];
+                mismatches += Render_Dirty[row][col] ? (pixel != fresh) :
+                              (pixel != fresh && pixel != Panel_Expected[row][col]);
+            }
+        }
+    }
+    int errors = (mismatches != 0) || (Panel.Errors != 0);
+    Sim_Print("st7789 renderer frames %u marked %u sent %u mismatched pixels %u %s\n", RENDER_FRAMES,
+              marked, sent - ST7789_WIDTH * ST7789_HEIGHT, mismatches, errors ? "FAIL" : "ok");
+    return errors;
+}
+
+#define FONT_STRINGS     40
+
+/**
+ * 参考实现：整个字形解码成透明度位图后逐像素混合，与逐行流式解码的结果对比
+ */
+static void Font_Reference(const Font *font, uint32_t x, uint32_t y, const char *text, uint16_t fg, uint16_t bg) {
+    uint8_t alpha[256 * 4];
+    uint32_t width = Font_Measure(font, text);
+    uint32_t height = font->Height;
+    width = (x + width > ST7789_WIDTH) ? ST7789_WIDTH - x : width;
+    height = (y + height > ST7789_HEIGHT) ? ST7789_HEIGHT - y : height;
+    Panel_Fill(x, y, width, height, bg);
+    int32_t pen = 0;
+    for (; *text != '\0' && pen < (int32_t)width; text++) {
+        uint32_t index = (uint8_t)*text - font->First;
+        index = (index < font->Count) ? index : (uint32_t)'?' - font->First;
+        const Font_Glyph *glyph = &font->Glyphs[index];
+        const uint8_t *data = &font->Data[glyph->Offset];
+        uint32_t count = (uint32_t)glyph->Width * glyph->Height;
+        for (uint32_t n = 0, k = 0; k < count;) {
+            uint32_t skip = (data[n / 2] >> ((n & 1) ? 0 : 4)) & 0x0F;
+            uint32_t literal = (data[(n + 1) / 2] >> (((n + 1) & 1) ? 0 : 4)) & 0x0F;
+            n += 2;
+            for (; skip != 0 && k < count; skip--) {
+                alpha[k++] = 0;
+            }
+            for (; literal != 0 && k < count; literal--, n++) {
+                alpha[k++] = (data[n / 2] >> ((n & 1) ? 0 : 4)) & 0x0F;
+            }
+        }
+        for (uint32_t k = 0; k < count; k++) {
+            int32_t col = pen + glyph->X_Offset + (int32_t)(k % glyph->Width);
+            int32_t row = glyph->Y_Offset + (int32_t)(k / glyph->Width);
+            if (alpha[k] == 0 || col < 0 || col >= (int32_t)width || row < 0 || row >= (int32_t)height) {
+                continue;
+            }
+            int32_t r = bg >> 11, g = (bg >> 5) & 0x3F, b = bg & 0x1F;
+            r += ((fg >> 11) - r) * alpha[k] / 15;
+            g += (((fg >> 5) & 0x3F) - g) * alpha[k] / 15;
+            b += ((fg & 0x1F) - b) * alpha[k] / 15;
+            Panel_Expected[y + row][x + col] = (uint16_t)((r << 11) | (g << 5) | b);
+        }
+        pen += glyph->Advance;
+    }
+}
+
+/**
+ * 文字绘制：随机字符串（含字库外字符、超出屏幕右边与下边）与参考实现对比，
+ * 每个字符串只写一个窗口；开始前渲染器留有仍在发送的行带，检查两者共用完成通知计数
+ */
+static int Font_Check(uint32_t *state) {
+    char text[32];
+    uint32_t mismatches = 0;
+    uint32_t characters = 0;
+
+    Renderer_Invalidate(0, 0, ST7789_WIDTH, ST7789_HEIGHT);
+    Renderer_Flush();
+    for (uint32_t row = 0; row < ST7789_HEIGHT; row++) {
+        for (uint32_t col = 0; col < ST7789_WIDTH; col++) {
+            Panel_Expected[row][col] = Render_Pattern(col, row, RENDER_FRAMES);
+        }
+    }
+    uint32_t windows = Panel.Windows;
+    for (uint32_t i = 0; i < FONT_STRINGS; i++) {
+        uint32_t length = Sim_Random(state, sizeof(text) - 1) + 1;
+        for (uint32_t k = 0; k < length; k++) {
+            text[k] = (Sim_Random(state, 50) == 0) ? (char)0x80 : (char)(0x20 + Sim_Random(state, 95));
+        }
+        text[length] = '\0';
+        uint16_t x = (uint16_t)Sim_Random(state, ST7789_WIDTH);
+        uint16_t y = (uint16_t)Sim_Random(state, ST7789_HEIGHT);
+        uint16_t fg = (uint16_t)Sim_Random(state, 0x10000);
+        uint16_t bg = (uint16_t)Sim_Random(state, 0x10000);
+        Font_Draw_String(&Font_Mono16, x, y, text, fg, bg);
+        Font_Reference(&Font_Mono16, x, y, text, fg, bg);
+        characters += length;
+    }
+    windows = Panel.Windows - windows;
+    // 文字之后渲染器继续工作
+    Renderer_Invalidate(0, 0, 40, 40);
+    Renderer_Flush();
+    ST7789_Release();
+    Panel_Fill(0, 0, 40, 40, 0);
+    for (uint32_t row = 0; row < 40; row++) {
+        for (uint32_t col = 0; col < 40; col++) {
+            Panel_Expected[row][col] = Render_Pattern(col, row, RENDER_FRAMES);
+        }
+    }
+    for (uint32_t row = 0; row < ST7789_HEIGHT; row++) {
+        for (uint32_t col = 0; col < ST7789_WIDTH; col++) {
+            mismatches += (Panel.Frame[row][col] != Panel_Expected[row][col]);
+        }
+    }
+    int errors = (mismatches != 0) || (windows != FONT_STRINGS) || (Panel.Errors != 0);
+    Sim_Print("st7789 font strings %u characters %u windows %u mismatched pixels %u %s\n", FONT_STRINGS,
+              characters, windows, mismatches, errors ? "FAIL" : "ok");
+    return errors;
+}
+
+#define BLIT_CASES       400
+#define BLIT_MAX         40
+
+/**
+ * 逐分量的参考混合，a为0~32
+ */
+static uint16_t Blit_Reference(uint16_t f, uint16_t b, uint32_t a) {
+    uint32_t r = ((f >> 11) * a + (b >> 11) * (32 - a)) >> 5;
+    uint32_t g = (((f >> 5) & 0x3F) * a + ((b >> 5) & 0x3F) * (32 - a)) >> 5;
+    uint32_t bl = ((f & 0x1F) * a + (b & 0x1F) * (32 - a)) >> 5;
+    return (uint16_t)((r << 11) | (g << 5) | bl);
+}
+
+/**
+ * 随机目标缓冲区（起始像素奇偶随机）、随机位置（部分超出缓冲区）与行跨度的图块，
+ * 依次做填充、复制、色键、整体透明度与透明度位图绘制，与逐像素的参考结果对比
+ */
+static int Blit_Check(uint32_t *state) {
+    static uint16_t buffer[BLIT_MAX * BLIT_MAX + 3];
+    static uint16_t expected[BLIT_MAX * BLIT_MAX];
+    static uint16_t sprite[BLIT_MAX * (BLIT_MAX + 3) + 1];
+    static uint8_t alpha[BLIT_MAX * (BLIT_MAX + 3) + 1];
+    uint32_t mismatches = 0;
+    uint32_t counts[5] = { 0 };
+
+    for (uint32_t i = 0; i < BLIT_CASES; i++) {
+        uint32_t odd = Sim_Random(state, 2);
+        Blit_Target t = { &buffer[1 + odd], (uint16_t)Sim_Random(state, 200), (uint16_t)Sim_Random(state, 200),
+                          (uint16_t)(Sim_Random(state, BLIT_MAX) + 1), (uint16_t)(Sim_Random(state, BLIT_MAX) + 1) };
+        for (uint32_t k = 0; k < (uint32_t)t.Width * t.Height; k++) {
+            t.Pixels[k] = expected[k] = (uint16_t)Sim_Random(state, 0x10000);
+        }
+        t.Pixels[-1] = t.Pixels[(uint32_t)t.Width * t.Height] = 0xA5A5;
+        uint16_t w = (uint16_t)(Sim_Random(state, BLIT_MAX) + 1);
+        uint16_t h = (uint16_t)(Sim_Random(state, BLIT_MAX) + 1);
+        uint16_t stride = (uint16_t)(w + Sim_Random(state, 4));
+        uint32_t shift = Sim_Random(state, 2);
+        int16_t x = (int16_t)(t.X + (int32_t)Sim_Random(state, t.Width + w) - w);
+        int16_t y = (int16_t)(t.Y + (int32_t)Sim_Random(state, t.Height + h) - h);
+        uint16_t key = (uint16_t)Sim_Random(state, 0x10000);
+        uint16_t color = (uint16_t)Sim_Random(state, 0x10000);
+        uint8_t level = (uint8_t)Sim_Random(state, 256);
+        for (uint32_t k = 0; k < (uint32_t)stride * h; k++) {
+            sprite[shift + k] = (Sim_Random(state, 4) == 0) ? key : (uint16_t)Sim_Random(state, 0x10000);
+            uint32_t a = Sim_Random(state, 4);
+            alpha[shift + k] = (uint8_t)((a == 0) ? 0 : (a == 1) ? 255 : Sim_Random(state, 256));
+        }
+        Blit_Image image = { &sprite[shift], w, h, stride };
+        Blit_Mask mask = { &alpha[shift], w, h, stride };
+        uint32_t op = Sim_Random(state, 5);
+        counts[op]++;
+        switch (op) {
+        case 0: Blit_Fill(&t, x, y, w, h, color); break;
+        case 1: Blit_Copy(&t, &image, x, y); break;
+        case 2: Blit_Key(&t, &image, x, y, key); break;
+        case 3: Blit_Blend(&t, &image, x, y, level); break;
+        default: Blit_Draw_Mask(&t, &mask, x, y, color); break;
+        }
+        for (int32_t row = 0; row < h; row++) {
+            for (int32_t col = 0; col < w; col++) {
+                int32_t tx = x + col - t.X;
+                int32_t ty = y + row - t.Y;
+                if (tx < 0 || ty < 0 || tx >= t.Width || ty >= t.Height) {
+                    continue;
+                }
+                uint16_t *out = &expected[ty * t.Width + tx];
+                uint16_t src = sprite[shift + (uint32_t)row * stride + (uint32_t)col];
+                uint32_t a = ((uint32_t)level + 4) >> 3;
+                uint32_t m = ((uint32_t)alpha[shift + (uint32_t)row * stride + (uint32_t)col] + 4) >> 3;
+                switch (op) {
+                case 0: *out = color; break;
+                case 1: *out = src; break;
+                case 2: *out = (src == key) ? *out : src; break;
+                case 3: *out = Blit_Reference(src, *out, a); break;
+                default: *out = Blit_Reference(color, *out, m); break;
+                }
+            }
+        }
+        for (uint32_t k = 0; k < (uint32_t)t.Width * t.Height; k++) {
+            mismatches += (t.Pixels[k] != expected[k]);
+        }
+        // 缓冲区前后各一个像素检查没有写出界
+        mismatches += (t.Pixels[-1] != 0xA5A5) + (t.Pixels[(uint32_t)t.Width * t.Height] != 0xA5A5);
+    }
+    int errors = (mismatches != 0);
+    Sim_Print("st7789 blit cases %u (fill %u copy %u key %u blend %u mask %u) mismatched pixels %u %s\n", BLIT_CASES,
+              counts[0], counts[1], counts[2], counts[3], counts[4], mismatches, errors ? "FAIL" : "ok");
+    return errors;
+}
+
+#define CHART_UPDATES    300
+#define CHART_RATE       1000             // 吞吐测试的采样数
+
+static Chart Chart_Widget;
+static int16_t Chart_History[CHART_UPDATES * 300];
+
+/**
+ * 按全部历史采样画出曲线图的参考画面：CHART_SWEEP中采样n在第n % Length列，
+ * 光标前方CHART_SWEEP_GAP列为空白；CHART_SCROLL中最新的Length个采样从上到下排列
+ */
+static void Chart_Reference(const Chart *c, uint32_t total) {
+    for (uint32_t line = 0; line < c->Length; line++) {
+        int64_t n;
+        if (c->Mode == CHART_SWEEP) {
+            n = (int64_t)total - 1 - (int64_t)((total + c->Length - 1 - line) % c->Length);
+            if ((int64_t)total - n > c->Length - CHART_SWEEP_GAP) {
+                n = -1;
+            }
+        } else {
+            n = (int64_t)total - c->Length + line;
+        }
+        int32_t low = -1, high = -2;
+        if (n >= 0) {
+            int16_t v = Chart_History[n];
+            int16_t p = (n >= 1) ? Chart_History[n - 1] : v;
+            v = (v < c->Min) ? c->Min : (v > c->Max) ? c->Max : v;
+            p = (p < c->Min) ? c->Min : (p > c->Max) ? c->Max : p;
+            uint32_t a = (uint32_t)(v - c->Min) * c->Scale >> 16;
+            uint32_t b = (uint32_t)(p - c->Min) * c->Scale >> 16;
+            a = (a >= c->Span) ? c->Span - 1u : a;
+            b = (b >= c->Span) ? c->Span - 1u : b;
+            low = (int32_t)((a < b) ? a : b);
+            high = (int32_t)((a < b) ? b : a);
+        }
+        for (uint32_t i = 0; i < c->Span; i++) {
+            uint16_t color = ((int32_t)i >= low && (int32_t)i <= high) ? c->Trace
+                           : (c->Grid != 0 && i % c->Grid == 0) ? c->Grid_Color : c->Background;
+            if (c->Mode == CHART_SWEEP) {
+                Panel_Expected[c->Y + c->Height - 1 - i][c->X + line] = color;
+            } else {
+                Panel_Expected[c->Y + line][i] = color;
+            }
+        }
+    }
+}
+
+/**
+ * 两种模式各做随机批量写入与刷新（偶尔一次写入超过时间轴长度、偶尔重绘），
+ * 期间多次与参考画面对比；写入像素数不超过新采样对应的列（行）与空白之和。
+ * 最后每次刷新只写入一个采样，按仿真时间计算能维持的采样率
+ */
+static int Chart_Check(uint32_t *state) {
+    static const struct { uint8_t mode; uint16_t x, y, w, h; } layouts[2] = {
+        { CHART_SWEEP, 10, 20, 200, 100 }, { CHART_SCROLL, 0, 130, ST7789_WIDTH, 100 },
+    };
+    static const char * const names[2] = { "sweep", "scroll" };
+    int errors = 0;
+
+    for (uint32_t m = 0; m < 2; m++) {
+        Chart *c = &Chart_Widget;
+        uint32_t total = 0, mismatches = 0, budget = 0;
+        int32_t value = 0;
+        Chart_Initialize(c, layouts[m].mode, layouts[m].x, layouts[m].y, layouts[m].w, layouts[m].h, -500, 1500);
+        uint32_t visible = (c->Mode == CHART_SWEEP) ? c->Length - CHART_SWEEP_GAP : c->Length;
+        uint32_t gap = (c->Mode == CHART_SWEEP) ? CHART_SWEEP_GAP : 0;
+        uint32_t pixels = Panel.Pixels;
+        Chart_Redraw(c);
+        budget += (uint32_t)c->Length * c->Span;
+
+        for (uint32_t u = 0; u < CHART_UPDATES; u++) {
+            uint32_t count = (Sim_Random(state, 40) == 0) ? 250 + Sim_Random(state, 40) : Sim_Random(state, 12);
+            for (uint32_t k = 0; k < count; k++) {
+                value += (int32_t)Sim_Random(state, 301) - 150;
+                value = (value < -800) ? -800 : (value > 1800) ? 1800 : value;
+                Chart_History[total++] = (int16_t)value;
+                Chart_Push(c, (int16_t)value);
+            }
+            if (Chart_Update(c) != count) {
+                errors++;
+            }
+            if (count != 0) {
+                budget += ((count < visible) ? count : visible) * c->Span + gap * c->Span;
+            }
+            if (Sim_Random(state, 50) == 0) {
+                Chart_Redraw(c);
+                budget += (uint32_t)c->Length * c->Span;
+            }
+            if (u % 60 == 59 || u == CHART_UPDATES - 1) {
+                ST7789_Release();
+                Chart_Reference(c, total);
+                for (uint32_t row = c->Y; row < (uint32_t)c->Y + c->Height; row++) {
+                    for (uint32_t col = c->X; col < (uint32_t)c->X + c->Width; col++) {
+                        mismatches += (Panel.Frame[Panel_Visible(row)][col] != Panel_Expected[row][col]);
+                    }
+                }
+            }
+        }
+        pixels = Panel.Pixels - pixels;
+
+        // 仿真中DMA完成中断按节拍处理，每次刷新至少等待一个节拍，结果是目标板采样率的下限
+        uint64_t start = Sim_Now();
+        for (uint32_t k = 0; k < CHART_RATE; k++) {
+            Chart_Push(c, (int16_t)(k * 37 % 2000 - 500));
+            Chart_Update(c);
+        }
+        ST7789_Release();
+        uint64_t elapsed = Sim_Now() - start;
+
+        int failed = (mismatches != 0) || (pixels > budget) || (Panel.Errors != 0) ||
+                     (c->Mode == CHART_SCROLL && (Panel.Scroll_Top != c->Y || Panel.Scroll_Height != c->Height));
+        Sim_Print("st7789 chart %s samples %u pixels %u (budget %u) %.0f samples/s at 1 per update, "
+                  "mismatched pixels %u %s\n", names[m], total, pixels, budget,
+                  elapsed ? (double)CHART_RATE * 1e9 / (double)elapsed : 0.0, mismatches, failed ? "FAIL" : "ok");
+        errors += failed;
+    }
+    return errors;
+}
+
+#define CONSOLE_OUTPUTS  60
+
+/**
+ * 控制台的排版规则（与Console_Put相同），结果按行保存在环形数组中
+ */
+static struct {
+    char     Text[ST7789_HEIGHT][CONSOLE_COLUMNS + 1];
+    uint32_t Length[ST7789_HEIGHT];
+    uint32_t Width[ST7789_HEIGHT];
+    uint32_t Lines;                      // 已开始的行数
+} Console_Model;
+
+static void Console_Model_Put(uint32_t rows, char c) {
+    uint32_t line = (Console_Model.Lines - 1) % rows;
+    char single[2] = { c, '\0' };
+    if (c == '\r') {
+        return;
+    }
+    if (c == '\t') {
+        single[0] = c = ' ';
+    }
+    uint32_t advance = Font_Measure(&Font_Mono16, single);
+    if (c == '\n' || Console_Model.Width[line] + advance > ST7789_WIDTH ||
+        Console_Model.Length[line] == CONSOLE_COLUMNS) {
+        line = Console_Model.Lines++ % rows;
+        Console_Model.Length[line] = 0;
+        Console_Model.Width[line] = 0;
+        Console_Model.Text[line][0] = '\0';
+        if (c == '\n') {
+            return;
+        }
+    }
+    Console_Model.Text[line][Console_Model.Length[line]++] = c;
+    Console_Model.Text[line][Console_Model.Length[line]] = '\0';
+    Console_Model.Width[line] += advance;
+}
+
+/**
+ * 控制台：随机文本（含超宽自动换行、跨多次输出的行、'\t'与'\r'）经Terminal_Output镜像到屏幕，
+ * 按滚动映射读出的显示内容与参考排版对比；检查滚动区域为整数个文字行，
+ * 且写入的像素数只与新行有关（换行时不重绘整个屏幕）
+ */
+static int Console_Check(uint32_t *state) {
+    static char text[64];
+    uint32_t height = Font_Mono16.Height;
+    uint32_t rows = ST7789_HEIGHT / height;
+    uint32_t mismatches = 0;
+
+    memset(&Console_Model, 0, sizeof(Console_Model));
+    Console_Model.Lines = 1;
+    Sim_SetUnitTime(UART1, SIM_UART_FAST_NS);
+    DMA_Buffer_Manager_Initialize(&Manager, 256, DMA0, UART1, DMA_UART);
+    DMA_Buffer_Manager_SetPolicy(&Manager, DMA_BLOCK, portMAX_DELAY);
+    Terminal_Initialize(&Manager);
+    Console_Initialize();
+    uint32_t scrolls = Panel.Scrolls;
+    xTaskCreate(Console_Task, "Console", configMINIMAL_STACK_SIZE, &spi0, SIM_TEST_PRIORITY - 2, NULL);
+    vTaskDelay(1000); // 控制台任务初始化屏幕并清屏
+    uint32_t pixels = Panel.Pixels;
+    uint32_t lines = Console_Model.Lines;
+
+    for (uint32_t i = 0; i < CONSOLE_OUTPUTS; i++) {
+        uint32_t length = Sim_Random(state, 50);
+        for (uint32_t k = 0; k < length; k++) {
+            uint32_t kind = Sim_Random(state, 40);
+            text[k] = (kind == 0) ? '\t' : (kind == 1) ? '\r' : (kind == 2) ? '\n' : (char)(0x20 + Sim_Random(state, 95));
+        }
+        text[length] = '\0';
+        if (Sim_Random(state, 3) != 0) {
+            text[length++] = '\n';
+            text[length] = '\0';
+        }
+        Terminal_Output("%s", text);
+        for (uint32_t k = 0; k < length; k++) {
+            Console_Model_Put(rows, text[k]);
+        }
+        // 偶尔连续输出，多条记录在流缓冲区中一起被取出
+        vTaskDelay(Sim_Random(state, 4) == 0 ? 0 : 50);
+    }
+    vTaskDelay(200);
+    Sim_Drain(&Manager, 5000);
+    pixels = Panel.Pixels - pixels;
+    scrolls = Panel.Scrolls - scrolls;
+    lines = Console_Model.Lines - lines;
+
+    // 参考显示：最新的rows行从上到下排列，底部不足一行的部分为背景
+    uint32_t shown = (Console_Model.Lines < rows) ? Console_Model.Lines : rows;
+    Panel_Fill(0, 0, ST7789_WIDTH, ST7789_HEIGHT, CONSOLE_BACKGROUND);
+    for (uint32_t k = 0; k < shown; k++) {
+        uint32_t line = Console_Model.Lines - shown + k;
+        Font_Reference(&Font_Mono16, 0, k * height, Console_Model.Text[line % rows], CONSOLE_FOREGROUND,
+                       CONSOLE_BACKGROUND);
+    }
+    for (uint32_t row = 0; row < ST7789_HEIGHT; row++) {
+        for (uint32_t col = 0; col < ST7789_WIDTH; col++) {
+            mismatches += (Panel.Frame[Panel_Visible(row)][col] != Panel_Expected[row][col]);
+        }
+    }
+    // 每次换行清除一行并绘制一行，每次取空流缓冲区最多重绘一次未结束的行
+    uint32_t budget = (2 * lines + CONSOLE_OUTPUTS) * height * ST7789_WIDTH;
+    int errors = (mismatches != 0) || (Console_GetDropped() != 0) || (Panel.Errors != 0) ||
+                 (Panel.Scroll_Top != 0) || (Panel.Scroll_Height != rows * height) ||
+                 (scrolls != 1 + ((Console_Model.Lines > rows) ? Console_Model.Lines - rows : 0)) || (pixels > budget);
+    Sim_Print("st7789 console outputs %u lines %u scrolls %u pixels %u (budget %u) dropped %u mismatched pixels %u %s\n",
+              CONSOLE_OUTPUTS, lines, scrolls, pixels, budget, Console_GetDropped(), mismatches, errors ? "FAIL" : "ok");
+    return errors;
+}
+
+static const uint8_t Panel_Init[][2] = {
+    { ST7789_SWRESET, 0 }, { ST7789_SLPOUT, 0 }, { ST7789_COLMOD, 0x55 },
+    { ST7789_MADCTL_CMD, ST7789_MADCTL }, { ST7789_INVON, 0 }, { ST7789_NORON, 0 }, { ST7789_DISPON, 0 },
+};
+
+/**
+ * 检查初始化序列与片选（cs为片选所在端口的读取结果）
+ */
+static int Panel_Init_Check(const char *bus, BitAction cs) {
+    int errors = 0;
+    if (Panel.Log_Length != sizeof(Panel_Init) / sizeof(Panel_Init[0]) ||
+        memcmp(Panel.Log, Panel_Init, sizeof(Panel_Init)) != 0) {
+        Sim_Print("%s init sequence mismatch (%u commands)\n", bus, Panel.Log_Length);
+        errors++;
+    }
+    if (cs != Bit_SET) {
+        Sim_Print("%s chip select left active after init\n", bus);
+        errors++;
+    }
+    return errors;
+}
+
+/**
+ * 随机矩形（部分超出屏幕）与随机像素块，与参考显存对比
+ */
+static int Panel_Rects_Check(uint32_t *state, const char *bus) {
+    static uint16_t pixels[64 * 64];
+    int errors = 0;
+
+    // 随机矩形（部分超出屏幕）与随机像素块
+    ST7789_FillScreen(0x0000);
+    Panel_Fill(0, 0, ST7789_WIDTH, ST7789_HEIGHT, 0x0000);
+    for (uint32_t i = 0; i < PANEL_RECTS; i++) {
+        uint16_t x = (uint16_t)Sim_Random(state, ST7789_WIDTH + 20);
+        uint16_t y = (uint16_t)Sim_Random(state, ST7789_HEIGHT + 20);
+        uint16_t w = (uint16_t)Sim_Random(state, ST7789_WIDTH);
+        uint16_t h = (uint16_t)Sim_Random(state, ST7789_HEIGHT);
+        uint16_t color = (uint16_t)Sim_Random(state, 0x10000);
+        if (i % 4 == 3) {
+            w = (uint16_t)(w % 64 + 1);
+            h = (uint16_t)(h % 64 + 1);
+            x = (uint16_t)(x % (ST7789_WIDTH - w + 1));
+            y = (uint16_t)(y % (ST7789_HEIGHT - h + 1));
+            // 上一次Blit的像素可能仍在发送
+            ST7789_Release();
+            for (uint32_t k = 0; k < (uint32_t)w * h; k++) {
+                uint16_t pixel = (uint16_t)Sim_Random(state, 0x10000);
+                pixels[k] = pixel;
+                Panel_Expected[y + k / w][x + k % w] = pixel;
+            }
+            ST7789_Blit(x, y, w, h, pixels);
+        } else {
+            ST7789_FillRect(x, y, w, h, color);
+            if (x < ST7789_WIDTH && y < ST7789_HEIGHT) {
+                Panel_Fill(x, y, w, h, color);
+            }
+        }
+    }
+    ST7789_Release();
+
+    uint32_t mismatches = 0;
+    for (uint32_t row = 0; row < ST7789_HEIGHT; row++) {
+        for (uint32_t col = 0; col < ST7789_WIDTH; col++) {
+            mismatches += (Panel.Frame[row][col] != Panel_Expected[row][col]);
+        }
+    }
+    errors += (mismatches != 0) || (Panel.Errors != 0);
+    Sim_Print("%s commands %u rects %u mismatched pixels %u protocol errors %u %s\n", bus, Panel.Log_Length,
+              PANEL_RECTS, mismatches, Panel.Errors, errors ? "FAIL" : "ok");
+    return errors;
+}
+
+static int Scenario_St7789(void) {
+    uint32_t state = Seed;
+    int errors = 0;
+
+    Spi_Dma_Init();
+    SPI_ChunkBuffer_Init(&spi0);
+    Sim_SetTransmitCallback(Panel_Receive);
+    ST7789_Initialize(&spi0);
+    errors += Panel_Init_Check("st7789", GPIO_ReadDataBit(ST7789_CS_PORT, ST7789_CS_PIN));
+    errors += Panel_Rects_Check(&state, "st7789");
+    errors += Renderer_Check(&state);
+    errors += Font_Check(&state);
+    errors += Blit_Check(&state);
+    errors += Chart_Check(&state);
+    return errors + Console_Check(&state);
+}
+
+/**
+ * 同样的屏幕模型接在8080并口上：初始化序列、随机矩形、渲染器与文字的结果必须与SPI0相同，
+ * 每个字节恰好两次端口写入，结束后片选为高
+ */
+static int Scenario_Parallel(void) {
+    static uint16_t line[ST7789_WIDTH];
+    uint32_t state = Seed;
+    int errors = 0;
+
+    Sim_SetPinCallback(Parallel_Pin);
+    ST7789_Initialize(NULL);
+    errors += !ST7789_Parallel();
+    errors += Panel_Init_Check("parallel", GPIO_ReadDataBit(PARALLEL_8080_PORT, PARALLEL_8080_CS_PIN));
+    errors += Panel_Rects_Check(&state, "parallel");
+    errors += Renderer_Check(&state);
+    errors += Font_Check(&state);
+
+    // 全屏填充与逐行写入的端口写入次数
+    uint32_t writes = Parallel.Writes, strobes = Parallel.Strobes;
+    ST7789_FillScreen(0x1234);
+    ST7789_Release();
+    uint32_t fill_writes = Parallel.Writes - writes;
+    for (uint32_t col = 0; col < ST7789_WIDTH; col++) {
+        line[col] = (uint16_t)Sim_Random(&state, 0x10000);
+    }
+    writes = Parallel.Writes;
+    ST7789_SetWindow(0, 0, ST7789_WIDTH - 1, ST7789_HEIGHT - 1);
+    for (uint32_t row = 0; row < ST7789_HEIGHT; row++) {
+        ST7789_Write_Pixels(line, ST7789_WIDTH, 1);
+        ST7789_Wait_Pixels(1);
+    }
+    ST7789_Release();
+    uint32_t pixel_writes = Parallel.Writes - writes;
+    uint32_t mismatches = 0;
+    for (uint32_t row = 0; row < ST7789_HEIGHT; row++) {
+        for (uint32_t col = 0; col < ST7789_WIDTH; col++) {
+            mismatches += (Panel.Frame[row][col] != line[col]);
+        }
+    }
+    // 窗口命令与参数共11字节，每字节两次写入（片选随第一次写入拉低），最后一次写入拉高片选
+    uint32_t frame = 2 * (11 + 2 * ST7789_WIDTH * ST7789_HEIGHT) + 1;
+    errors += (mismatches != 0) || (fill_writes != frame) || (pixel_writes != frame) ||
+              (Parallel.Strobes - strobes != frame - 1) || (Parallel.Errors != 0) ||
+              (Panel.Errors != 0) || (GPIO_ReadDataBit(PARALLEL_8080_PORT, PARALLEL_8080_CS_PIN) != Bit_SET);
+    Sim_Print("parallel frame port writes fill %u pixels %u (expected %u) mismatched pixels %u setup errors %u %s\n",
+              fill_writes, pixel_writes, frame, mismatches, Parallel.Errors, errors ? "FAIL" : "ok");
+    Sim_SetPinCallback(NULL);
+    return errors;
+}
+
+/* flash场景 ----------------------------------------------------------------*/
+
+#define NOR_SIZE            (256u * 1024u)     // W25Q20（JEDEC ID EF 40 12）
+#define NOR_PROGRAM_NS      700000ull
+#define NOR_SECTOR_NS       20000000ull
+#define NOR_BLOCK_NS        100000000ull
+
+/**
+ * Flash模型：片选下降沿开始一条命令，发送回调中逐字节解析并在MISO上应答，
+ * 片选上升沿结束命令（写使能、启动编程与擦除）；忙期间只接受读状态寄存器，
+ * 其余命令、未写使能的编程与擦除以及SPI0不在模式0/3时收到的字节记为错误
+ */
+static struct {
+    uint8_t  Memory[NOR_SIZE];
+    uint8_t  Selected;
+    uint8_t  Command;
+    uint8_t  Write_Enable;
+    uint8_t  Rejected;                 // 本条命令因忙被忽略
+    uint32_t Index;                    // 片选有效后收到的字节数
+    uint32_t Address;
+    uint64_t Busy_Until;               // 仿真时间（纳秒）
+    uint32_t Fast_Reads;
+    uint32_t Errors;
+} Nor;
+
+static uint8_t Nor_Byte(uint8_t Mosi) {
+    uint32_t index = Nor.Index++;
+    uint8_t busy = Sim_Now() < Nor.Busy_Until;
+
+    if (index == 0) {
+        Nor.Command = Mosi;
+        Nor.Address = 0;
+        Nor.Rejected = busy && (Mosi != SPI_FLASH_READ_STATUS);
+        Nor.Errors += Nor.Rejected;
+        return 0xFF;
+    }
+    if (Nor.Rejected) {
+        return 0xFF;
+    }
+    if (Nor.Command == SPI_FLASH_READ_STATUS) {
+        return (uint8_t)((busy ? SPI_FLASH_STATUS_BUSY : 0) | (Nor.Write_Enable << 1));
+    }
+    if (Nor.Command == SPI_FLASH_JEDEC_ID) {
+        static const uint8_t id[3] = { 0xEF, 0x40, 0x12 };
+        return (index <= 3) ? id[index - 1] : 0xFF;
+    }
+    if (index <= 3) {
+        Nor.Address = (Nor.Address << 8) | Mosi;
+        return 0xFF;
+    }
+    switch (Nor.Command) {
+        case SPI_FLASH_FAST_READ:
+            Nor.Fast_Reads += (index == 4);
+            return (index >= 5) ? Nor.Memory[(Nor.Address + index - 5) % NOR_SIZE] : 0xFF;
+        case SPI_FLASH_PAGE_PROGRAM:
+            if (Nor.Write_Enable) {
+                // 页内回绕，只能把1写成0
+                Nor.Memory[((Nor.Address & ~0xFFu) | ((Nor.Address + index - 4) & 0xFFu)) % NOR_SIZE] &= Mosi;
+            }
+            return 0xFF;
+        default:
+            return 0xFF;
+    }
+}
+
+static void Nor_Receive(void * Peripheral, uint32_t Data) {
+    if (Peripheral == SPI0) {
+        // NOR Flash只支持模式0/3，模式1/2下采样边沿错误
+        uint8_t cpol = (SPI0->SPI_CON & SPI_CON_CPOL) != 0;
+        uint8_t cpha = (SPI0->SPI_CON & SPI_CON_CPHA) != 0;
+        Nor.Errors += Nor.Selected && (cpol != cpha);
+        uint8_t reply = Nor.Selected ? Nor_Byte((uint8_t)Data) : 0xFF;
+        Sim_Inject(SPI0, &reply, 1, 0);
+    }
+}
+
+static void Nor_Finish(void) {
+    uint32_t erase = 0;
+    uint64_t busy_ns = 0;
+
+    if (Nor.Index == 0 || Nor.Rejected) {
+        return;
+    }
+    if (Nor.Command == SPI_FLASH_WRITE_ENABLE) {
+        Nor.Write_Enable = 1;
+        return;
+    }
+    if (Nor.Command == SPI_FLASH_PAGE_PROGRAM) {
+        busy_ns = NOR_PROGRAM_NS;
+    } else if (Nor.Command == SPI_FLASH_SECTOR_ERASE && Nor.Index == 4) {
+        erase = SPI_FLASH_SECTOR_SIZE;
+        busy_ns = NOR_SECTOR_NS;
+    } else if (Nor.Command == SPI_FLASH_BLOCK_ERASE && Nor.Index == 4) {
+        erase = SPI_FLASH_BLOCK_SIZE;
+        busy_ns = NOR_BLOCK_NS;
+    } else {
+        return;
+    }
+    if (!Nor.Write_Enable) {
+        Nor.Errors++;
+        return;
+    }
+    if (erase != 0) {
+        memset(&Nor.Memory[(Nor.Address & ~(erase - 1)) % NOR_SIZE], 0xFF, erase);
+    }
+    Nor.Write_Enable = 0;
+    Nor.Busy_Until = Sim_Now() + busy_ns;
+}
+
+static void Nor_Pin(GPIO_TypeDef * Port, uint32_t Previous, uint32_t Current) {
+    if (Port != SPI_FLASH_CS_PORT || !((Previous ^ Current) & SPI_FLASH_CS_PIN)) {
+        return;
+    }
+    if (!(Current & SPI_FLASH_CS_PIN)) {
+        Nor.Selected = 1;
+        Nor.Index = 0;
+    } else {
+        Nor_Finish();
+        Nor.Selected = 0;
+    }
+}
+
+/**
+ * 逐字节与模型内容比较，返回不一致的字节数
+ */
+static uint32_t Flash_Compare(const uint8_t *data, uint32_t address, uint32_t length) {
+    uint32_t errors = 0;
+    for (uint32_t k = 0; k < length; k++) {
+        errors += (data[k] != Nor.Memory[address + k]);
+    }
+    return errors;
+}
+
+/**
+ * 页缓存（按SPI_FLASH_CACHE_PAGES为4设计）：命中不访问总线，满时替换最久未使用的页
+ */
+static int Flash_Cache_Check(uint32_t *state) {
+    static const uint32_t pages[] = { 16, 40, 60, 80 };
+    static uint8_t data[32];                  // SPI_Flash_Program由DMA读取，不能放在宿主线程栈上
+    SPI_Flash_Statistics stats;
+    uint32_t errors = 0;
+    const struct { uint32_t page; uint32_t offset; uint32_t length; } reads[] = {
+        { pages[0], 250, 16 },     // 跨页：两页未命中
+        { pages[0], 250, 16 },     // 两页命中
+        { pages[1], 0, 1 },        // 未命中，缓存已满
+        { pages[2], 0, 1 },
+        { pages[0], 0, 1 },        // 命中，pages[0] + 1成为最久未使用的页
+        { pages[3], 0, 1 },        // 未命中，替换pages[0] + 1
+        { pages[0], 5, 1 },        // 命中
+        { pages[0] + 1, 0, 1 },    // 未命中，替换pages[1]
+        { pages[2], 0, 1 },        // 命中
+    };
+
+    SPI_Flash_Invalidate();
+    SPI_Flash_GetStatistics(&stats, 1);
+    uint32_t fast_reads = Nor.Fast_Reads;
+    for (uint32_t i = 0; i < sizeof(reads) / sizeof(reads[0]); i++) {
+        uint32_t address = reads[i].page * SPI_FLASH_PAGE_SIZE + reads[i].offset;
+        SPI_Flash_Read_Cached(address, data, reads[i].length);
+        errors += Flash_Compare(data, address, reads[i].length);
+    }
+    SPI_Flash_GetStatistics(&stats, 0);
+    errors += (stats.Cache_Hits != 5) || (stats.Cache_Misses != 6) || (stats.Bus_Reads != 6) ||
+              (Nor.Fast_Reads - fast_reads != 6);
+    Sim_Print("flash cache %u hits %u misses %u bus reads %s\n", stats.Cache_Hits, stats.Cache_Misses,
+              stats.Bus_Reads, errors ? "FAIL" : "ok");
+
+    // 写入与擦除后缓存中的旧内容被作废
+    uint32_t coherence = 0;
+    uint32_t address = pages[0] * SPI_FLASH_PAGE_SIZE;
+    static uint8_t page[SPI_FLASH_PAGE_SIZE];
+    SPI_Flash_Read_Cached(address, page, sizeof(page));
+    SPI_Flash_Erase_Sector(address);
+    SPI_Flash_Read_Cached(address, page, sizeof(page));
+    for (uint32_t k = 0; k < sizeof(page); k++) {
+        coherence += (page[k] != 0xFF);
+    }
+    for (uint32_t k = 0; k < sizeof(data); k++) {
+        data[k] = (uint8_t)Sim_Random(state, 256);
+    }
+    SPI_Flash_Program(address + 10, data, sizeof(data));
+    SPI_Flash_Read_Cached(address, page, sizeof(page));
+    coherence += Flash_Compare(page, address, sizeof(page)) + (memcmp(&page[10], data, sizeof(data)) != 0);
+    Sim_Print("flash cache coherence after erase/program %s\n", coherence ? "FAIL" : "ok");
+    return (errors != 0) + (coherence != 0);
+}
+
+static int Scenario_Flash(void) {
+    static uint8_t data[SPI_FLASH_PAGE_SIZE * 3 + 100];
+    static uint8_t read[SPI_FLASH_BLOCK_SIZE];
+    uint32_t state = Seed;
+    uint32_t errors = 0;
+
+    for (uint32_t k = 0; k < NOR_SIZE; k++) {
+        Nor.Memory[k] = (uint8_t)Sim_Random(&state, 256);
+    }
+    Spi_Dma_Init();
+    SPI_ChunkBuffer_Init(&spi0);
+    SPI_ChunkBuffer_AttachRx(&spi0, DMA0);
+    Sim_SetTransmitCallback(Nor_Receive);
+    Sim_SetPinCallback(Nor_Pin);
+
+    uint8_t found = SPI_Flash_Initialize(&spi0);
+    const SPI_Flash_Info *info = SPI_Flash_GetInfo();
+    int probe_errors = !found || (info->Manufacturer != 0xEF) || (info->Memory_Type != 0x40) ||
+                       (info->Capacity != 0x12) || (info->Size != NOR_SIZE);
+    Sim_Print("flash probe %02X %02X %02X, %u bytes %s\n", info->Manufacturer, info->Memory_Type, info->Capacity,
+              info->Size, probe_errors ? "FAIL" : "ok");
+
+    // 直接读取：一条快速读命令，接收超过一段时由接收通道中断续传
+    uint32_t fast_reads = Nor.Fast_Reads;
+    for (uint32_t i = 0; i < 8; i++) {
+        uint32_t length = (i == 0) ? SPI_SEGMENT_MAX * 2 + 300 : Sim_Random(&state, SPI_SEGMENT_MAX * 2) + 1;
+        uint32_t address = Sim_Random(&state, NOR_SIZE - length + 1);
+        SPI_Flash_Read(address, read, length);
+        errors += Flash_Compare(read, address, length);
+    }
+    errors += (Nor.Fast_Reads - fast_reads != 8);
+    Sim_Print("flash read 8 bursts %s\n", errors ? "FAIL" : "ok");
+
+    // 擦除立即返回；之后的编程先等待擦除结束，跨页拆分
+    uint32_t sector = 2 * SPI_FLASH_BLOCK_SIZE + Sim_Random(&state, SPI_FLASH_BLOCK_SIZE / SPI_FLASH_SECTOR_SIZE) *
+                      SPI_FLASH_SECTOR_SIZE;
+    uint32_t offset = Sim_Random(&state, SPI_FLASH_SECTOR_SIZE - sizeof(data) + 1);
+    for (uint32_t k = 0; k < sizeof(data); k++) {
+        data[k] = (uint8_t)Sim_Random(&state, 256);
+    }
+    uint64_t start = Sim_Now();
+    SPI_Flash_Erase_Sector(sector + 123);
+    uint8_t busy = SPI_Flash_Busy();
+    SPI_Flash_Program(sector + offset, data, sizeof(data));
+    uint64_t elapsed = Sim_Now() - start;
+    SPI_Flash_Read(sector, read, SPI_FLASH_SECTOR_SIZE);
+    uint32_t program_errors = !busy || SPI_Flash_Busy() || (elapsed < NOR_SECTOR_NS) ||
+                              (memcmp(&read[offset], data, sizeof(data)) != 0);
+    for (uint32_t k = 0; k < SPI_FLASH_SECTOR_SIZE; k++) {
+        program_errors += (k < offset || k >= offset + sizeof(data)) && (read[k] != 0xFF);
+    }
+    Sim_Print("flash erase sector %05X, program %u bytes at +%u in %.1f ms %s\n", sector, (unsigned)sizeof(data),
+              offset, (double)elapsed / 1e6, program_errors ? "FAIL" : "ok");
+
+    // 块擦除：等待超时与完成
+    SPI_Flash_Erase_Block(SPI_FLASH_BLOCK_SIZE + Sim_Random(&state, SPI_FLASH_BLOCK_SIZE));
+    uint32_t block_errors = (SPI_Flash_Wait(pdMS_TO_TICKS(5)) != pdFALSE) ||
+                            (SPI_Flash_Wait(pdMS_TO_TICKS(1000)) != pdTRUE) || SPI_Flash_Busy();
+    SPI_Flash_Read(SPI_FLASH_BLOCK_SIZE, read, SPI_FLASH_BLOCK_SIZE);
+    for (uint32_t k = 0; k < SPI_FLASH_BLOCK_SIZE; k++) {
+        block_errors += (read[k] != 0xFF);
+    }
+    Sim_Print("flash erase block %s\n", block_errors ? "FAIL" : "ok");
+
+    int cache_errors = Flash_Cache_Check(&state);
+    SPI_Wait_Idle(&spi0);
+    int bus_errors = (Nor.Errors != 0) || Nor.Selected;
+    Sim_Print("flash protocol errors %u %s\n", Nor.Errors, bus_errors ? "FAIL" : "ok");
+    Sim_SetPinCallback(NULL);
+    Sim_SetTransmitCallback(Sim_Capture);
+    return probe_errors + (errors != 0) + (program_errors != 0) + (block_errors != 0) + cache_errors + bus_errors;
+}
+
+/* image场景 ----------------------------------------------------------------*/
+
+#define IMAGE_CASES          16
+#define IMAGE_MAX_PIXELS     (260 * 200)
+#define IMAGE_FLASH_ADDRESS  0x10000u
+
+static uint32_t Image_Source[IMAGE_MAX_PIXELS];       // R | G<<8 | B<<16 | A<<24
+static uint8_t Image_File[IMAGE_QOI_HEADER + IMAGE_MAX_PIXELS * 5 + 8];
+static Image_QOI Image_Decoder;                       // 从Flash读入时由DMA写入，不能放在仿真任务栈上
+
+static uint32_t Qoi_Hash(uint32_t pixel) {
+    return ((pixel & 0xFF) * 3 + ((pixel >> 8) & 0xFF) * 5 + ((pixel >> 16) & 0xFF) * 7 + (pixel >> 24) * 11) & 63;
+}
+
+/**
+ * 参考编码器（按qoiformat.org的规范），用于生成覆盖全部操作码的测试文件
+ */
+static uint32_t Qoi_Encode(const uint32_t *pixels, uint32_t width, uint32_t height, uint8_t *out) {
+    uint32_t index[64] = { 0 };
+    uint32_t prev = 0xFF000000u;
+    uint32_t count = width * height;
+    uint32_t n = 0, run = 0;
+
+    memcpy(out, "qoif", 4);
+    for (int k = 0; k < 4; k++) {
+        out[4 + k] = (uint8_t)(width >> (24 - 8 * k));
+        out[8 + k] = (uint8_t)(height >> (24 - 8 * k));
+    }
+    out[12] = 4;
+    out[13] = 0;
+    n = IMAGE_QOI_HEADER;
+    for (uint32_t k = 0; k < count; k++) {
+        uint32_t px = pixels[k];
+        if (px == prev) {
+            if (++run == 62 || k == count - 1) {
+                out[n++] = (uint8_t)(0xC0 | (run - 1));
+                run = 0;
+            }
+            continue;
+        }
+        if (run != 0) {
+            out[n++] = (uint8_t)(0xC0 | (run - 1));
+            run = 0;
+        }
+        uint32_t h = Qoi_Hash(px);
+        if (index[h] == px) {
+            out[n++] = (uint8_t)h;
+        } else {
+            index[h] = px;
+            if ((px >> 24) != (prev >> 24)) {
+                out[n++] = 0xFF;
+                for (int c = 0; c < 4; c++) out[n++] = (uint8_t)(px >> (8 * c));
+            } else {
+                int dr = (int8_t)(uint8_t)((px & 0xFF) - (prev & 0xFF));
+                int dg = (int8_t)(uint8_t)(((px >> 8) & 0xFF) - ((prev >> 8) & 0xFF));
+                int db = (int8_t)(uint8_t)(((px >> 16) & 0xFF) - ((prev >> 16) & 0xFF));
+                if (dr >= -2 && dr <= 1 && dg >= -2 && dg <= 1 && db >= -2 && db <= 1) {
+                    out[n++] = (uint8_t)(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2));
+                } else if (dg >= -32 && dg <= 31 && dr - dg >= -8 && dr - dg <= 7 && db - dg >= -8 && db - dg <= 7) {
+                    out[n++] = (uint8_t)(0x80 | (dg + 32));
+                    out[n++] = (uint8_t)((dr - dg + 8) << 4 | (db - dg + 8));
+                } else {
+                    out[n++] = 0xFE;
+                    for (int c = 0; c < 3; c++) out[n++] = (uint8_t)(px >> (8 * c));
+                }
+            }
+        }
+        prev = px;
+    }
+    memset(&out[n], 0, 7);
+    out[n + 7] = 1;
+    return n + 8;
+}
+
+/**
+ * 随机图片：重复像素、调色板中的颜色、小幅与中幅变化、随机颜色与透明度变化混合出现
+ */
+static void Image_Generate(uint32_t *state, uint32_t count) {
+    uint32_t palette[8];
+    uint32_t px = 0xFF000000u;
+    for (int i = 0; i < 8; i++) {
+        palette[i] = Sim_Random(state, 0x1000000) | 0xFF000000u;
+    }
+    for (uint32_t k = 0; k < count; k++) {
+        uint32_t kind = Sim_Random(state, 16);
+        uint8_t r = (uint8_t)px, g = (uint8_t)(px >> 8), b = (uint8_t)(px >> 16), a = (uint8_t)(px >> 24);
+        if (kind < 5) {
+            // 与前一像素相同
+        } else if (kind < 8) {
+            px = palette[Sim_Random(state, 8)];
+            r = (uint8_t)px, g = (uint8_t)(px >> 8), b = (uint8_t)(px >> 16), a = (uint8_t)(px >> 24);
+        } else if (kind < 11) {
+            r += Sim_Random(state, 4) - 2, g += Sim_Random(state, 4) - 2, b += Sim_Random(state, 4) - 2;
+        } else if (kind < 14) {
+            int dg = (int)Sim_Random(state, 64) - 32;
+            g += dg, r += dg + (int)Sim_Random(state, 16) - 8, b += dg + (int)Sim_Random(state, 16) - 8;
+        } else if (kind < 15) {
+            r = (uint8_t)Sim_Random(state, 256), g = (uint8_t)Sim_Random(state, 256), b = (uint8_t)Sim_Random(state, 256);
+        } else {
+            a = (uint8_t)Sim_Random(state, 256);
+        }
+        px = (uint32_t)r | ((uint32_t)g << 8) | ((uint32_t)b << 16) | ((uint32_t)a << 24);
+        Image_Source[k] = px;
+    }
+}
+
+static uint16_t Image_Rgb565(uint32_t px) {
+    return ST7789_RGB565(px & 0xFF, (px >> 8) & 0xFF, (px >> 16) & 0xFF);
+}
+
+static void Image_Receive(void * Peripheral, uint32_t Data) {
+    Panel_Receive(Peripheral, Data);
+    Nor_Receive(Peripheral, Data);
+}
+
+static void Image_Pin(GPIO_TypeDef * Port, uint32_t Previous, uint32_t Current) {
+    Panel_Pin(Port, Previous, Current);
+    Nor_Pin(Port, Previous, Current);
+}
+
+/**
+ * 随机图片（含超出屏幕右边与下边、宽于屏幕的图片）交替从程序Flash与SPI Flash显示，
+ * 与参考编码前的像素对比；逐行解码的结果整幅对比（包括屏幕外的部分）；
+ * SPI Flash读入打断片选后必须用RAMWRC继续写显存
+ */
+static int Scenario_Image(void) {
+    static uint16_t row[260];
+    uint32_t state = Seed;
+    uint32_t mismatches = 0, decode_mismatches = 0;
+    uint64_t elapsed[2] = { 0, 0 };
+    uint32_t pixels[2] = { 0, 0 }, bytes[2] = { 0, 0 }, resumes[2] = { 0, 0 };
+    int errors = 0;
+
+    memset(Nor.Memory, 0xFF, NOR_SIZE);
+    Spi_Dma_Init();
+    SPI_ChunkBuffer_Init(&spi0);
+    SPI_ChunkBuffer_AttachRx(&spi0, DMA0);
+    Sim_SetTransmitCallback(Image_Receive);
+    Sim_SetPinCallback(Image_Pin);
+    ST7789_Initialize(&spi0);
+    errors += !SPI_Flash_Initialize(&spi0);
+    ST7789_FillScreen(0x0000);
+    ST7789_Release();
+
+    for (uint32_t i = 0; i < IMAGE_CASES; i++) {
+        uint32_t width = (i == 0) ? 260 : Sim_Random(&state, 200) + 1;
+        uint32_t height = (i == 0) ? 24 : Sim_Random(&state, 200) + 1;
+        uint16_t x = (uint16_t)((i == 0) ? 0 : Sim_Random(&state, ST7789_WIDTH));
+        uint16_t y = (uint16_t)Sim_Random(&state, ST7789_HEIGHT);
+        uint32_t flash = i & 1;
+        Image_Generate(&state, width * height);
+        uint32_t length = Qoi_Encode(Image_Source, width, height, Image_File);
+
+        memcpy(Panel_Expected, Panel.Frame, sizeof(Panel_Expected));
+        for (uint32_t r = 0; r < height && y + r < ST7789_HEIGHT; r++) {
+            for (uint32_t c = 0; c < width && x + c < ST7789_WIDTH; c++) {
+                Panel_Expected[y + r][x + c] = Image_Rgb565(Image_Source[r * width + c]);
+            }
+        }
+        uint8_t opened;
+        if (flash) {
+            memcpy(&Nor.Memory[IMAGE_FLASH_ADDRESS], Image_File, length);
+            opened = Image_QOI_Open_Flash(&Image_Decoder, IMAGE_FLASH_ADDRESS);
+        } else {
+            opened = Image_QOI_Open(&Image_Decoder, Image_File, length);
+        }
+        uint32_t resumed = Panel.Resumes;
+        uint64_t start = Sim_Now();
+        uint16_t rows = Image_QOI_Draw(&Image_Decoder, x, y);
+        ST7789_Release();
+        elapsed[flash] += Sim_Now() - start;
+        resumes[flash] += Panel.Resumes - resumed;
+        pixels[flash] += rows * ((x + width > ST7789_WIDTH) ? (uint32_t)(ST7789_WIDTH - x) : width);
+        bytes[flash] += length;
+        errors += !opened || (rows != ((y + height > ST7789_HEIGHT) ? (uint32_t)(ST7789_HEIGHT - y) : height));
+        for (uint32_t r = 0; r < ST7789_HEIGHT; r++) {
+            for (uint32_t c = 0; c < ST7789_WIDTH; c++) {
+                mismatches += (Panel.Frame[r][c] != Panel_Expected[r][c]);
+            }
+        }
+
+        // 逐行解码整幅图片
+        Image_QOI_Open(&Image_Decoder, Image_File, length);
+        for (uint32_t r = 0; r < height; r++) {
+            Image_QOI_Decode_Row(&Image_Decoder, row, (uint16_t)width);
+            for (uint32_t c = 0; c < width; c++) {
+                decode_mismatches += (row[c] != Image_Rgb565(Image_Source[r * width + c]));
+            }
+        }
+    }
+    // 文件头校验
+    Image_File[0] = 'Q';
+    errors += Image_QOI_Open(&Image_Decoder, Image_File, IMAGE_QOI_HEADER + 8);
+    errors += Image_QOI_Open(&Image_Decoder, Image_File, IMAGE_QOI_HEADER - 1);
+
+    SPI_Wait_Idle(&spi0);
+    errors += (mismatches != 0) || (decode_mismatches != 0) || (Panel.Errors != 0) || (Nor.Errors != 0) ||
+              (resumes[0] != 0) || (resumes[1] == 0);
+    for (uint32_t flash = 0; flash < 2; flash++) {
+        Sim_Print("image %s %u bytes -> %u pixels in %.1f ms simulated, %u RAMWRC\n", flash ? "spi flash" : "memory",
+                  bytes[flash], pixels[flash], (double)elapsed[flash] / 1e6, resumes[flash]);
+    }
+    Sim_Print("image cases %u mismatched pixels %u decoded row mismatches %u protocol errors %u/%u %s\n", IMAGE_CASES,
+              mismatches, decode_mismatches, Panel.Errors, Nor.Errors, errors ? "FAIL" : "ok");
+    Sim_SetPinCallback(NULL);
+    Sim_SetTransmitCallback(Sim_Capture);
+    return errors;
+}
+
+/* bench场景 ----------------------------------------------------------------*/
+
+#define BENCH_ITERATIONS 200000
+#define BENCH_BYTES      (40 * 1024)
+
+static int Scenario_Bench(void) {
+    char text[96];
+    volatile int sink = 0;
+
+    // 主机侧调用开销：只反映算法相对开销，不代表Cortex-M0+上的周期数
+    uint64_t begin = Sim_Host_Ns();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        sink += Terminal_Snprintf(text, sizeof(text), "S%u %d %s %x\n", (unsigned)i, -i, "bench", (unsigned)i);
+    }
+    uint64_t terminal_ns = Sim_Host_Ns() - begin;
+    begin = Sim_Host_Ns();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+        sink += snprintf(text, sizeof(text), "S%u %d %s %x\n", (unsigned)i, -i, "bench", (unsigned)i);
+    }
+    uint64_t libc_ns = Sim_Host_Ns() - begin;
+    Sim_Print("bench format Terminal_Snprintf %.1f ns/call, snprintf %.1f ns/call\n",
+              (double)terminal_ns / BENCH_ITERATIONS, (double)libc_ns / BENCH_ITERATIONS);
+
+    // 115200波特率下整个链路的利用率：发送固定数据量所需的仿真时间与理论时间之比
+    static uint8_t chunk[48];
+    memset(chunk, 'b', sizeof(chunk));
+    for (uint32_t streaming = 0; streaming < 2; streaming++) {
+        DMA_Buffer_Manager_Initialize(&Manager, 512, DMA0, UART1, DMA_UART);
+        DMA_Buffer_Manager_SetPolicy(&Manager, DMA_BLOCK, portMAX_DELAY);
+        DMA_Buffer_Manager_SetStreaming(&Manager, streaming ? ENABLE : DISABLE);
+        Sim_Capture_Reset(UART1);
+        uint32_t interrupts = Sim_GetInterruptCount(DMA0);
+        uint64_t start = Sim_Now();
+        for (uint32_t sent = 0; sent < BENCH_BYTES; sent += sizeof(chunk)) {
+            DMA_Buffer_Manager_Input(&Manager, chunk, sizeof(chunk));
+        }
+        Sim_Drain(&Manager, 10000);
+        double elapsed = (double)(Sim_Now() - start) / 1e9;
+        double ideal = (double)Capture_Length * 86806e-9;
+        Sim_Print("bench uart %-9s %u bytes in %.3f s simulated, utilisation %.1f%%, %u DMA interrupts\n",
+                  streaming ? "streaming" : "segmented", Capture_Length, elapsed, 100.0 * ideal / elapsed,
+                  Sim_GetInterruptCount(DMA0) - interrupts);
+    }
+    (void)sink;
+    return 0;
+}
+
+/* 入口 ---------------------------------------------------------------------*/
+
+static Sim_Scenario Scenario;
+static const char *Scenario_Name;
+
+static void vTask_Test(void *pvParameters) {
+    int failures = Scenario();
+    Sim_Print("%s: %s (seed %u)\n", Scenario_Name, failures ? "FAILED" : "passed", Seed);
+    exit(failures ? 1 : 0);
+}
+
+int main(int argc, char **argv) {
+    static const struct { const char *name; Sim_Scenario run; } scenarios[] = {
+        { "buffer", Scenario_Buffer },
+        { "terminal", Scenario_Terminal },
+        { "receive", Scenario_Receive },
+        { "spi", Scenario_Spi },
+        { "st7789", Scenario_St7789 },
+        { "parallel", Scenario_Parallel },
+        { "flash", Scenario_Flash },
+        { "image", Scenario_Image },
+        { "bench", Scenario_Bench },
+    };
+
+    for (uint32_t i = 0; argc > 1 && i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        if (strcmp(argv[1], scenarios[i].name) == 0) {
+            Scenario = scenarios[i].run;
+            Scenario_Name = scenarios[i].name;
+        }
+    }
+    if (Scenario == NULL) {
+        fprintf(stderr, "usage: %s buffer|terminal|receive|spi|st7789|parallel|flash|image|bench [seed]\n", argv[0]);
+        return 2;
+    }
+    if (argc > 2) {
+        Seed = (uint32_t)strtoul(argv[2], NULL, 0);
+    }
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    Sim_Reset();
+    Sim_SetTransmitCallback(Sim_Capture);
+    xTaskCreate(vTask_Simulation_Clock, "Clock", configMINIMAL_STACK_SIZE, NULL, SIM_CLOCK_PRIORITY, NULL);
+    xTaskCreate(vTask_Test, "Test", configMINIMAL_STACK_SIZE * 4, NULL, SIM_TEST_PRIORITY + 1, NULL);
+    vTaskStartScheduler();
+    return 1;
+}
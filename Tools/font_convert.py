@@ -0,0 +1,254 @@
+#!/usr/bin/env python3
+"""
+字库转换工具：把TTF/OTF或BDF字体转换为固件使用的游程编码抗锯齿字库（对应Apps/Font.h）
+
+每个字形裁剪到有墨迹的最小矩形，像素量化为4位透明度（0透明，15不透明），
+按行优先顺序编码为半字节流（高半字节在前，段可以跨行）：
+    每段 透明像素数S(0~15) | 字面像素数K(0~15) | K个透明度
+小字号抗锯齿字形的边缘几乎都是中间透明度，逐值游程反而比原始数据大，
+因此只对透明像素做游程，墨迹部分按4位原样存放；字面像素之间单个的透明像素直接写成0。
+TTF/OTF由Pillow光栅化（抗锯齿），BDF为点阵字体，像素只有0和15两种透明度。
+
+用法：
+    font_convert.py SourceCodePro-Regular.ttf --size 16 --name Mono16 -o Keil_C/Apps/Font_Mono16.c \
+        --notice "Source Code Pro: Copyright 2010, 2012 Adobe Systems Incorporated, SIL Open Font License 1.1"
+    font_convert.py terminus.bdf --name Terminus16 -o Keil_C/Apps/Font_Terminus16.c --preview AgQ
+生成的字库需在Font.h中声明：extern const Font Font_<name>;
+"""
+
+import argparse
+import os
+import sys
+
+ALPHA_MAX = 15
+SPAN_MAX = 15
+
+
+class Glyph:
+    def __init__(self, code, width, height, x_offset, y_offset, advance, alpha):
+        self.code = code
+        self.width = width
+        self.height = height
+        self.x_offset = x_offset
+        self.y_offset = y_offset   # 位图顶部相对行顶的距离
+        self.advance = advance
+        self.alpha = alpha         # width * height个0~15的值，行优先
+
+
+def trim(code, width, height, x_offset, y_offset, advance, alpha):
+    """裁掉四周全透明的行列，空白字形保留0x0位图"""
+    rows = [r for r in range(height) if any(alpha[r * width:(r + 1) * width])]
+    cols = [c for c in range(width) if any(alpha[r * width + c] for r in range(height))]
+    if not rows:
+        return Glyph(code, 0, 0, 0, 0, advance, [])
+    top, bottom, left, right = rows[0], rows[-1] + 1, cols[0], cols[-1] + 1
+    cropped = [alpha[r * width + c] for r in range(top, bottom) for c in range(left, right)]
+    return Glyph(code, right - left, bottom - top, x_offset + left, y_offset + top, advance, cropped)
+
+
+def load_truetype(path, size, codes):
+    try:
+        from PIL import Image, ImageDraw, ImageFont
+    except ImportError:
+        sys.exit('TTF/OTF conversion needs Pillow (pip install pillow)')
+    font = ImageFont.truetype(path, size)
+    ascent, descent = font.getmetrics()
+    glyphs = []
+    for code in codes:
+        ch = chr(code)
+        left, top, right, bottom = font.getbbox(ch)   # 相对原点（行顶、笔位置）
+        advance = int(round(font.getlength(ch)))
+        width, height = max(right - left, 0), max(bottom - top, 0)
+        if width == 0 or height == 0:
+            glyphs.append(Glyph(code, 0, 0, 0, 0, advance, []))
+            continue
+        image = Image.new('L', (width, height), 0)
+        ImageDraw.Draw(image).text((-left, -top), ch, font=font, fill=255)
+        alpha = [(v * ALPHA_MAX + 127) // 255 for v in image.tobytes()]
+        glyphs.append(trim(code, width, height, left, top, advance, alpha))
+    return ascent + descent, ascent, glyphs
+
+
+def load_bdf(path, codes):
+    ascent = descent = None
+    glyphs = {}
+    with open(path, encoding='latin-1') as f:
+        lines = iter(f.read().splitlines())
+    for line in lines:
+        fields = line.split()
+        if not fields:
+            continue
+        if fields[0] == 'FONT_ASCENT':
+            ascent = int(fields[1])
+        elif fields[0] == 'FONT_DESCENT':
+            descent = int(fields[1])
+        elif fields[0] == 'STARTCHAR':
+            code = advance = None
+            bbx = (0, 0, 0, 0)
+            for line in lines:
+                fields = line.split()
+                if fields[0] == 'ENCODING':
+                    code = int(fields[1])
+                elif fields[0] == 'DWIDTH':
+                    advance = int(fields[1])
+                elif fields[0] == 'BBX':
+                    bbx = tuple(int(v) for v in fields[1:5])
+                elif fields[0] == 'BITMAP':
+                    break
+            width, height, x_offset, y_offset = bbx
+            bits = []
+            for row in range(height):
+                value = int(next(lines), 16)
+                padded = (width + 7) // 8 * 8
+                bits += [ALPHA_MAX if value & (1 << (padded - 1 - c)) else 0 for c in range(width)]
+            if code in codes:
+                glyphs[code] = (width, height, x_offset, y_offset, advance, bits)
+    if ascent is None or descent is None:
+        sys.exit('%s: missing FONT_ASCENT/FONT_DESCENT' % path)
+    result = []
+    for code in codes:
+        if code not in glyphs:
+            sys.exit('%s: no glyph for 0x%02X' % (path, code))
+        width, height, x_offset, y_offset, advance, bits = glyphs[code]
+        # BDF的y偏移是位图底边相对基线（向上为正）
+        result.append(trim(code, width, height, x_offset, ascent - (y_offset + height), advance, bits))
+    return ascent + descent, ascent, result
+
+
+def encode(alpha):
+    nibbles = []
+    i = 0
+    while i < len(alpha):
+        skip = 0
+        while i < len(alpha) and alpha[i] == 0 and skip < SPAN_MAX:
+            skip += 1
+            i += 1
+        literal = []
+        while i < len(alpha) and len(literal) < SPAN_MAX:
+            if alpha[i] != 0:
+                literal.append(alpha[i])
+            elif i + 1 < len(alpha) and alpha[i + 1] != 0 and len(literal) < SPAN_MAX - 1:
+                literal.append(0)   # 单个透明像素写成字面值比新开一段少一个半字节
+            else:
+                break
+            i += 1
+        nibbles += [skip, len(literal)] + literal
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return bytes((nibbles[k] << 4) | nibbles[k + 1] for k in range(0, len(nibbles), 2))
+
+
+def decode(data, count):
+    nibbles = [v for byte in data for v in (byte >> 4, byte & 0x0F)]
+    alpha = []
+    k = 0
+    while len(alpha) < count:
+        skip, literal = nibbles[k], nibbles[k + 1]
+        alpha += [0] * skip + nibbles[k + 2:k + 2 + literal]
+        k += 2 + literal
+    return alpha[:count]
+
+
+def preview(glyphs, first, text, line_height):
+    """按固件的排版规则把text画成字符图，用于检查度量"""
+    width = sum(glyphs[ord(ch) - first].advance for ch in text)
+    canvas = [[0] * width for _ in range(line_height)]
+    pen = 0
+    for ch in text:
+        g = glyphs[ord(ch) - first]
+        alpha = decode(g.encoded, g.width * g.height)
+        for r in range(g.height):
+            for c in range(g.width):
+                x, y = pen + g.x_offset + c, g.y_offset + r
+                if 0 <= x < width and 0 <= y < line_height and alpha[r * g.width + c]:
+                    canvas[y][x] = alpha[r * g.width + c]
+        pen += g.advance
+    shades = ' .:-=+*#%@@@@@@@'
+    for row in canvas:
+        print(''.join(shades[v] for v in row).rstrip())
+
+
+def check_range(glyph, name, value, low, high):
+    if not low <= value <= high:
+        sys.exit('glyph 0x%02X: %s %d out of range %d..%d' % (glyph.code, name, value, low, high))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a TTF/OTF/BDF font into a run-length encoded glyph atlas.')
+    parser.add_argument('font', help='.ttf/.otf (needs Pillow) or .bdf')
+    parser.add_argument('--size', type=int, default=16, help='pixel size for TTF/OTF (default 16)')
+    parser.add_argument('--name', required=True, help='atlas name, the C symbol is Font_<name>')
+    parser.add_argument('--first', type=lambda v: int(v, 0), default=0x20, help='first code (default 0x20)')
+    parser.add_argument('--last', type=lambda v: int(v, 0), default=0x7E, help='last code (default 0x7E)')
+    parser.add_argument('-o', '--output', help='output .c file (default stdout)')
+    parser.add_argument('--notice', help='copyright/license line copied into the file comment')
+    parser.add_argument('--preview', metavar='TEXT', help='print TEXT rendered from the encoded atlas to stderr')
+    args = parser.parse_args()
+
+    codes = list(range(args.first, args.last + 1))
+    if os.path.splitext(args.font)[1].lower() == '.bdf':
+        line_height, ascent, glyphs = load_bdf(args.font, codes)
+        source = '%s' % os.path.basename(args.font)
+    else:
+        line_height, ascent, glyphs = load_truetype(args.font, args.size, codes)
+        source = '%s %dpx' % (os.path.basename(args.font), args.size)
+
+    data = bytearray()
+    raw = 0
+    for g in glyphs:
+        check_range(g, 'width', g.width, 0, 255)
+        check_range(g, 'height', g.height, 0, 255)
+        check_range(g, 'x offset', g.x_offset, -128, 127)
+        check_range(g, 'y offset', g.y_offset, -128, 127)
+        check_range(g, 'advance', g.advance, 0, 255)
+        g.encoded = encode(g.alpha)
+        assert decode(g.encoded, len(g.alpha)) == g.alpha
+        g.offset = len(data)
+        data += g.encoded
+        raw += (len(g.alpha) + 1) // 2
+    check_range(glyphs[0], 'line height', line_height, 1, 255)
+
+    symbol = 'Font_%s' % args.name
+    out = []
+    out.append('/**')
+    out.append(' * @file %s.c' % symbol)
+    out.append(' * @brief 字库：%s，字符0x%02X~0x%02X，行高%d像素' % (source, args.first, args.last, line_height))
+    out.append(' * @note 由Tools/font_convert.py生成，不要手工修改；')
+    out.append(' *       编码后%d字节（4位透明度未压缩为%d字节）' % (len(data), raw))
+    if args.notice:
+        out.append(' *       %s' % args.notice)
+    out.append(' */')
+    out.append('')
+    out.append('#include "Font.h"')
+    out.append('')
+    out.append('static const uint8_t %s_Data[%d] = {' % (symbol, max(len(data), 1)))
+    for i in range(0, len(data), 16):
+        out.append('\t' + ', '.join('0x%02X' % b for b in data[i:i + 16]) + ',')
+    out.append('};')
+    out.append('')
+    out.append('static const Font_Glyph %s_Glyphs[%d] = {' % (symbol, len(glyphs)))
+    for g in glyphs:
+        label = chr(g.code) if 0x20 < g.code < 0x7F and chr(g.code) != '\\' else '0x%02X' % g.code
+        out.append('\t{ %5d, %3d, %3d, %3d, %3d, %3d }, // %s' %
+                   (g.offset, g.width, g.height, g.x_offset, g.y_offset, g.advance, label))
+    out.append('};')
+    out.append('')
+    out.append('const Font %s = { %s_Data, %s_Glyphs, 0x%02X, %d, %d, %d };' %
+               (symbol, symbol, symbol, args.first, len(glyphs), line_height, ascent))
+    text = '\n'.join(out) + '\n'
+
+    if args.output:
+        with open(args.output, 'w', encoding='utf-8', newline='\n') as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+    print('%s: %d glyphs, line height %d, %d bytes encoded (%d bytes raw 4-bit)' %
+          (symbol, len(glyphs), line_height, len(data), raw), file=sys.stderr)
+    if args.preview:
+        stdout, sys.stdout = sys.stdout, sys.stderr
+        preview(glyphs, args.first, args.preview, line_height)
+        sys.stdout = stdout
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+"""
+图片转换工具：把PNG（或Pillow能读取的其他格式）转换为固件使用的QOI图片（对应Apps/Image.h）
+
+输出标准QOI文件（https://qoiformat.org），可以直接写入SPI Flash，也可以生成C数组放在程序Flash中。
+屏幕是RGB565，默认先把像素量化到RGB565再编码：显示时低位反正被丢弃，
+量化后相邻像素更容易完全相同，游程与索引编码的比例更高，文件更小。
+带透明度的图片先与--background指定的颜色合成，输出3通道QOI。
+
+用法：
+    image_convert.py logo.png -o logo.qoi                          # 写入SPI Flash的文件
+    image_convert.py logo.png --name Logo -o Keil_C/Apps/Image_Logo.c   # 程序Flash中的C数组
+    image_convert.py --test-card 128x96 --name TestCard -o Keil_C/Apps/Image_TestCard.c
+生成的C数组需在Image.h中声明：extern const uint8_t Image_<name>[]; extern const uint32_t Image_<name>_Size;
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+QOI_OP_INDEX = 0x00
+QOI_OP_DIFF = 0x40
+QOI_OP_LUMA = 0x80
+QOI_OP_RUN = 0xC0
+QOI_OP_RGB = 0xFE
+QOI_END = bytes(7) + b'\x01'
+
+
+def qoi_hash(r, g, b, a):
+    return (r * 3 + g * 5 + b * 7 + a * 11) % 64
+
+
+def encode(width, height, pixels):
+    """按QOI规范编码，pixels为width*height个(r, g, b)"""
+    out = bytearray(b'qoif' + struct.pack('>IIBB', width, height, 3, 0))
+    index = [(0, 0, 0, 0)] * 64
+    prev = (0, 0, 0, 255)
+    run = 0
+    for k, (r, g, b) in enumerate(pixels):
+        px = (r, g, b, 255)
+        if px == prev:
+            run += 1
+            if run == 62 or k == len(pixels) - 1:
+                out.append(QOI_OP_RUN | (run - 1))
+                run = 0
+            continue
+        if run:
+            out.append(QOI_OP_RUN | (run - 1))
+            run = 0
+        h = qoi_hash(*px)
+        if index[h] == px:
+            out.append(QOI_OP_INDEX | h)
+        else:
+            index[h] = px
+            dr = (r - prev[0] + 128) % 256 - 128
+            dg = (g - prev[1] + 128) % 256 - 128
+            db = (b - prev[2] + 128) % 256 - 128
+            dr_dg, db_dg = dr - dg, db - dg
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(QOI_OP_DIFF | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr_dg <= 7 and -8 <= db_dg <= 7:
+                out += bytes((QOI_OP_LUMA | (dg + 32), (dr_dg + 8) << 4 | (db_dg + 8)))
+            else:
+                out += bytes((QOI_OP_RGB, r, g, b))
+        prev = px
+    return bytes(out + QOI_END)
+
+
+def decode(data):
+    """参考解码，用于校验编码结果，返回(width, height, [(r, g, b)])"""
+    width, height = struct.unpack('>II', data[4:12])
+    index = [(0, 0, 0, 0)] * 64
+    r, g, b, a = 0, 0, 0, 255
+    pixels = []
+    p = 14
+    run = 0
+    while len(pixels) < width * height:
+        if run:
+            run -= 1
+        else:
+            op = data[p]
+            p += 1
+            if op == QOI_OP_RGB:
+                r, g, b = data[p:p + 3]
+                p += 3
+            elif op == 0xFF:
+                r, g, b, a = data[p:p + 4]
+                p += 4
+            elif op >> 6 == 0:
+                r, g, b, a = index[op]
+            elif op >> 6 == 1:
+                r = (r + ((op >> 4) & 3) - 2) % 256
+                g = (g + ((op >> 2) & 3) - 2) % 256
+                b = (b + (op & 3) - 2) % 256
+            elif op >> 6 == 2:
+                dg = (op & 0x3F) - 32
+                r = (r + dg - 8 + (data[p] >> 4)) % 256
+                g = (g + dg) % 256
+                b = (b + dg - 8 + (data[p] & 0x0F)) % 256
+                p += 1
+            else:
+                run = op & 0x3F
+        index[qoi_hash(r, g, b, a)] = (r, g, b, a)
+        pixels.append((r, g, b))
+    return width, height, pixels
+
+
+def test_card(width, height):
+    """测试图：彩条、色相渐变、纵向灰度渐变、黑白细格与横向灰度渐变，覆盖QOI的各种编码"""
+    bars = [(255, 255, 255), (255, 255, 0), (0, 255, 255), (0, 255, 0),
+            (255, 0, 255), (255, 0, 0), (0, 0, 255), (0, 0, 0)]
+    pixels = []
+    for y in range(height):
+        for x in range(width):
+            band = y * 4 // height
+            if band == 0:
+                pixel = bars[x * len(bars) // width]
+            elif band == 1:
+                h = x * 6 * 256 // width
+                rise, fall = h % 256, 255 - h % 256
+                pixel = [(255, rise, 0), (fall, 255, 0), (0, 255, rise),
+                         (0, fall, 255), (rise, 0, 255), (255, 0, fall)][min(h // 256, 5)]
+            elif band == 2:
+                v = (y - height // 2) * 255 // max(height // 4 - 1, 1)
+                pixel = (v, v, v)
+            elif x < width // 2:
+                pixel = (255, 255, 255) if (x // 2 + y // 2) % 2 else (0, 0, 0)
+            else:
+                v = (x - width // 2) * 255 // max(width - width // 2 - 1, 1)
+                pixel = (v, v, v)
+            pixels.append(pixel)
+    return pixels
+
+
+def load(path, background, size):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit('image conversion needs Pillow (pip install pillow)')
+    image = Image.open(path)
+    if size:
+        image.thumbnail(size)
+    image = image.convert('RGBA')
+    flat = Image.new('RGBA', image.size, background + (255,))
+    flat.alpha_composite(image)
+    return image.size[0], image.size[1], list(flat.convert('RGB').getdata())
+
+
+def parse_size(text):
+    try:
+        width, height = (int(v) for v in text.lower().split('x'))
+    except ValueError:
+        raise argparse.ArgumentTypeError('expected WIDTHxHEIGHT')
+    if not (0 < width <= 0xFFFF and 0 < height <= 0xFFFF):
+        raise argparse.ArgumentTypeError('size out of range')
+    return width, height
+
+
+def parse_color(text):
+    value = int(text.lstrip('#'), 16)
+    return (value >> 16) & 0xFF, (value >> 8) & 0xFF, value & 0xFF
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert an image into a QOI file or C array for Apps/Image.')
+    parser.add_argument('image', nargs='?', help='input image (needs Pillow)')
+    parser.add_argument('--test-card', type=parse_size, metavar='WxH', help='generate a test card instead of reading an image')
+    parser.add_argument('--fit', type=parse_size, metavar='WxH', help='shrink the image to fit WxH, keeping the aspect ratio')
+    parser.add_argument('--background', type=parse_color, default=(0, 0, 0), help='RRGGBB under transparent pixels (default 000000)')
+    parser.add_argument('--keep-precision', action='store_true', help='do not quantise to RGB565 before encoding')
+    parser.add_argument('--name', help='C array name, the symbol is Image_<name>; without it a raw .qoi file is written')
+    parser.add_argument('-o', '--output', required=True, help='output .qoi or .c file')
+    args = parser.parse_args()
+
+    if args.test_card:
+        width, height = args.test_card
+        pixels = test_card(width, height)
+        source = 'test card'
+    elif args.image:
+        width, height, pixels = load(args.image, args.background, args.fit)
+        source = os.path.basename(args.image)
+    else:
+        parser.error('an input image or --test-card is required')
+    if not args.keep_precision:
+        pixels = [(r & 0xF8, g & 0xFC, b & 0xF8) for r, g, b in pixels]
+
+    data = encode(width, height, pixels)
+    assert decode(data) == (width, height, pixels)
+    raw = width * height * 2
+
+    if args.name is None:
+        with open(args.output, 'wb') as f:
+            f.write(data)
+    else:
+        symbol = 'Image_%s' % args.name
+        out = []
+        out.append('/**')
+        out.append(' * @file %s.c' % symbol)
+        out.append(' * @brief 图片：%s，%dx%d，QOI格式' % (source, width, height))
+        out.append(' * @note 由Tools/image_convert.py生成，不要手工修改；')
+        out.append(' *       %d字节（RGB565原始数据为%d字节）' % (len(data), raw))
+        out.append(' */')
+        out.append('')
+        out.append('#include "Image.h"')
+        out.append('')
+        out.append('const uint8_t %s[%d] = {' % (symbol, len(data)))
+        for i in range(0, len(data), 16):
+            out.append('\t' + ', '.join('0x%02X' % b for b in data[i:i + 16]) + ',')
+        out.append('};')
+        out.append('')
+        out.append('const uint32_t %s_Size = sizeof(%s);' % (symbol, symbol))
+        with open(args.output, 'w', encoding='utf-8', newline='\n') as f:
+            f.write('\n'.join(out) + '\n')
+    print('%s: %dx%d, %d bytes QOI (%d bytes raw RGB565, %.1f%%)' %
+          (args.output, width, height, len(data), raw, 100.0 * len(data) / raw), file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
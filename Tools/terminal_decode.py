@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""
+Terminal二进制日志解码工具（对应固件中TERMINAL_DEFERRED=1）
+
+固件只输出格式字符串地址和原始参数，格式字符串本身从Keil生成的axf(ELF)文件中读取。
+记录格式：
+    0xA5 | 格式字符串地址(3字节,小端) | 参数长度(1字节) | 参数
+    数值参数4字节小端，%c为1字节，%s为以0结尾的字符串
+记录之外的ASCII字节按原样输出，其余字节丢弃。
+
+用法：
+    terminal_decode.py Keil_C/Output/NBK2002.axf capture.bin
+    stty -F /dev/ttyUSB0 115200 raw && terminal_decode.py Keil_C/Output/NBK2002.axf /dev/ttyUSB0
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+RECORD_MAGIC = 0xA5
+RECORD_HEADER = 5
+
+# 与Terminal_Format一致：%[-0][width][.precision][l]conversion
+SPEC_PATTERN = re.compile(r'%([-0]*)(\d*)(\.\d*)?(l?)([a-zA-Z%]?)')
+
+
+class Image:
+    """从ELF文件中读取已分配节的内容，按地址查找字符串"""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            data = f.read()
+        if data[:4] != b'\x7fELF':
+            raise ValueError('%s is not an ELF file' % path)
+        is64 = data[4] == 2
+        endian = '<' if data[5] == 1 else '>'
+        if is64:
+            shoff, = struct.unpack_from(endian + 'Q', data, 0x28)
+            shentsize, shnum = struct.unpack_from(endian + 'HH', data, 0x3A)
+            layout = endian + 'IIQQQQIIQQ'
+        else:
+            shoff, = struct.unpack_from(endian + 'I', data, 0x20)
+            shentsize, shnum = struct.unpack_from(endian + 'HH', data, 0x2E)
+            layout = endian + 'IIIIIIIIII'
+        self.sections = []
+        for i in range(shnum):
+            fields = struct.unpack_from(layout, data, shoff + i * shentsize)
+            sh_type, sh_flags, sh_addr, sh_offset, sh_size = fields[1:6]
+            # SHT_PROGBITS且SHF_ALLOC
+            if sh_type == 1 and (sh_flags & 0x2) and sh_size:
+                self.sections.append((sh_addr, data[sh_offset:sh_offset + sh_size]))
+
+    def string(self, address):
+        for base, content in self.sections:
+            # 记录中只有地址的低24位
+            offset = address - (base & 0xFFFFFF)
+            if 0 <= offset < len(content):
+                end = content.find(b'\0', offset)
+                if end < 0:
+                    end = len(content)
+                return content[offset:end].decode('utf-8', 'replace')
+        return None
+
+
+def render(fmt, payload):
+    """按格式字符串消费参数并生成文本"""
+    out = []
+    pos = 0
+    last = 0
+    for m in SPEC_PATTERN.finditer(fmt):
+        out.append(fmt[last:m.start()])
+        last = m.end()
+        flags, width, precision, _, conv = m.groups()
+        spec = '%' + flags + width + (precision or '')
+        if conv == '%':
+            out.append('%')
+        elif conv == 's':
+            end = payload.find(b'\0', pos)
+            if end < 0:
+                end = len(payload)
+            out.append((spec + 's') % payload[pos:end].decode('utf-8', 'replace'))
+            pos = end + 1
+        elif conv == 'c':
+            out.append((spec + 'c') % payload[pos])
+            pos += 1
+        elif conv in 'diuxXp':
+            value, = struct.unpack_from('<I', payload, pos)
+            pos += 4
+            if conv in 'di':
+                value -= (value & 0x80000000) << 1
+                out.append((spec + 'd') % value)
+            elif conv == 'u':
+                out.append((spec + 'd') % value)
+            elif conv == 'p':
+                out.append('0x%08x' % value)
+            else:
+                out.append((spec + conv) % value)
+        else:
+            out.append(m.group(0))
+    out.append(fmt[last:])
+    return ''.join(out)
+
+
+def decode(image, stream, write):
+    buffer = bytearray()
+    while True:
+        chunk = stream.read(1 if stream.isatty() else 4096)
+        if not chunk:
+            break
+        buffer += chunk
+        while buffer:
+            if buffer[0] != RECORD_MAGIC:
+                if buffer[0] < 0x80 and buffer[0] != 0:
+                    write(chr(buffer[0]))
+                del buffer[0]
+                continue
+            if len(buffer) < RECORD_HEADER:
+                break
+            length = RECORD_HEADER + buffer[4]
+            if len(buffer) < length:
+                break
+            address = buffer[1] | (buffer[2] << 8) | (buffer[3] << 16)
+            fmt = image.string(address)
+            payload = bytes(buffer[RECORD_HEADER:length])
+            try:
+                text = render(fmt, payload) if fmt is not None else None
+            except (struct.error, IndexError, ValueError):
+                text = None
+            if text is None:
+                write('<bad record @0x%06x: %s>\n' % (address, payload.hex()))
+            else:
+                write(text)
+            del buffer[:length]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode deferred Terminal log records.')
+    parser.add_argument('elf', help='firmware image (.axf/.elf) containing the format strings')
+    parser.add_argument('input', nargs='?', default='-', help='capture file or serial device, - for stdin')
+    args = parser.parse_args()
+
+    image = Image(args.elf)
+    stream = sys.stdin.buffer if args.input == '-' else open(args.input, 'rb', buffering=0)
+
+    def write(text):
+        sys.stdout.write(text)
+        sys.stdout.flush()
+
+    try:
+        decode(image, stream, write)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""
+Terminal并发压力测试结果校验工具（对应固件Benchmark_Terminal_Stress）
+
+逐行检查串口捕获的文本：
+    [节拍 任务名] 前缀可选
+    S<编号> <序号> <填充>，填充由编号和序号唯一确定
+任何无法解析或内容不符的行都说明发生了穿插或丢字符；
+测试期间固件使用阻塞策略，所有行都必须到达，固件报告的dropped必须为0。
+其他任务的完整输出（以"$ ["开头）可以穿插在测试行之间。
+
+用法：
+    terminal_stress_check.py capture.txt
+"""
+
+import argparse
+import re
+import sys
+
+ALPHABET = 'ABCDEFGHIJKLMNOPQRSTUVWXYZ' * 2
+PREFIX = r'(?:\[\d+ [^\]]*\] )?'
+LINE = re.compile(PREFIX + r'S(\d+) (\d+) ([A-Z]*)$')
+SUMMARY = re.compile(PREFIX + r'\$ \[Stress\] producers (\d+) lines (\d+) dropped (\d+)$')
+OTHER = re.compile(PREFIX + r'\$ \[')
+
+
+def expected_filler(producer, seq):
+    return ALPHABET[producer:producer + (seq * 7 + producer) % 24]
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Check Terminal stress test output.')
+    parser.add_argument('input', help='captured UART text, - for stdin')
+    args = parser.parse_args()
+
+    stream = sys.stdin if args.input == '-' else open(args.input, encoding='ascii', errors='replace')
+    last = {}
+    received = 0
+    errors = 0
+    summary = None
+    started = False
+
+    for number, raw in enumerate(stream, 1):
+        line = raw.rstrip('\r\n')
+        m = LINE.match(line)
+        if m:
+            started = True
+            producer, seq, filler = int(m.group(1)), int(m.group(2)), m.group(3)
+            if filler != expected_filler(producer, seq) or seq <= last.get(producer, -1):
+                print('line %d: corrupted: %r' % (number, line))
+                errors += 1
+            else:
+                last[producer] = seq
+                received += 1
+            continue
+        m = SUMMARY.match(line)
+        if m:
+            summary = tuple(int(g) for g in m.groups())
+            continue
+        if OTHER.match(line):
+            continue
+        if started and line:
+            # 测试开始后出现的其他内容只可能是被破坏的行
+            print('line %d: unexpected: %r' % (number, line))
+            errors += 1
+
+    if summary is None:
+        print('summary line not found')
+        return 1
+    producers, lines, dropped = summary
+    missing = producers * lines - received
+    print('received %d of %d lines, missing %d, firmware dropped %d, corrupted %d'
+          % (received, producers * lines, missing, dropped, errors))
+    if errors or missing != 0 or dropped != 0:
+        print('FAIL')
+        return 1
+    print('PASS')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())